@@ -1,6 +1,9 @@
-#include <AI\BT\Nodes/Composite/selector.h>
+#include <AI/BT/Nodes/Composite/selector.h>
 
-#include <AI\BT\Nodes/node_enums.h>
+#include <AI/BT/Nodes/node_enums.h>
+#include <AI/BT/bt_defines.h>
+#include <AI/BT/bt_coverage.h>
+#include <AI/BT/bt_batch_interpreter.h>
 
 CEREAL_REGISTER_TYPE(iga::bt::Selector)
 CEREAL_REGISTER_POLYMORPHIC_RELATION(iga::bt::CompositeNode, iga::bt::Selector)
@@ -16,10 +19,22 @@ namespace iga {
 
         BaseNode* Selector::Clone() const { return new Selector(*this); }
 
+        bool Selector::IsPure() const { return true; }
+
+        bool Selector::GetContinueResult(NodeResult& a_result) const {
+            a_result = NodeResult::FAILED;
+            return true;
+        }
+
         NodeResult Selector::OnUpdate() {
 
-            for (auto child_node : this->GetChildren()) {
-                NodeResult result = child_node->ExecuteNode();
+            std::vector<BaseNode*> children = this->GetChildren();
+            for (std::size_t child_index = 0; child_index < children.size(); ++child_index) {
+                NodeResult result = children[child_index]->ExecuteNode();
+
+#ifdef BT_COVERAGE
+                this->GetBehaviourTree()->GetCoverage()->RecordBranch(this->GetEditorNodeID(), child_index, children.size(), result);
+#endif // BT_COVERAGE
 
                 // If result isn't failed return the result, otherwise keep 
                 // updating children until a child doesn't return failed.
@@ -33,6 +48,25 @@ namespace iga {
 
         }
 
+        bool Selector::ExecuteBatch(BTBatchInterpreter& a_batch, const BTBatchMask& a_active, BTBatchResult& a_result) const {
+            BTBatchFrame& frame = a_batch.PushFrame();
+            frame.active.Assign(a_active);
+
+            std::vector<BaseNode*> children = this->GetChildren();
+            for (std::size_t child_index = 0; child_index < children.size() && !frame.active.IsEmpty(); ++child_index) {
+                a_batch.Execute(children[child_index], frame.active, frame.result);
+
+                // Agents whose result isn't FAILED stop with the result,
+                // the others continue with the next child.
+                a_result.Merge(frame.result, NodeResult::FAILED);
+                frame.active.Assign(frame.result.Get(NodeResult::FAILED));
+            }
+
+            a_result.Get(NodeResult::FAILED).Assign(frame.active);
+            a_batch.PopFrame();
+            return true;
+        }
+
 #ifdef EDITOR
 
         void Selector::ConstructEditorNode(iga::bte::EditorNode* a_editor_node) {
@@ -1,6 +1,6 @@
 #pragma once
 
-#include <AI\BT\Nodes\composite_node.h>
+#include <AI/BT/Nodes/composite_node.h>
 
 /**
 * @file selector.h
@@ -51,6 +51,28 @@ namespace iga {
             */
             virtual BaseNode* Clone() const override;
 
+            /**
+            *   Overriden function, the node has no side effects.
+            *   @return bool True.
+            */
+            virtual bool IsPure() const override;
+
+            /**
+            *   Overriden function, the selector continues while its children return FAILED.
+            *   @param NodeResult a_result The container that the continue result gets stored in.
+            *   @return bool True.
+            */
+            virtual bool GetContinueResult(NodeResult& a_result) const override;
+
+            /**
+            *   Overriden function that executes the children in order, for the agents that failed on the previous child.
+            *   @param BTBatchInterpreter a_batch The interpreter.
+            *   @param BTBatchMask a_active The agents that execute the node.
+            *   @param BTBatchResult a_result The container that the agents get stored in, by result.
+            *   @return bool True.
+            */
+            virtual bool ExecuteBatch(BTBatchInterpreter& a_batch, const BTBatchMask& a_active, BTBatchResult& a_result) const override;
+
         private:
 
 #ifdef EDITOR
@@ -1,6 +1,9 @@
-#include <AI\BT\Nodes/Composite/sequence.h>
+#include <AI/BT/Nodes/Composite/sequence.h>
 
-#include <AI\BT\Nodes/node_enums.h>
+#include <AI/BT/Nodes/node_enums.h>
+#include <AI/BT/bt_defines.h>
+#include <AI/BT/bt_coverage.h>
+#include <AI/BT/bt_batch_interpreter.h>
 
 CEREAL_REGISTER_TYPE(iga::bt::Sequence)
 CEREAL_REGISTER_POLYMORPHIC_RELATION(iga::bt::CompositeNode, iga::bt::Sequence)
@@ -17,10 +20,22 @@ namespace iga {
 
         BaseNode* Sequence::Clone() const { return new Sequence(*this); }
 
+        bool Sequence::IsPure() const { return true; }
+
+        bool Sequence::GetContinueResult(NodeResult& a_result) const {
+            a_result = NodeResult::SUCCESS;
+            return true;
+        }
+
         NodeResult Sequence::OnUpdate() {
 
-            for (auto child_node : this->GetChildren()) {
-                NodeResult result = child_node->ExecuteNode();
+            std::vector<BaseNode*> children = this->GetChildren();
+            for (std::size_t child_index = 0; child_index < children.size(); ++child_index) {
+                NodeResult result = children[child_index]->ExecuteNode();
+
+#ifdef BT_COVERAGE
+                this->GetBehaviourTree()->GetCoverage()->RecordBranch(this->GetEditorNodeID(), child_index, children.size(), result);
+#endif // BT_COVERAGE
 
                 // If node result isn't SUCCESS - Stop updating
                 // and return the result.
@@ -33,6 +48,25 @@ namespace iga {
 
         }
 
+        bool Sequence::ExecuteBatch(BTBatchInterpreter& a_batch, const BTBatchMask& a_active, BTBatchResult& a_result) const {
+            BTBatchFrame& frame = a_batch.PushFrame();
+            frame.active.Assign(a_active);
+
+            std::vector<BaseNode*> children = this->GetChildren();
+            for (std::size_t child_index = 0; child_index < children.size() && !frame.active.IsEmpty(); ++child_index) {
+                a_batch.Execute(children[child_index], frame.active, frame.result);
+
+                // Agents whose result isn't SUCCESS stop with the result,
+                // the others continue with the next child.
+                a_result.Merge(frame.result, NodeResult::SUCCESS);
+                frame.active.Assign(frame.result.Get(NodeResult::SUCCESS));
+            }
+
+            a_result.Get(NodeResult::SUCCESS).Assign(frame.active);
+            a_batch.PopFrame();
+            return true;
+        }
+
 #ifdef EDITOR
 
         void Sequence::ConstructEditorNode(iga::bte::EditorNode* a_editor_node) {
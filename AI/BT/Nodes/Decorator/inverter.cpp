@@ -1,6 +1,7 @@
-#include <AI\BT\Nodes/Decorator/inverter.h>
+#include <AI/BT/Nodes/Decorator/inverter.h>
 
-#include <AI\BT\Nodes/node_enums.h>
+#include <AI/BT/Nodes/node_enums.h>
+#include <AI/BT/bt_batch_interpreter.h>
 
 CEREAL_REGISTER_TYPE(iga::bt::Inverter)
 CEREAL_REGISTER_POLYMORPHIC_RELATION(iga::bt::DecoratorNode, iga::bt::Inverter)
@@ -16,6 +17,8 @@ namespace iga {
 
         BaseNode* Inverter::Clone() const { return new Inverter(*this); }
 
+        bool Inverter::IsPure() const { return true; }
+
         NodeResult Inverter::OnUpdate() {
 
             NodeResult result = this->GetChild()->ExecuteNode();
@@ -34,6 +37,14 @@ namespace iga {
 
         }
 
+        bool Inverter::ExecuteBatch(BTBatchInterpreter& a_batch, const BTBatchMask& a_active, BTBatchResult& a_result) const {
+            a_batch.Execute(this->GetChild(), a_active, a_result);
+
+            // Invert the result.
+            std::swap(a_result.Get(NodeResult::SUCCESS), a_result.Get(NodeResult::FAILED));
+            return true;
+        }
+
 #ifdef EDITOR
 
         void Inverter::ConstructEditorNode(iga::bte::EditorNode* a_editor_node) {
@@ -1,6 +1,9 @@
-#include <AI\BT\Nodes/Decorator/repeater.h>
+#include <AI/BT/Nodes/Decorator/repeater.h>
 
-#include <AI\BT\Nodes/node_enums.h>
+#include <AI/BT/bt_runtime_asset.h>
+
+#include <AI/BT/Nodes/node_enums.h>
+#include <AI/BT/bt_batch_interpreter.h>
 
 CEREAL_REGISTER_TYPE(iga::bt::Repeater)
 CEREAL_REGISTER_POLYMORPHIC_RELATION(iga::bt::DecoratorNode, iga::bt::Repeater)
@@ -16,6 +19,27 @@ namespace iga {
 
         BaseNode* Repeater::Clone() const { return new Repeater(*this); }
 
+        bool Repeater::IsPure() const { return true; }
+
+        void Repeater::WriteRuntimeData(BTRuntimeWriter& a_writer) const {
+            a_writer.WriteInt(this->repeater_count_max_);
+        }
+
+        void Repeater::ReadRuntimeData(BTRuntimeReader& a_reader) {
+            a_reader.ReadInt(this->repeater_count_max_);
+        }
+
+        void Repeater::TransferRuntimeState(const BaseNode& a_previous_node) {
+            const Repeater& previous_repeater = static_cast<const Repeater&>(a_previous_node);
+
+            // The max count may have changed.
+            this->repeater_count_ = (previous_repeater.repeater_count_ < this->repeater_count_max_) ? previous_repeater.repeater_count_ : 0;
+        }
+
+        void Repeater::ResetRuntimeState() {
+            this->repeater_count_ = 0;
+        }
+
         void Repeater::SetMaxRepeaterCount(int a_max_count) {
             this->repeater_count_max_ = a_max_count;
         }
@@ -42,6 +66,23 @@ namespace iga {
 
         }
 
+        bool Repeater::ExecuteBatch(BTBatchInterpreter& a_batch, const BTBatchMask& a_active, BTBatchResult& a_result) const {
+            BTBatchFrame& frame = a_batch.PushFrame();
+            frame.active.Assign(a_active);
+
+            // Agents keep executing the child until the max count has been reached
+            // or until the child doesn't return success.
+            for (int count = 0; count < this->repeater_count_max_ && !frame.active.IsEmpty(); ++count) {
+                a_batch.Execute(this->GetChild(), frame.active, frame.result);
+                a_result.Merge(frame.result, NodeResult::SUCCESS);
+                frame.active.Assign(frame.result.Get(NodeResult::SUCCESS));
+            }
+
+            a_result.Get(NodeResult::SUCCESS).Assign(frame.active);
+            a_batch.PopFrame();
+            return true;
+        }
+
 #ifdef EDITOR
 
         void Repeater::ConstructEditorNode(iga::bte::EditorNode* a_editor_node) {
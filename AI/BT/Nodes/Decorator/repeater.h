@@ -1,6 +1,6 @@
 #pragma once
 
-#include <AI\BT\Nodes\decorator_node.h>
+#include <AI/BT/Nodes/decorator_node.h>
 
 /**
 * @file repeater.h
@@ -47,6 +47,44 @@ namespace iga {
             */
             virtual BaseNode* Clone() const override;
 
+            /**
+            *   Overriden function, the node has no side effects.
+            *   @return bool True.
+            */
+            virtual bool IsPure() const override;
+
+            /**
+            *   Overriden function that writes the parameters of the node into a runtime asset.
+            *   @param BTRuntimeWriter a_writer The writer of the runtime asset.
+            */
+            virtual void WriteRuntimeData(BTRuntimeWriter& a_writer) const override;
+
+            /**
+            *   Overriden function that reads the parameters of the node from a runtime asset.
+            *   @param BTRuntimeReader a_reader The reader of the runtime asset.
+            */
+            virtual void ReadRuntimeData(BTRuntimeReader& a_reader) override;
+
+            /**
+            *   Overriden function that takes over the repeater count of the replaced repeater.
+            *   @param BaseNode a_previous_node The replaced repeater.
+            */
+            virtual void TransferRuntimeState(const BaseNode& a_previous_node) override;
+
+            /**
+            *   Overriden function that resets the repeater count.
+            */
+            virtual void ResetRuntimeState() override;
+
+            /**
+            *   Overriden function that executes the child up to the max count, for the agents that keep succeeding.
+            *   @param BTBatchInterpreter a_batch The interpreter.
+            *   @param BTBatchMask a_active The agents that execute the node.
+            *   @param BTBatchResult a_result The container that the agents get stored in, by result.
+            *   @return bool True.
+            */
+            virtual bool ExecuteBatch(BTBatchInterpreter& a_batch, const BTBatchMask& a_active, BTBatchResult& a_result) const override;
+
             /**
             *  Serializes this node.
             */
@@ -1,6 +1,7 @@
-#include <AI\BT\Nodes/Decorator/root.h>
+#include <AI/BT/Nodes/Decorator/root.h>
 
-#include <AI\BT\Nodes/node_enums.h>
+#include <AI/BT/Nodes/node_enums.h>
+#include <AI/BT/bt_batch_interpreter.h>
 
 CEREAL_REGISTER_TYPE(iga::bt::Root)
 CEREAL_REGISTER_POLYMORPHIC_RELATION(iga::bt::DecoratorNode, iga::bt::Root)
@@ -24,6 +25,11 @@ namespace iga {
 
         }
 
+        bool Root::ExecuteBatch(BTBatchInterpreter& a_batch, const BTBatchMask& a_active, BTBatchResult& a_result) const {
+            a_batch.Execute(this->GetChild(), a_active, a_result);
+            return true;
+        }
+
 #ifdef EDITOR
 
         void Root::ConstructEditorNode(iga::bte::EditorNode* a_editor_node) {
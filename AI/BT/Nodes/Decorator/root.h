@@ -1,6 +1,6 @@
 #pragma once
 
-#include <AI\BT\Nodes\decorator_node.h>
+#include <AI/BT/Nodes/decorator_node.h>
 
 /**
 * @file inverter.h
@@ -49,6 +49,15 @@ namespace iga {
             */
             virtual BaseNode* Clone() const override;
 
+            /**
+            *   Overriden function that executes the child for all agents.
+            *   @param BTBatchInterpreter a_batch The interpreter.
+            *   @param BTBatchMask a_active The agents that execute the node.
+            *   @param BTBatchResult a_result The container that the agents get stored in, by result.
+            *   @return bool True.
+            */
+            virtual bool ExecuteBatch(BTBatchInterpreter& a_batch, const BTBatchMask& a_active, BTBatchResult& a_result) const override;
+
         private:
 
 #ifdef EDITOR
@@ -1,6 +1,7 @@
-#include <AI\BT\Nodes/Decorator/successor.h>
+#include <AI/BT/Nodes/Decorator/successor.h>
 
-#include <AI\BT\Nodes/node_enums.h>
+#include <AI/BT/Nodes/node_enums.h>
+#include <AI/BT/bt_batch_interpreter.h>
 
 CEREAL_REGISTER_TYPE(iga::bt::Successor)
 CEREAL_REGISTER_POLYMORPHIC_RELATION(iga::bt::DecoratorNode, iga::bt::Successor)
@@ -16,6 +17,8 @@ namespace iga {
 
         BaseNode* Successor::Clone() const { return new Successor(*this); }
 
+        bool Successor::IsPure() const { return true; }
+
         NodeResult Successor::OnUpdate() {
 
             // Always return SUCCESS
@@ -25,6 +28,16 @@ namespace iga {
 
         }
 
+        bool Successor::ExecuteBatch(BTBatchInterpreter& a_batch, const BTBatchMask& a_active, BTBatchResult& a_result) const {
+            BTBatchFrame& frame = a_batch.PushFrame();
+            a_batch.Execute(this->GetChild(), a_active, frame.result);
+            a_batch.PopFrame();
+
+            // Always return SUCCESS
+            a_result.Get(NodeResult::SUCCESS).Assign(a_active);
+            return true;
+        }
+
 #ifdef EDITOR
 
         void Successor::ConstructEditorNode(iga::bte::EditorNode* a_editor_node) {
@@ -1,5 +1,9 @@
 #include <AI/BT/Nodes/Leaf/black_board_equal.h>
 
+#include <AI/BT/bt_batch_interpreter.h>
+#include <AI/BT/bt_batch_kernels.h>
+#include <AI/BT/bt_runtime_asset.h>
+
 #include <iostream>
 
 CEREAL_REGISTER_TYPE(iga::bt::BBCompare)
@@ -12,9 +16,29 @@ namespace iga {
     */
     namespace bt {
 
+        namespace {
+
+            /** Compares a value with an operator that is only known at runtime. */
+            template<typename T>
+            bool CompareWithOperator(CompareOperator a_operator, const T& a_value, const T& a_compare, const T& a_max) {
+                switch (a_operator) {
+                case CompareOperator::EQUAL:            { return CompareValues<CompareOperator::EQUAL>(a_value, a_compare, a_max); }
+                case CompareOperator::NOT_EQUAL:        { return CompareValues<CompareOperator::NOT_EQUAL>(a_value, a_compare, a_max); }
+                case CompareOperator::LESS:             { return CompareValues<CompareOperator::LESS>(a_value, a_compare, a_max); }
+                case CompareOperator::LESS_EQUAL:       { return CompareValues<CompareOperator::LESS_EQUAL>(a_value, a_compare, a_max); }
+                case CompareOperator::GREATER:          { return CompareValues<CompareOperator::GREATER>(a_value, a_compare, a_max); }
+                case CompareOperator::GREATER_EQUAL:    { return CompareValues<CompareOperator::GREATER_EQUAL>(a_value, a_compare, a_max); }
+                case CompareOperator::IN_RANGE:         { return CompareValues<CompareOperator::IN_RANGE>(a_value, a_compare, a_max); }
+                }
+                return false;
+            }
+
+        }
+
         BBCompare::BBCompare() {
             type_ = BlackBoardTypes::INT;
             variable_name_ = "";
+            comparator_ = ResolveComparator(type_, operator_);
         }
 
         BBCompare::~BBCompare() {/*EMPTY*/ }
@@ -23,11 +47,228 @@ namespace iga {
 
         BaseNode* BBCompare::Clone() const { return new BBCompare(*this); }
 
+        bool BBCompare::IsPure() const { return true; }
+
+        void BBCompare::GetBlackBoardKeys(std::vector<BlackBoardKey>& a_keys) const {
+            BlackBoardKey key;
+            key.name    = this->variable_name_;
+            key.type    = this->type_;
+            key.write   = false;
+            a_keys.push_back(key);
+
+            if (!this->other_variable_name_.empty()) {
+                key.name = this->other_variable_name_;
+                a_keys.push_back(key);
+            }
+        }
+
+        void BBCompare::WriteRuntimeData(BTRuntimeWriter& a_writer) const {
+            a_writer.WriteInt(static_cast<int>(this->type_));
+            a_writer.WriteString(this->variable_name_);
+            a_writer.WriteInt(static_cast<int>(this->operator_));
+
+            // Only the value of the compared type is needed at runtime, and the max value only for IN_RANGE.
+            bool in_range = this->operator_ == CompareOperator::IN_RANGE;
+            switch (this->type_) {
+            case (BlackBoardTypes::INT): {
+                a_writer.WriteInt(this->variable_value_int_);
+                if (in_range) { a_writer.WriteInt(this->variable_value_int_max_); }
+                break;
+            }
+            case (BlackBoardTypes::FLOAT): {
+                a_writer.WriteFloat(this->variable_value_float_);
+                if (in_range) { a_writer.WriteFloat(this->variable_value_float_max_); }
+                break;
+            }
+            case (BlackBoardTypes::BOOL): {
+                a_writer.WriteBool(this->variable_value_bool_);
+                if (in_range) { a_writer.WriteBool(this->variable_value_bool_max_); }
+                break;
+            }
+            case (BlackBoardTypes::STRING): {
+                a_writer.WriteString(this->variable_value_string_);
+                if (in_range) { a_writer.WriteString(this->variable_value_string_max_); }
+                break;
+            }
+            case (BlackBoardTypes::VECTOR2): {
+                a_writer.WriteString(this->other_variable_name_);
+                a_writer.WriteFloat(this->variable_value_vector_.x);
+                a_writer.WriteFloat(this->variable_value_vector_.y);
+                a_writer.WriteFloat(this->distance_);
+                if (in_range) { a_writer.WriteFloat(this->distance_min_); }
+                break;
+            }
+            case (BlackBoardTypes::VECTOR4): {
+                a_writer.WriteString(this->other_variable_name_);
+                a_writer.WriteFloat(this->variable_value_vector_.x);
+                a_writer.WriteFloat(this->variable_value_vector_.y);
+                a_writer.WriteFloat(this->variable_value_vector_.z);
+                a_writer.WriteFloat(this->variable_value_vector_.w);
+                a_writer.WriteFloat(this->distance_);
+                if (in_range) { a_writer.WriteFloat(this->distance_min_); }
+                break;
+            }
+            case (BlackBoardTypes::ENTITY): { a_writer.WriteString(this->other_variable_name_);     break; }
+            }
+        }
+
+        void BBCompare::ReadRuntimeData(BTRuntimeReader& a_reader) {
+            int type = 0;
+            a_reader.ReadInt(type);
+            this->type_ = static_cast<BlackBoardTypes>(type);
+            a_reader.ReadString(this->variable_name_);
+            int compare_operator = 0;
+            a_reader.ReadInt(compare_operator);
+            this->operator_ = static_cast<CompareOperator>(compare_operator);
+
+            bool in_range = this->operator_ == CompareOperator::IN_RANGE;
+            switch (this->type_) {
+            case (BlackBoardTypes::INT): {
+                a_reader.ReadInt(this->variable_value_int_);
+                if (in_range) { a_reader.ReadInt(this->variable_value_int_max_); }
+                break;
+            }
+            case (BlackBoardTypes::FLOAT): {
+                a_reader.ReadFloat(this->variable_value_float_);
+                if (in_range) { a_reader.ReadFloat(this->variable_value_float_max_); }
+                break;
+            }
+            case (BlackBoardTypes::BOOL): {
+                a_reader.ReadBool(this->variable_value_bool_);
+                if (in_range) { a_reader.ReadBool(this->variable_value_bool_max_); }
+                break;
+            }
+            case (BlackBoardTypes::STRING): {
+                a_reader.ReadString(this->variable_value_string_);
+                if (in_range) { a_reader.ReadString(this->variable_value_string_max_); }
+                break;
+            }
+            case (BlackBoardTypes::VECTOR2): {
+                a_reader.ReadString(this->other_variable_name_);
+                a_reader.ReadFloat(this->variable_value_vector_.x);
+                a_reader.ReadFloat(this->variable_value_vector_.y);
+                a_reader.ReadFloat(this->distance_);
+                if (in_range) { a_reader.ReadFloat(this->distance_min_); }
+                break;
+            }
+            case (BlackBoardTypes::VECTOR4): {
+                a_reader.ReadString(this->other_variable_name_);
+                a_reader.ReadFloat(this->variable_value_vector_.x);
+                a_reader.ReadFloat(this->variable_value_vector_.y);
+                a_reader.ReadFloat(this->variable_value_vector_.z);
+                a_reader.ReadFloat(this->variable_value_vector_.w);
+                a_reader.ReadFloat(this->distance_);
+                if (in_range) { a_reader.ReadFloat(this->distance_min_); }
+                break;
+            }
+            case (BlackBoardTypes::ENTITY): { a_reader.ReadString(this->other_variable_name_);      break; }
+            }
+
+            this->comparator_ = ResolveComparator(this->type_, this->operator_);
+        }
+
+        void BBCompare::OnBehaviourTreeBuild() {
+            // Deserialized nodes get their comparator here.
+            this->comparator_ = ResolveComparator(this->type_, this->operator_);
+        }
+
+#pragma region BBCompare Comparators
+
+        BBCompare::Comparator BBCompare::ResolveComparator(BlackBoardTypes a_type, CompareOperator a_operator) {
+            switch (a_type) {
+            case (BlackBoardTypes::INT):        { return ResolveValueComparator<int>(a_operator); }
+            case (BlackBoardTypes::FLOAT):      { return ResolveValueComparator<float>(a_operator); }
+            case (BlackBoardTypes::BOOL):       { return ResolveValueComparator<bool>(a_operator); }
+            case (BlackBoardTypes::STRING):     { return ResolveValueComparator<std::string>(a_operator); }
+            case (BlackBoardTypes::VECTOR2):    { return ResolveDistanceComparator<BlackBoardVector2>(a_operator); }
+            case (BlackBoardTypes::VECTOR4):    { return ResolveDistanceComparator<BlackBoardVector4>(a_operator); }
+            case (BlackBoardTypes::ENTITY): {
+                if (a_operator == CompareOperator::EQUAL)       { return &CompareEntity<true>; }
+                if (a_operator == CompareOperator::NOT_EQUAL)   { return &CompareEntity<false>; }
+                std::cout << "ERROR - Behaviour Tree System - BBCompare: Entities can only be compared with == and !=" << std::endl;
+                return &CompareNever;
+            }
+            }
+            return &CompareNever;
+        }
+
+        template<typename T>
+        BBCompare::Comparator BBCompare::ResolveValueComparator(CompareOperator a_operator) {
+            switch (a_operator) {
+            case CompareOperator::EQUAL:            { return &CompareValue<T, CompareOperator::EQUAL>; }
+            case CompareOperator::NOT_EQUAL:        { return &CompareValue<T, CompareOperator::NOT_EQUAL>; }
+            case CompareOperator::LESS:             { return &CompareValue<T, CompareOperator::LESS>; }
+            case CompareOperator::LESS_EQUAL:       { return &CompareValue<T, CompareOperator::LESS_EQUAL>; }
+            case CompareOperator::GREATER:          { return &CompareValue<T, CompareOperator::GREATER>; }
+            case CompareOperator::GREATER_EQUAL:    { return &CompareValue<T, CompareOperator::GREATER_EQUAL>; }
+            case CompareOperator::IN_RANGE:         { return &CompareValue<T, CompareOperator::IN_RANGE>; }
+            }
+            return &CompareNever;
+        }
+
+        template<typename TVector>
+        BBCompare::Comparator BBCompare::ResolveDistanceComparator(CompareOperator a_operator) {
+            switch (a_operator) {
+            case CompareOperator::EQUAL:            { return &CompareDistance<TVector, CompareOperator::EQUAL>; }
+            case CompareOperator::NOT_EQUAL:        { return &CompareDistance<TVector, CompareOperator::NOT_EQUAL>; }
+            case CompareOperator::LESS:             { return &CompareDistance<TVector, CompareOperator::LESS>; }
+            case CompareOperator::LESS_EQUAL:       { return &CompareDistance<TVector, CompareOperator::LESS_EQUAL>; }
+            case CompareOperator::GREATER:          { return &CompareDistance<TVector, CompareOperator::GREATER>; }
+            case CompareOperator::GREATER_EQUAL:    { return &CompareDistance<TVector, CompareOperator::GREATER_EQUAL>; }
+            case CompareOperator::IN_RANGE:         { return &CompareDistance<TVector, CompareOperator::IN_RANGE>; }
+            }
+            return &CompareNever;
+        }
+
+        template<typename T, CompareOperator TOperator>
+        bool BBCompare::CompareValue(const BBCompare& a_node, const BlackBoard& a_blackboard) {
+            T value;
+            if (!ReadValue(a_blackboard, a_node.variable_name_, value)) { return false; }
+
+            const T* compare = nullptr;
+            const T* max = nullptr;
+            a_node.GetBounds(compare, max);
+            return CompareValues<TOperator>(value, *compare, *max);
+        }
+
+        template<typename TVector, CompareOperator TOperator>
+        bool BBCompare::CompareDistance(const BBCompare& a_node, const BlackBoard& a_blackboard) {
+            TVector value;
+            TVector other;
+            a_node.GetPoint(other);
+            if (!ReadValue(a_blackboard, a_node.variable_name_, value)) { return false; }
+            if (!a_node.other_variable_name_.empty() && !ReadValue(a_blackboard, a_node.other_variable_name_, other)) { return false; }
+
+            float max = a_node.distance_ * a_node.distance_;
+            float compare = TOperator == CompareOperator::IN_RANGE ? a_node.distance_min_ * a_node.distance_min_ : max;
+            return CompareValues<GetDistanceOperator(TOperator)>(DistanceSquared(value, other), compare, max);
+        }
+
+        template<bool TEqual>
+        bool BBCompare::CompareEntity(const BBCompare& a_node, const BlackBoard& a_blackboard) {
+            // Without another variable the handle gets compared with the null handle.
+            BlackBoardEntity value;
+            BlackBoardEntity other;
+            if (!a_blackboard.GetEntityMemory(a_node.variable_name_, value)) { return false; }
+            if (!a_node.other_variable_name_.empty() && !a_blackboard.GetEntityMemory(a_node.other_variable_name_, other)) { return false; }
+            return (value == other) == TEqual;
+        }
+
+        bool BBCompare::CompareNever(const BBCompare& a_node, const BlackBoard& a_blackboard) {
+            UNUSED(a_node);
+            UNUSED(a_blackboard);
+            return false;
+        }
+
+#pragma endregion End of BBCompare Comparators
+
 #ifdef EDITOR
 
         void BBCompare::OnEditorLoad() {
             memcpy(variable_name_buffer_, variable_name_.c_str(), variable_name_.size());
             memcpy(variable_value_buffer_, variable_value_string_.c_str(), variable_value_string_.size());
+            memcpy(variable_value_max_buffer_, variable_value_string_max_.c_str(), variable_value_string_max_.size());
+            memcpy(other_variable_name_buffer_, other_variable_name_.c_str(), other_variable_name_.size());
         }
 
         void BBCompare::ConstructEditorNode(iga::bte::EditorNode* a_editor_node) {
@@ -41,18 +282,24 @@ namespace iga {
 
             // Variable Type
             ImGui::Text("Variable Type");
-            static const char* list_items[] = { "Int", "Float", "Bool", "String" };
+            static const char* list_items[] = { "Int", "Float", "Bool", "String", "Vector2", "Vector4", "Entity" };
             static int current_setting;
             if (type_ == BlackBoardTypes::INT) { current_setting = 0; }
             else if (type_ == BlackBoardTypes::FLOAT) { current_setting = 1; }
             else if (type_ == BlackBoardTypes::BOOL) { current_setting = 2; }
-            else if (type_ == BlackBoardTypes::STRING) { current_setting = 2; }
-            if (ImGui::ListBox("##VariableType", &current_setting, list_items, IM_ARRAYSIZE(list_items), 4)) {
+            else if (type_ == BlackBoardTypes::STRING) { current_setting = 3; }
+            else if (type_ == BlackBoardTypes::VECTOR2) { current_setting = 4; }
+            else if (type_ == BlackBoardTypes::VECTOR4) { current_setting = 5; }
+            else if (type_ == BlackBoardTypes::ENTITY) { current_setting = 6; }
+            if (ImGui::ListBox("##VariableType", &current_setting, list_items, IM_ARRAYSIZE(list_items), 7)) {
                 switch (current_setting) {
                 case (0): { type_ = BlackBoardTypes::INT;    break; }
                 case (1): { type_ = BlackBoardTypes::FLOAT;  break; }
                 case (2): { type_ = BlackBoardTypes::BOOL;   break; }
                 case (3): { type_ = BlackBoardTypes::STRING; break; }
+                case (4): { type_ = BlackBoardTypes::VECTOR2; break; }
+                case (5): { type_ = BlackBoardTypes::VECTOR4; break; }
+                case (6): { type_ = BlackBoardTypes::ENTITY; break; }
                 }
             }
 
@@ -62,61 +309,189 @@ namespace iga {
                 variable_name_ = variable_name_buffer_;
             }
 
-            ImGui::Text("Variable Value");
+            // Operator, entities can only be compared with == and !=.
+            ImGui::Text("Operator");
+            static const char* operator_items[] = { "==", "!=", "<", "<=", ">", ">=", "In Range" };
+            int operator_count = type_ == BlackBoardTypes::ENTITY ? 2 : static_cast<int>(IM_ARRAYSIZE(operator_items));
+            if (static_cast<int>(operator_) >= operator_count) { operator_ = CompareOperator::EQUAL; }
+            int current_operator = static_cast<int>(operator_);
+            if (ImGui::ListBox("##Operator", &current_operator, operator_items, operator_count, operator_count)) {
+                operator_ = static_cast<CompareOperator>(current_operator);
+            }
+            bool in_range = operator_ == CompareOperator::IN_RANGE;
+
+            ImGui::Text(in_range ? "Min Value" : "Variable Value");
             // Value
             switch (type_) {
             case(BlackBoardTypes::INT): {
                 ImGui::InputInt("##VariableNameInt", &variable_value_int_);
+                if (in_range) {
+                    ImGui::Text("Max Value");
+                    ImGui::InputInt("##VariableMaxInt", &variable_value_int_max_);
+                }
                 break;
             }
             case (BlackBoardTypes::FLOAT): {
                 ImGui::InputFloat("##VariableNameFloat", &variable_value_float_);
+                if (in_range) {
+                    ImGui::Text("Max Value");
+                    ImGui::InputFloat("##VariableMaxFloat", &variable_value_float_max_);
+                }
                 break;
             }
             case (BlackBoardTypes::BOOL): {
                 ImGui::Checkbox("##VariableNameBool", &variable_value_bool_);
+                if (in_range) {
+                    ImGui::Text("Max Value");
+                    ImGui::Checkbox("##VariableMaxBool", &variable_value_bool_max_);
+                }
                 break;
             }
             case (BlackBoardTypes::STRING): {
                 if (ImGui::InputText("##VariableNameString", variable_value_buffer_, IM_ARRAYSIZE(variable_value_buffer_))) {
                     variable_value_string_ = variable_value_buffer_;
                 }
+                if (in_range) {
+                    ImGui::Text("Max Value");
+                    if (ImGui::InputText("##VariableMaxString", variable_value_max_buffer_, IM_ARRAYSIZE(variable_value_max_buffer_))) {
+                        variable_value_string_max_ = variable_value_max_buffer_;
+                    }
+                }
                 break;
             }
+            case (BlackBoardTypes::VECTOR2): {
+                ImGui::InputFloat2("##VariableNameVector2", &variable_value_vector_.x);
+                ImGui::Text("Distance");
+                ImGui::InputFloat("##Distance", &distance_);
+                if (in_range) {
+                    ImGui::Text("Min Distance");
+                    ImGui::InputFloat("##MinDistance", &distance_min_);
+                }
+                break;
+            }
+            case (BlackBoardTypes::VECTOR4): {
+                ImGui::InputFloat4("##VariableNameVector4", &variable_value_vector_.x);
+                ImGui::Text("Distance");
+                ImGui::InputFloat("##Distance", &distance_);
+                if (in_range) {
+                    ImGui::Text("Min Distance");
+                    ImGui::InputFloat("##MinDistance", &distance_min_);
+                }
+                break;
+            }
+            case (BlackBoardTypes::ENTITY): {
+                break;
+            }
+            }
+
+            // Vectors and entities can be compared with another variable instead of the value.
+            if (type_ == BlackBoardTypes::VECTOR2 || type_ == BlackBoardTypes::VECTOR4 || type_ == BlackBoardTypes::ENTITY) {
+                ImGui::Text("Other Variable Name");
+                if (ImGui::InputText("##OtherVariableName", other_variable_name_buffer_, IM_ARRAYSIZE(other_variable_name_buffer_))) {
+                    other_variable_name_ = other_variable_name_buffer_;
+                }
             }
 
+            comparator_ = ResolveComparator(type_, operator_);
         }
 
 #endif // EDITOR
 
         iga::bt::NodeResult BBCompare::OnUpdate() {
+            if (comparator_(*this, *GetBehaviourTree()->GetBlackBoard())) {
+                return iga::bt::NodeResult::SUCCESS;
+            } else {
+                return iga::bt::NodeResult::FAILED;
+            }
+        }
+
+        bool BBCompare::ExecuteBatch(BTBatchInterpreter& a_batch, const BTBatchMask& a_active, BTBatchResult& a_result) const {
+            std::uint32_t column = a_batch.FindColumn(this->variable_name_, this->type_);
+            if (column == BlackBoardStore::invalid_) { return false; }
 
-            bool is_valid = false;
+            // Only vectors and entities get compared with another variable.
+            bool has_other = !this->other_variable_name_.empty() &&
+                (type_ == BlackBoardTypes::VECTOR2 || type_ == BlackBoardTypes::VECTOR4 || type_ == BlackBoardTypes::ENTITY);
+            std::uint32_t other_column = has_other ? a_batch.FindColumn(this->other_variable_name_, this->type_) : BlackBoardStore::invalid_;
+            if (has_other && other_column == BlackBoardStore::invalid_) { return false; }
 
+            const BlackBoardStore& store = a_batch.GetStore();
+            BlackBoardStore::TableID table = a_batch.GetTable();
+            std::uint32_t row_count = a_batch.GetRowCount();
+
+            // The type and the operator are the same for all agents, the compare runs over the whole column.
+            BTBatchMask& passed = a_result.Get(NodeResult::SUCCESS);
             switch (type_) {
                 case(BlackBoardTypes::INT): {
-                    is_valid = EqualCompare(variable_name_,variable_value_int_);
+                    BTBatchKernels::CompareInt(store.GetIntColumn(table, column), row_count, operator_, variable_value_int_, variable_value_int_max_, passed.GetWords());
                     break;
                 }
                 case (BlackBoardTypes::FLOAT): {
-                    is_valid = EqualCompare(variable_name_, variable_value_float_);
+                    BTBatchKernels::CompareFloat(store.GetFloatColumn(table, column), row_count, operator_, variable_value_float_, variable_value_float_max_, passed.GetWords());
                     break;
                 }
                 case (BlackBoardTypes::BOOL): {
-                    is_valid = EqualCompare(variable_name_, variable_value_bool_);
+                    BTBatchKernels::CompareByte(store.GetBoolColumn(table, column), row_count, operator_,
+                        variable_value_bool_ ? 1 : 0, variable_value_bool_max_ ? 1 : 0, passed.GetWords());
                     break;
                 }
                 case (BlackBoardTypes::STRING): {
-                    is_valid = EqualCompare(variable_name_, variable_value_string_);
+                    const std::string* values = store.GetStringColumn(table, column);
+                    for (std::uint32_t row = 0; row < row_count; ++row) {
+                        if (a_active.Test(row) && CompareWithOperator(operator_, values[row], variable_value_string_, variable_value_string_max_)) { passed.Set(row); }
+                    }
+                    break;
+                }
+                case (BlackBoardTypes::VECTOR2):
+                case (BlackBoardTypes::VECTOR4): {
+                    CompareOperator distance_operator = GetDistanceOperator(operator_);
+                    float max = distance_ * distance_;
+                    float compare = operator_ == CompareOperator::IN_RANGE ? distance_min_ * distance_min_ : max;
+                    if (type_ == BlackBoardTypes::VECTOR2) {
+                        const BlackBoardVector2* values = store.GetVector2Column(table, column);
+                        const BlackBoardVector2* others = has_other ? store.GetVector2Column(table, other_column) : nullptr;
+                        BlackBoardVector2 point;
+                        GetPoint(point);
+                        for (std::uint32_t row = 0; row < row_count; ++row) {
+                            if (CompareWithOperator(distance_operator, DistanceSquared(values[row], has_other ? others[row] : point), compare, max)) { passed.Set(row); }
+                        }
+                    } else {
+                        const BlackBoardVector4* values = store.GetVector4Column(table, column);
+                        const BlackBoardVector4* others = has_other ? store.GetVector4Column(table, other_column) : nullptr;
+                        for (std::uint32_t row = 0; row < row_count; ++row) {
+                            if (CompareWithOperator(distance_operator, DistanceSquared(values[row], has_other ? others[row] : variable_value_vector_), compare, max)) { passed.Set(row); }
+                        }
+                    }
+                    break;
+                }
+                case (BlackBoardTypes::ENTITY): {
+                    // Without another variable the handle gets compared with the null handle.
+                    // Other operators than == and != always fail, like the comparator.
+                    const BlackBoardEntity* values = store.GetEntityColumn(table, column);
+                    const BlackBoardEntity* others = has_other ? store.GetEntityColumn(table, other_column) : nullptr;
+                    if (operator_ != CompareOperator::EQUAL && operator_ != CompareOperator::NOT_EQUAL) { break; }
+                    bool equal = operator_ == CompareOperator::EQUAL;
+                    for (std::uint32_t row = 0; row < row_count; ++row) {
+                        if ((values[row] == (has_other ? others[row] : BlackBoardEntity())) == equal) { passed.Set(row); }
+                    }
                     break;
                 }
             }
 
-            if (is_valid) {
-                return iga::bt::NodeResult::SUCCESS;
-            } else {
-                return iga::bt::NodeResult::FAILED;
+            // Agents without a value fail, like agents whose value doesn't match.
+            BTBatchFrame& frame = a_batch.PushFrame();
+            BTBatchKernels::NotZeroByte(store.GetValidColumn(table, column), row_count, frame.active.GetWords());
+            passed.And(frame.active);
+            if (has_other) {
+                BTBatchKernels::NotZeroByte(store.GetValidColumn(table, other_column), row_count, frame.active.GetWords());
+                passed.And(frame.active);
             }
+            a_batch.PopFrame();
+
+            passed.And(a_active);
+            a_result.Get(NodeResult::FAILED).Assign(a_active);
+            a_result.Get(NodeResult::FAILED).AndNot(passed);
+            return true;
         }
 
     } // End of namespace ~ bt
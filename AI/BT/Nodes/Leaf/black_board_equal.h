@@ -18,6 +18,12 @@
 
 * Always returns SUCCESS.
 *
+* The variable gets compared with a CompareOperator. The comparator is resolved whenever the type or the
+* operator changes (when the tree gets built, when runtime data gets read and when the node gets inspected),
+* so the update doesn't switch on them. Vectors compare the distance with Distance: == passes within the
+* distance, != outside of it, the relational operators compare the distance itself and In Range passes
+* from Min Distance to Distance. Entities only support == and !=.
+*
 */
 
 /**
@@ -38,6 +44,8 @@ namespace iga {
             */
             enum class Version {
                 DEFAULT = 0,    /**< Default normal version. */
+                VECTORS,        /**< Vector distance and entity compares. */
+                OPERATORS,      /**< Compare operators and the max values of IN_RANGE. */
                 LATEST          /**< Latest version. */
             };
 
@@ -63,6 +71,42 @@ namespace iga {
             */
             virtual BaseNode* Clone() const override;
 
+            /**
+            *   Overriden function, the node has no side effects.
+            *   @return bool True.
+            */
+            virtual bool IsPure() const override;
+
+            /**
+            *   Overriden function that returns the blackboard value that the node reads.
+            *   @param std::vector<BlackBoardKey> a_keys The container that the keys get added to.
+            */
+            virtual void GetBlackBoardKeys(std::vector<BlackBoardKey>& a_keys) const override;
+
+            /**
+            *   Overriden function that writes the parameters of the node into a runtime asset.
+            *   @param BTRuntimeWriter a_writer The writer of the runtime asset.
+            */
+            virtual void WriteRuntimeData(BTRuntimeWriter& a_writer) const override;
+
+            /**
+            *   Overriden function that reads the parameters of the node from a runtime asset.
+            *   @param BTRuntimeReader a_reader The reader of the runtime asset.
+            */
+            virtual void ReadRuntimeData(BTRuntimeReader& a_reader) override;
+
+            /** Virtual Function that gets called whenever the behaviour tree is getting build. */
+            virtual void OnBehaviourTreeBuild() override;
+
+            /**
+            *   Overriden function that compares the column of the variable for all agents at once.
+            *   @param BTBatchInterpreter a_batch The interpreter.
+            *   @param BTBatchMask a_active The agents that execute the node.
+            *   @param BTBatchResult a_result The container that the agents get stored in, by result.
+            *   @return bool - If True ~ The table has the columns of the variables.
+            */
+            virtual bool ExecuteBatch(BTBatchInterpreter& a_batch, const BTBatchMask& a_active, BTBatchResult& a_result) const override;
+
             /**
             *  Serializes this node.
             */
@@ -71,41 +115,63 @@ namespace iga {
 
         private:
 
-            template <class T>
-            inline const bool EqualCompare(std::string& a_value_name, T& compare_value) const {
-                UNUSED(a_value_name);
-                UNUSED(compare_value);
-                DEBUGASSERT(true);
-                return false;
-            }
+            /**
+            *   Compares the variable of a node on a blackboard.
+            *   @param BBCompare a_node The node.
+            *   @param BlackBoard a_blackboard The blackboard of the tree of the node.
+            *   @return bool - If True ~ The variable exists and the compare passes.
+            */
+            typedef bool (*Comparator)(const BBCompare& a_node, const BlackBoard& a_blackboard);
 
-            template <>
-            inline const bool EqualCompare(std::string& a_value_name, int& compare_value) const {
-                int temp;
-                if (!GetBehaviourTree()->GetBlackBoard()->GetIntMemory(a_value_name, temp)) { return false; }
-                return temp == compare_value ? true : false;
-            }
+            /**
+            *   Returns the comparator of a type and an operator.
+            *   @param BlackBoardTypes a_type The type of the variable.
+            *   @param CompareOperator a_operator The operator.
+            *   @return Comparator value, a comparator that always fails if the type doesn't support the operator.
+            */
+            static Comparator ResolveComparator(BlackBoardTypes a_type, CompareOperator a_operator);
+            template<typename T>
+            static Comparator ResolveValueComparator(CompareOperator a_operator);
+            template<typename TVector>
+            static Comparator ResolveDistanceComparator(CompareOperator a_operator);
+
+            /** Comparators of the types, instantiated per operator. */
+            template<typename T, CompareOperator TOperator>
+            static bool CompareValue(const BBCompare& a_node, const BlackBoard& a_blackboard);
+            template<typename TVector, CompareOperator TOperator>
+            static bool CompareDistance(const BBCompare& a_node, const BlackBoard& a_blackboard);
+            template<bool TEqual>
+            static bool CompareEntity(const BBCompare& a_node, const BlackBoard& a_blackboard);
+            static bool CompareNever(const BBCompare& a_node, const BlackBoard& a_blackboard);
 
-            template <>
-            inline const bool EqualCompare(std::string& a_value_name, float& compare_value) const {
-                float temp;
-                // TODO: if (!GetBehaviourTree()->GetBlackBoard()->GetFloatMemory(a_value_name, temp)) { return false; }
-                return temp == compare_value ? true : false;
+            /**
+            *   Returns the operator that compares the squared distance of vectors with the squared Distance.
+            *   == passes within the distance and != outside of it, the other operators compare the distance itself.
+            *   @param CompareOperator a_operator The operator of the node.
+            *   @return CompareOperator value.
+            */
+            static constexpr CompareOperator GetDistanceOperator(CompareOperator a_operator) {
+                return a_operator == CompareOperator::EQUAL ? CompareOperator::LESS_EQUAL :
+                    (a_operator == CompareOperator::NOT_EQUAL ? CompareOperator::GREATER : a_operator);
             }
 
-            template <>
-            inline const bool EqualCompare(std::string& a_value_name, bool& compare_value) const {
-                bool temp;
-                //T ODO: if (!GetBehaviourTree()->GetBlackBoard()->GetBoolMemory(a_value_name, temp)) { return false; }
-                return temp == compare_value ? true : false;
-            }
+            /** Reads a value of a type from a blackboard. */
+            static bool ReadValue(const BlackBoard& a_blackboard, const std::string& a_id, int& a_value) { return a_blackboard.GetIntMemory(a_id, a_value); }
+            static bool ReadValue(const BlackBoard& a_blackboard, const std::string& a_id, float& a_value) { return a_blackboard.GetFloatMemory(a_id, a_value); }
+            static bool ReadValue(const BlackBoard& a_blackboard, const std::string& a_id, bool& a_value) { return a_blackboard.GetBoolMemory(a_id, a_value); }
+            static bool ReadValue(const BlackBoard& a_blackboard, const std::string& a_id, std::string& a_value) { return a_blackboard.GetStringMemory(a_id, a_value); }
+            static bool ReadValue(const BlackBoard& a_blackboard, const std::string& a_id, BlackBoardVector2& a_value) { return a_blackboard.GetVector2Memory(a_id, a_value); }
+            static bool ReadValue(const BlackBoard& a_blackboard, const std::string& a_id, BlackBoardVector4& a_value) { return a_blackboard.GetVector4Memory(a_id, a_value); }
 
-            template <>
-            inline const bool EqualCompare(std::string& a_value_name, std::string& compare_value) const {
-                std::string temp;
-                // TODO: if (!GetBehaviourTree()->GetBlackBoard()->GetStringMemory(a_value_name, temp)) { return false; }
-                return temp == compare_value ? true : false;
-            }
+            /** Returns the compared value and the max value of a type. */
+            void GetBounds(const int*& a_compare, const int*& a_max) const { a_compare = &variable_value_int_; a_max = &variable_value_int_max_; }
+            void GetBounds(const float*& a_compare, const float*& a_max) const { a_compare = &variable_value_float_; a_max = &variable_value_float_max_; }
+            void GetBounds(const bool*& a_compare, const bool*& a_max) const { a_compare = &variable_value_bool_; a_max = &variable_value_bool_max_; }
+            void GetBounds(const std::string*& a_compare, const std::string*& a_max) const { a_compare = &variable_value_string_; a_max = &variable_value_string_max_; }
+
+            /** Returns the point that vectors get compared with, if there is no other variable. */
+            void GetPoint(BlackBoardVector2& a_point) const { a_point = BlackBoardVector2(variable_value_vector_.x, variable_value_vector_.y); }
+            void GetPoint(BlackBoardVector4& a_point) const { a_point = variable_value_vector_; }
 
 #ifdef EDITOR
 
@@ -139,14 +205,29 @@ namespace iga {
 
             std::string variable_name_;
 
+            CompareOperator operator_ = CompareOperator::EQUAL;     /**< How the variable gets compared. */
+            Comparator comparator_ = nullptr;                       /**< Comparator of the type and the operator. */
+
             int variable_value_int_;
             float variable_value_float_;
             bool variable_value_bool_;
             std::string variable_value_string_;
 
+            int variable_value_int_max_ = 0;                /**< Max values of IN_RANGE, the values above are the min values. */
+            float variable_value_float_max_ = 0.0f;
+            bool variable_value_bool_max_ = false;
+            std::string variable_value_string_max_;
+
+            BlackBoardVector4 variable_value_vector_;   /**< Point that vectors get compared with, if there is no other variable. Vector2 uses x and y. */
+            float distance_ = 0.0f;                     /**< Vectors pass if they are at most this far apart. */
+            float distance_min_ = 0.0f;                 /**< Vectors pass IN_RANGE if they are at least this far apart. */
+            std::string other_variable_name_;           /**< Vectors and entities get compared with this variable, if it is set. */
+
 #ifdef EDITOR
             char variable_name_buffer_[256] = "";
             char variable_value_buffer_[256] = "";
+            char variable_value_max_buffer_[256] = "";
+            char other_variable_name_buffer_[256] = "";
 #endif // EDITOR
 
         };
@@ -159,6 +240,46 @@ namespace iga {
     inline void bt::BBCompare::serialize(Archive& a_archive, uint32 const a_version) {
         switch (static_cast<Version>(a_version)) {
         case Version::LATEST:
+        case Version::OPERATORS:
+            a_archive(
+                cereal::base_class<bt::BaseNode>(this),
+                cereal::make_nvp("VariableType", type_),
+                cereal::make_nvp("VariableName", variable_name_),
+                cereal::make_nvp("Operator", operator_),
+                cereal::make_nvp("variable_value_int_", variable_value_int_),
+                cereal::make_nvp("variable_value_float_", variable_value_float_),
+                cereal::make_nvp("variable_value_bool_", variable_value_bool_),
+                cereal::make_nvp("variable_value_string_", variable_value_string_),
+                cereal::make_nvp("variable_value_int_max_", variable_value_int_max_),
+                cereal::make_nvp("variable_value_float_max_", variable_value_float_max_),
+                cereal::make_nvp("variable_value_bool_max_", variable_value_bool_max_),
+                cereal::make_nvp("variable_value_string_max_", variable_value_string_max_),
+                cereal::make_nvp("variable_value_vector_x_", variable_value_vector_.x),
+                cereal::make_nvp("variable_value_vector_y_", variable_value_vector_.y),
+                cereal::make_nvp("variable_value_vector_z_", variable_value_vector_.z),
+                cereal::make_nvp("variable_value_vector_w_", variable_value_vector_.w),
+                cereal::make_nvp("distance_", distance_),
+                cereal::make_nvp("distance_min_", distance_min_),
+                cereal::make_nvp("OtherVariableName", other_variable_name_)
+            );
+            break;
+        case Version::VECTORS:
+            a_archive(
+                cereal::base_class<bt::BaseNode>(this),
+                cereal::make_nvp("VariableType", type_),
+                cereal::make_nvp("VariableName", variable_name_),
+                cereal::make_nvp("variable_value_int_", variable_value_int_),
+                cereal::make_nvp("variable_value_float_", variable_value_float_),
+                cereal::make_nvp("variable_value_bool_", variable_value_bool_),
+                cereal::make_nvp("variable_value_string_", variable_value_string_),
+                cereal::make_nvp("variable_value_vector_x_", variable_value_vector_.x),
+                cereal::make_nvp("variable_value_vector_y_", variable_value_vector_.y),
+                cereal::make_nvp("variable_value_vector_z_", variable_value_vector_.z),
+                cereal::make_nvp("variable_value_vector_w_", variable_value_vector_.w),
+                cereal::make_nvp("distance_", distance_),
+                cereal::make_nvp("OtherVariableName", other_variable_name_)
+            );
+            break;
         case Version::DEFAULT:
             a_archive(
                 cereal::base_class<bt::BaseNode>(this),
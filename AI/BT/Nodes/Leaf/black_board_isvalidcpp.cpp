@@ -1,5 +1,9 @@
 #include <AI/BT/Nodes/Leaf/black_board_isvalid.h>
 
+#include <AI/BT/bt_batch_interpreter.h>
+#include <AI/BT/bt_batch_kernels.h>
+#include <AI/BT/bt_runtime_asset.h>
+
 #include <iostream>
 
 CEREAL_REGISTER_TYPE(iga::bt::BBIsValid)
@@ -23,6 +27,28 @@ namespace iga {
 
         BaseNode* BBIsValid::Clone() const { return new BBIsValid(*this); }
 
+        bool BBIsValid::IsPure() const { return true; }
+
+        void BBIsValid::GetBlackBoardKeys(std::vector<BlackBoardKey>& a_keys) const {
+            BlackBoardKey key;
+            key.name    = this->variable_name_;
+            key.type    = this->type_;
+            key.write   = false;
+            a_keys.push_back(key);
+        }
+
+        void BBIsValid::WriteRuntimeData(BTRuntimeWriter& a_writer) const {
+            a_writer.WriteInt(static_cast<int>(this->type_));
+            a_writer.WriteString(this->variable_name_);
+        }
+
+        void BBIsValid::ReadRuntimeData(BTRuntimeReader& a_reader) {
+            int type = 0;
+            a_reader.ReadInt(type);
+            this->type_ = static_cast<BlackBoardTypes>(type);
+            a_reader.ReadString(this->variable_name_);
+        }
+
 #ifdef EDITOR
 
         void BBIsValid::OnEditorLoad() { 
@@ -40,18 +66,24 @@ namespace iga {
 
             // Variable Type
             ImGui::Text("Variable Type");
-            static const char* list_items[] = { "Int", "Float", "Bool", "String" };
+            static const char* list_items[] = { "Int", "Float", "Bool", "String", "Vector2", "Vector4", "Entity" };
             static int current_setting;
             if      (type_ == BlackBoardTypes::INT)     { current_setting = 0; }
             else if (type_ == BlackBoardTypes::FLOAT)   { current_setting = 1; }
             else if (type_ == BlackBoardTypes::BOOL)    { current_setting = 2; }
-            else if (type_ == BlackBoardTypes::STRING)  { current_setting = 2; }
-            if (ImGui::ListBox("##VariableType", &current_setting, list_items, IM_ARRAYSIZE(list_items), 4)) {
+            else if (type_ == BlackBoardTypes::STRING)  { current_setting = 3; }
+            else if (type_ == BlackBoardTypes::VECTOR2) { current_setting = 4; }
+            else if (type_ == BlackBoardTypes::VECTOR4) { current_setting = 5; }
+            else if (type_ == BlackBoardTypes::ENTITY)  { current_setting = 6; }
+            if (ImGui::ListBox("##VariableType", &current_setting, list_items, IM_ARRAYSIZE(list_items), 7)) {
                 switch (current_setting) {
                 case (0): { type_ = BlackBoardTypes::INT;    break; }
                 case (1): { type_ = BlackBoardTypes::FLOAT;  break; }
                 case (2): { type_ = BlackBoardTypes::BOOL;   break; }
                 case (3): { type_ = BlackBoardTypes::STRING; break; }
+                case (4): { type_ = BlackBoardTypes::VECTOR2; break; }
+                case (5): { type_ = BlackBoardTypes::VECTOR4; break; }
+                case (6): { type_ = BlackBoardTypes::ENTITY; break; }
                 }
             }
 
@@ -90,6 +122,22 @@ namespace iga {
                     is_valid = GetBehaviourTree()->GetBlackBoard()->GetStringMemory(variable_name_, temp);
                     break;
                 }
+                case (BlackBoardTypes::VECTOR2): {
+                    BlackBoardVector2 temp;
+                    is_valid = GetBehaviourTree()->GetBlackBoard()->GetVector2Memory(variable_name_, temp);
+                    break;
+                }
+                case (BlackBoardTypes::VECTOR4): {
+                    BlackBoardVector4 temp;
+                    is_valid = GetBehaviourTree()->GetBlackBoard()->GetVector4Memory(variable_name_, temp);
+                    break;
+                }
+                case (BlackBoardTypes::ENTITY): {
+                    // Handles are weak, the entity may be gone.
+                    BlackBoardEntity temp;
+                    is_valid = GetBehaviourTree()->GetBlackBoard()->GetEntityMemory(variable_name_, temp) && temp.IsValid();
+                    break;
+                }
             }
 
             if (is_valid) {
@@ -99,6 +147,28 @@ namespace iga {
             }
         }
 
+        bool BBIsValid::ExecuteBatch(BTBatchInterpreter& a_batch, const BTBatchMask& a_active, BTBatchResult& a_result) const {
+            std::uint32_t column = a_batch.FindColumn(this->variable_name_, this->type_);
+            if (column == BlackBoardStore::invalid_) { return false; }
+
+            const BlackBoardStore& store = a_batch.GetStore();
+            BTBatchMask& passed = a_result.Get(NodeResult::SUCCESS);
+            BTBatchKernels::NotZeroByte(store.GetValidColumn(a_batch.GetTable(), column), a_batch.GetRowCount(), passed.GetWords());
+
+            // Handles are weak, the entity may be gone.
+            if (this->type_ == BlackBoardTypes::ENTITY) {
+                const BlackBoardEntity* entities = store.GetEntityColumn(a_batch.GetTable(), column);
+                for (std::uint32_t row = 0; row < a_batch.GetRowCount(); ++row) {
+                    if (passed.Test(row) && !entities[row].IsValid()) { passed.Clear(row); }
+                }
+            }
+
+            passed.And(a_active);
+            a_result.Get(NodeResult::FAILED).Assign(a_active);
+            a_result.Get(NodeResult::FAILED).AndNot(passed);
+            return true;
+        }
+
     } // End of namespace ~ bt
 
 } // End of namespace ~ iga
\ No newline at end of file
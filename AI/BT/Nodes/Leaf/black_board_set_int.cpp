@@ -1,5 +1,8 @@
 #include <AI/BT/Nodes/Leaf/black_board_set_int.h>
 
+#include <AI/BT/bt_batch_interpreter.h>
+#include <AI/BT/bt_runtime_asset.h>
+
 #include <iostream>
 
 CEREAL_REGISTER_TYPE(iga::bt::BBSetInt)
@@ -20,6 +23,24 @@ namespace iga {
 
         BaseNode* BBSetInt::Clone() const { return new BBSetInt(*this); }
 
+        void BBSetInt::GetBlackBoardKeys(std::vector<BlackBoardKey>& a_keys) const {
+            BlackBoardKey key;
+            key.name    = this->variable_name_;
+            key.type    = BlackBoardTypes::INT;
+            key.write   = true;
+            a_keys.push_back(key);
+        }
+
+        void BBSetInt::WriteRuntimeData(BTRuntimeWriter& a_writer) const {
+            a_writer.WriteString(this->variable_name_);
+            a_writer.WriteInt(this->variable_value_);
+        }
+
+        void BBSetInt::ReadRuntimeData(BTRuntimeReader& a_reader) {
+            a_reader.ReadString(this->variable_name_);
+            a_reader.ReadInt(this->variable_value_);
+        }
+
         void BBSetInt::OnBehaviourTreeBuild() {
             //GetBehaviourTree()->GetBlackBoard()->SetGlobalIntMemory(variable_name_, variable_value_);
         }
@@ -57,6 +78,32 @@ namespace iga {
             return iga::bt::NodeResult::SUCCESS;
         }
 
+        bool BBSetInt::ExecuteBatch(BTBatchInterpreter& a_batch, const BTBatchMask& a_active, BTBatchResult& a_result) const {
+            BlackBoardStore& store = a_batch.GetStore();
+            std::uint32_t column = a_batch.FindColumn(this->variable_name_, BlackBoardTypes::INT);
+            if (column == BlackBoardStore::invalid_) { return false; }
+
+            int* values = store.GetIntColumn(a_batch.GetTable(), column);
+            std::uint8_t* valid = store.GetValidColumn(a_batch.GetTable(), column);
+
+            const std::uint64_t* words = a_active.GetWords();
+            for (std::uint32_t row = 0; row < a_active.GetRowCount(); ++row) {
+                if ((words[row >> 6] >> (row & 63)) & 1) {
+                    values[row] = this->variable_value_;
+                    valid[row] = 1;
+
+                    // Nodes that get executed per agent read the blackboard of the bound tree.
+                    BlackBoard* blackboard = a_batch.GetBoundBlackBoard(row);
+                    if (blackboard != nullptr) {
+                        blackboard->SetGlobalIntMemory(this->variable_name_, this->variable_value_);
+                    }
+                }
+            }
+
+            a_result.Get(NodeResult::SUCCESS).Assign(a_active);
+            return true;
+        }
+
     } // End of namespace ~ bt
 
 } // End of namespace ~ iga
\ No newline at end of file
@@ -63,9 +63,36 @@ namespace iga {
             */
             virtual BaseNode* Clone() const override;
 
+            /**
+            *   Overriden function that returns the blackboard value that the node writes.
+            *   @param std::vector<BlackBoardKey> a_keys The container that the keys get added to.
+            */
+            virtual void GetBlackBoardKeys(std::vector<BlackBoardKey>& a_keys) const override;
+
+            /**
+            *   Overriden function that writes the parameters of the node into a runtime asset.
+            *   @param BTRuntimeWriter a_writer The writer of the runtime asset.
+            */
+            virtual void WriteRuntimeData(BTRuntimeWriter& a_writer) const override;
+
+            /**
+            *   Overriden function that reads the parameters of the node from a runtime asset.
+            *   @param BTRuntimeReader a_reader The reader of the runtime asset.
+            */
+            virtual void ReadRuntimeData(BTRuntimeReader& a_reader) override;
+
             /** Virtual Function that gets called whenever the behaviour tree is getting build. */
             virtual void OnBehaviourTreeBuild() override;
 
+            /**
+            *   Overriden function that writes the value into the column of the key, for all agents.
+            *   @param BTBatchInterpreter a_batch The interpreter.
+            *   @param BTBatchMask a_active The agents that execute the node.
+            *   @param BTBatchResult a_result The container that the agents get stored in, by result.
+            *   @return bool - If True ~ The table has a column for the key.
+            */
+            virtual bool ExecuteBatch(BTBatchInterpreter& a_batch, const BTBatchMask& a_active, BTBatchResult& a_result) const override;
+
             /**
             *  Serializes this node.
             */
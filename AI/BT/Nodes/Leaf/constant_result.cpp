@@ -0,0 +1,77 @@
+#include <AI/BT/Nodes/Leaf/constant_result.h>
+
+#include <AI/BT/bt_runtime_asset.h>
+#include <AI/BT/bt_batch_interpreter.h>
+
+CEREAL_REGISTER_TYPE(iga::bt::ConstantResult)
+CEREAL_REGISTER_POLYMORPHIC_RELATION(iga::bt::LeafNode, iga::bt::ConstantResult)
+
+namespace iga {
+
+    /**
+    *  BT namespace
+    */
+    namespace bt {
+
+        ConstantResult::ConstantResult() {
+            result_ = NodeResult::SUCCESS;
+        }
+
+        ConstantResult::~ConstantResult() {/*EMPTY*/ }
+
+        std::shared_ptr<BaseNode> ConstantResult::CloneToShared() const { return std::make_shared<ConstantResult>(*this); };
+
+        BaseNode* ConstantResult::Clone() const { return new ConstantResult(*this); }
+
+        bool ConstantResult::IsPure() const { return true; }
+
+        void ConstantResult::WriteRuntimeData(BTRuntimeWriter& a_writer) const {
+            a_writer.WriteInt(static_cast<int>(this->result_));
+        }
+
+        void ConstantResult::ReadRuntimeData(BTRuntimeReader& a_reader) {
+            int result = 0;
+            a_reader.ReadInt(result);
+            this->result_ = static_cast<NodeResult>(result);
+        }
+
+        void ConstantResult::SetResult(NodeResult a_result) {
+            this->result_ = a_result;
+        }
+
+        NodeResult ConstantResult::GetResult() const {
+            return this->result_;
+        }
+
+#ifdef EDITOR
+
+        void ConstantResult::ConstructEditorNode(iga::bte::EditorNode* a_editor_node) {
+            a_editor_node->SetName(GET_VARIABLE_NAME(ConstantResult));
+            a_editor_node->SetType(iga::bte::NodeType::TREE);
+
+            a_editor_node->AddInputPin(iga::bte::PinType::FLOW);
+        }
+
+        void ConstantResult::InspectNode() {
+            ImGui::Text("Result");
+            static const char* list_items[] = { "Success", "Running", "Failed" };
+            int current_setting = static_cast<int>(result_);
+            if (ImGui::ListBox("##Result", &current_setting, list_items, IM_ARRAYSIZE(list_items), 3)) {
+                result_ = static_cast<NodeResult>(current_setting);
+            }
+        }
+
+#endif // EDITOR
+
+        iga::bt::NodeResult ConstantResult::OnUpdate() {
+            return this->result_;
+        }
+
+        bool ConstantResult::ExecuteBatch(BTBatchInterpreter& /*a_batch*/, const BTBatchMask& a_active, BTBatchResult& a_result) const {
+            a_result.Get(this->result_).Assign(a_active);
+            return true;
+        }
+
+    } // End of namespace ~ bt
+
+} // End of namespace ~ iga
@@ -0,0 +1,154 @@
+#pragma once
+
+#include <AI/BT/Nodes/leaf_node.h>
+
+/**
+* @file constant_result.h
+* @brief iga::bt::ConstantResult Header File
+*
+* @author Channing Eggers
+* @date 19 October 2026
+* @version $Revision 1.1
+*
+* ConstantResult class is derived from LeafNode.
+*
+* Always returns the same result, without doing anything.
+* The cooker replaces subtrees with a known result by this node.
+*
+*/
+
+/**
+*  igart namespace
+*/
+namespace iga {
+
+    /**
+    *  BT namespace
+    */
+    namespace bt {
+
+        class ConstantResult : public LeafNode {
+        public:
+
+            /**
+            *   Cereal versions of iga::bt::ConstantResult.
+            */
+            enum class Version {
+                DEFAULT = 0,    /**< Default normal version. */
+                LATEST          /**< Latest version. */
+            };
+
+            /**
+            *   Default Constructor
+            */
+            ConstantResult();
+
+            /**
+            *   Default Destructor
+            */
+            ~ConstantResult();
+
+            /**
+            *   Virtual Function that is used when polymorphically cloning this object when a shared_ptr needs to be returned.
+            *   @return std::shared_ptr<BaseNode> Pointer to the newly cloned object.
+            */
+            virtual std::shared_ptr<BaseNode> CloneToShared() const override;
+
+            /**
+            *   Virtual Function that is used when polymorphically cloning this object when a raw pointer needs to be returned.
+            *   @return BaseNode* Pointer to the newly cloned object.
+            */
+            virtual BaseNode* Clone() const override;
+
+            /**
+            *   Overriden function, the node has no side effects.
+            *   @return bool True.
+            */
+            virtual bool IsPure() const override;
+
+            /**
+            *   Overriden function that writes the parameters of the node into a runtime asset.
+            *   @param BTRuntimeWriter a_writer The writer of the runtime asset.
+            */
+            virtual void WriteRuntimeData(BTRuntimeWriter& a_writer) const override;
+
+            /**
+            *   Overriden function that reads the parameters of the node from a runtime asset.
+            *   @param BTRuntimeReader a_reader The reader of the runtime asset.
+            */
+            virtual void ReadRuntimeData(BTRuntimeReader& a_reader) override;
+
+            /**
+            *   Overriden function, all agents get the constant result.
+            *   @param BTBatchInterpreter a_batch The interpreter.
+            *   @param BTBatchMask a_active The agents that execute the node.
+            *   @param BTBatchResult a_result The container that the agents get stored in, by result.
+            *   @return bool True.
+            */
+            virtual bool ExecuteBatch(BTBatchInterpreter& a_batch, const BTBatchMask& a_active, BTBatchResult& a_result) const override;
+
+            /**
+            *   Sets the result that the node returns.
+            *   @param NodeResult a_result The result.
+            */
+            void SetResult(NodeResult a_result);
+
+            /**
+            *   Returns the result that the node returns.
+            *   @return NodeResult value.
+            */
+            NodeResult GetResult() const;
+
+            /**
+            *  Serializes this node.
+            */
+            template<class Archive>
+            void serialize(Archive &a_archive, uint32 const a_version);
+
+        private:
+
+#ifdef EDITOR
+
+            /**
+            *   Overriden function that creates and returns an editor node.
+            *   @param EditorNode a_editor_node A pointer to a newly constructed editor node.
+            */
+            void ConstructEditorNode(iga::bte::EditorNode* a_editor_node) override;
+
+            /**
+            *   Overriden function that inspects the node.
+            */
+            void InspectNode() override;
+
+#endif // EDITOR
+
+            /** OnUpdate function overriden from BaseNode class. Called when
+            *   this node gets updated.
+            *   @see BaseNode
+            *   @return NodeResult The constant result.
+            */
+            iga::bt::NodeResult OnUpdate();
+
+            NodeResult result_; /**< The result that the node returns. */
+
+        };
+
+        SUBSCRIBE_NODE(ConstantResult)
+
+    } // End of namespace ~ bt
+
+    template<class Archive>
+    inline void bt::ConstantResult::serialize(Archive& a_archive, uint32 const a_version) {
+        switch (static_cast<Version>(a_version)) {
+        case Version::LATEST:
+        case Version::DEFAULT:
+            a_archive(  cereal::base_class<bt::BaseNode>(this),
+                        cereal::make_nvp("Result", result_)
+            );
+            break;
+        }
+    }
+
+} // End of namespace ~ iga
+
+CEREAL_CLASS_VERSION(iga::bt::ConstantResult, (static_cast<iga::uint32>(iga::bt::ConstantResult::Version::LATEST) - 1))
@@ -1,5 +1,7 @@
 #include <AI/BT/Nodes/Leaf/debug_message.h>
 
+#include <AI/BT/bt_runtime_asset.h>
+
 #include <iostream>
 
 CEREAL_REGISTER_TYPE(iga::bt::DebugMessage)
@@ -20,6 +22,14 @@ namespace iga {
 
         BaseNode* DebugMessage::Clone() const { return new DebugMessage(*this); }
 
+        void DebugMessage::WriteRuntimeData(BTRuntimeWriter& a_writer) const {
+            a_writer.WriteString(this->debug_message_);
+        }
+
+        void DebugMessage::ReadRuntimeData(BTRuntimeReader& a_reader) {
+            a_reader.ReadString(this->debug_message_);
+        }
+
 #ifdef EDITOR
 
         void DebugMessage::OnEditorLoad() {
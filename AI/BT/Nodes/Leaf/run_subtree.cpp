@@ -0,0 +1,79 @@
+#include <AI/BT/Nodes/Leaf/run_subtree.h>
+
+#include <AI/BT/bt_runtime_asset.h>
+
+CEREAL_REGISTER_TYPE(iga::bt::RunSubtree)
+CEREAL_REGISTER_POLYMORPHIC_RELATION(iga::bt::LeafNode, iga::bt::RunSubtree)
+
+namespace iga {
+
+    /**
+    *  BT namespace
+    */
+    namespace bt {
+
+        RunSubtree::RunSubtree() { /*EMPTY*/ }
+
+        RunSubtree::~RunSubtree() {/*EMPTY*/ }
+
+        std::shared_ptr<BaseNode> RunSubtree::CloneToShared() const { return std::make_shared<RunSubtree>(*this); };
+
+        BaseNode* RunSubtree::Clone() const { return new RunSubtree(*this); }
+
+        void RunSubtree::WriteRuntimeData(BTRuntimeWriter& a_writer) const {
+            a_writer.WriteString(this->subtree_path_);
+        }
+
+        void RunSubtree::ReadRuntimeData(BTRuntimeReader& a_reader) {
+            a_reader.ReadString(this->subtree_path_);
+        }
+
+        void RunSubtree::RemapNodes(const NodeRemap& a_remap) {
+            this->subtree_root_ = a_remap(this->subtree_root_);
+        }
+
+        const std::string& RunSubtree::GetSubtreePath() const {
+            return this->subtree_path_;
+        }
+
+        void RunSubtree::SetSubtree(BaseNode* a_subtree_root, std::shared_ptr<const BTRuntimeAsset> a_subtree_asset) {
+            this->subtree_root_ = a_subtree_root;
+            this->subtree_asset_ = std::move(a_subtree_asset);
+        }
+
+        BaseNode* RunSubtree::GetSubtreeRoot() const {
+            return this->subtree_root_;
+        }
+
+#ifdef EDITOR
+
+        void RunSubtree::OnEditorLoad() {
+            // Copy over serialized string.
+            strcpy_s(this->subtree_path_buffer_, this->subtree_path_.c_str());
+        }
+
+        void RunSubtree::ConstructEditorNode(iga::bte::EditorNode* a_editor_node) {
+            a_editor_node->SetName(GET_VARIABLE_NAME(RunSubtree));
+            a_editor_node->SetType(iga::bte::NodeType::TREE);
+
+            a_editor_node->AddInputPin(iga::bte::PinType::FLOW);
+        }
+
+        void RunSubtree::InspectNode() {
+            if (ImGui::InputText("Subtree:", subtree_path_buffer_, IM_ARRAYSIZE(subtree_path_buffer_))) {
+                this->subtree_path_ = subtree_path_buffer_;
+            }
+        }
+
+#endif // EDITOR
+
+        iga::bt::NodeResult RunSubtree::OnUpdate() {
+            if (this->subtree_root_ == nullptr) {
+                return iga::bt::NodeResult::FAILED;
+            }
+            return this->subtree_root_->ExecuteNode();
+        }
+
+    } // End of namespace ~ bt
+
+} // End of namespace ~ iga
@@ -0,0 +1,170 @@
+#pragma once
+
+#include <AI/BT/Nodes/leaf_node.h>
+
+#include <memory>
+
+/**
+* @file run_subtree.h
+* @brief iga::bt::RunSubtree Header File
+*
+* @author Channing Eggers
+* @date 19 October 2026
+* @version $Revision 1.1
+*
+* RunSubtree class is derived from LeafNode.
+*
+* References another BT File by path and executes it as its subtree. The subtree gets
+* resolved by iga::bt::BTBuilder when the behaviour tree gets built, references that
+* form a cycle fail the build. The runtime asset of the subtree is loaded once by
+* iga::bt::BTAssetLibrary and shared by every behaviour tree that includes it.
+*
+* Returns the result of its subtree. Returns FAILED if the subtree wasn't resolved.
+*
+*/
+
+/**
+*  igart namespace
+*/
+namespace iga {
+
+    /**
+    *  BT namespace
+    */
+    namespace bt {
+
+        class BTRuntimeAsset;
+
+        class RunSubtree : public LeafNode {
+        public:
+
+            /**
+            *   Cereal versions of iga::bt::RunSubtree.
+            */
+            enum class Version {
+                DEFAULT = 0,    /**< Default normal version. */
+                LATEST          /**< Latest version. */
+            };
+
+            /**
+            *   Default Constructor
+            */
+            RunSubtree();
+
+            /**
+            *   Default Destructor
+            */
+            ~RunSubtree();
+
+            /**
+            *   Virtual Function that is used when polymorphically cloning this object when a shared_ptr needs to be returned.
+            *   @return std::shared_ptr<BaseNode> Pointer to the newly cloned object.
+            */
+            virtual std::shared_ptr<BaseNode> CloneToShared() const override;
+
+            /**
+            *   Virtual Function that is used when polymorphically cloning this object when a raw pointer needs to be returned.
+            *   @return BaseNode* Pointer to the newly cloned object.
+            */
+            virtual BaseNode* Clone() const override;
+
+            /**
+            *   Overriden function that writes the parameters of the node into a runtime asset.
+            *   @param BTRuntimeWriter a_writer The writer of the runtime asset.
+            */
+            virtual void WriteRuntimeData(BTRuntimeWriter& a_writer) const override;
+
+            /**
+            *   Overriden function that reads the parameters of the node from a runtime asset.
+            *   @param BTRuntimeReader a_reader The reader of the runtime asset.
+            */
+            virtual void ReadRuntimeData(BTRuntimeReader& a_reader) override;
+
+            /**
+            *   Overriden function that points the subtree to the copy of the subtree.
+            *   @param NodeRemap a_remap Maps prototype nodes to copied nodes.
+            */
+            virtual void RemapNodes(const NodeRemap& a_remap) override;
+
+            /**
+            *   Returns the file path of the referenced BT File.
+            *   @return std::string reference.
+            */
+            const std::string& GetSubtreePath() const;
+
+            /**
+            *   Sets the resolved subtree. Gets called by iga::bt::BTBuilder.
+            *   @param BaseNode a_subtree_root Pointer to the root of the subtree. Owned by the behaviour tree.
+            *   @param std::shared_ptr<const BTRuntimeAsset> a_subtree_asset The runtime asset that the subtree was built from.
+            */
+            void SetSubtree(BaseNode* a_subtree_root, std::shared_ptr<const BTRuntimeAsset> a_subtree_asset);
+
+            /**
+            *   Returns the root of the resolved subtree.
+            *   @return BaseNode pointer, nullptr if the subtree wasn't resolved.
+            */
+            BaseNode* GetSubtreeRoot() const;
+
+            /**
+            *  Serializes this node.
+            */
+            template<class Archive>
+            void serialize(Archive &a_archive, uint32 const a_version);
+
+        private:
+
+#ifdef EDITOR
+
+            /**
+            *   Virtual function that gets called whenever a base node gets loaded by the editor.
+            *   (Gets called after the constructor and the loading of serialized data.)
+            */
+            void OnEditorLoad() override;
+
+            /**
+            *   Overriden function that creates and returns an editor node.
+            *   @param EditorNode a_editor_node A pointer to a newly constructed editor node.
+            */
+            void ConstructEditorNode(iga::bte::EditorNode* a_editor_node) override;
+
+            /**
+            *   Overriden function that inspects the node.
+            */
+            void InspectNode() override;
+
+#endif // EDITOR
+
+            /** OnUpdate function overriden from BaseNode class. Called when
+            *   this node gets updated.
+            *   @see BaseNode
+            *   @return NodeResult The result of the subtree.
+            */
+            iga::bt::NodeResult OnUpdate();
+
+            std::string subtree_path_;                              /**< File path of the referenced BT File. */
+            char subtree_path_buffer_[256] = "";                    /**< Editor only variable. A char buffer for the subtree path text box. */
+
+            BaseNode* subtree_root_ = nullptr;                      /**< Root of the resolved subtree. Owned by the behaviour tree. */
+            std::shared_ptr<const BTRuntimeAsset> subtree_asset_;   /**< Runtime asset of the subtree, kept loaded while the subtree exists. */
+
+        };
+
+        SUBSCRIBE_NODE(RunSubtree)
+
+    } // End of namespace ~ bt
+
+    template<class Archive>
+    inline void bt::RunSubtree::serialize(Archive& a_archive, uint32 const a_version) {
+        switch (static_cast<Version>(a_version)) {
+        case Version::LATEST:
+        case Version::DEFAULT:
+            a_archive(  cereal::base_class<bt::BaseNode>(this),
+                        cereal::make_nvp("SubtreePath", subtree_path_)
+            );
+            break;
+        }
+    }
+
+} // End of namespace ~ iga
+
+CEREAL_CLASS_VERSION(iga::bt::RunSubtree, (static_cast<iga::uint32>(iga::bt::RunSubtree::Version::LATEST) - 1))
@@ -1,9 +1,12 @@
-#include <AI\BT\Nodes/base_node.h>
+#include <AI/BT/Nodes/base_node.h>
 
-#include <AI\BT\bt_debugger.h>
-#include <AI\BT\bt_defines.h>
-#include <AI\BT\behaviour_tree.h>
-#include <AI\BT\Nodes/node_enums.h>
+#include <AI/BT/bt_debugger.h>
+#include <AI/BT/bt_defines.h>
+#include <AI/BT/behaviour_tree.h>
+#include <AI/BT/bt_coverage.h>
+#include <AI/BT/Nodes/node_enums.h>
+
+#include <atomic>
 
 CEREAL_REGISTER_TYPE(iga::bt::BaseNode)
 
@@ -11,10 +14,24 @@ namespace iga {
     
     namespace bt {
 
+        namespace {
+            std::atomic<unsigned int> node_id_counter_(0); /** Keeps track of the IDs that have been given out. */
+        }
+
         BaseNode::BaseNode() {
             this->node_id_ = GetNextID();
         }
 
+        BaseNode::BaseNode(const BaseNode& a_other) :
+            node_type_(a_other.node_type_),
+            node_type_name_(a_other.node_type_name_),
+            node_id_(GetNextID()),
+            node_index_(a_other.node_index_),
+            editor_node_id_(a_other.editor_node_id_),
+            behaviour_tree_(a_other.behaviour_tree_),
+            in_node_block_(a_other.in_node_block_)
+        { /* EMPTY */ }
+
         BaseNode::~BaseNode() { /* EMPTY */ }
 
         std::shared_ptr<BaseNode> BaseNode::CloneToShared() const { return nullptr; }
@@ -23,6 +40,32 @@ namespace iga {
 
         void BaseNode::OnBehaviourTreeBuild() { /*DO NOTHING*/ }
 
+        void BaseNode::WriteRuntimeData(BTRuntimeWriter& /*a_writer*/) const { /*DO NOTHING*/ }
+
+        void BaseNode::ReadRuntimeData(BTRuntimeReader& /*a_reader*/) { /*DO NOTHING*/ }
+
+        void BaseNode::TransferRuntimeState(const BaseNode& /*a_previous_node*/) { /*DO NOTHING*/ }
+
+        void BaseNode::ResetRuntimeState() { /*DO NOTHING*/ }
+
+        void BaseNode::GetBlackBoardKeys(std::vector<BlackBoardKey>& /*a_keys*/) const { /*DO NOTHING*/ }
+
+        bool BaseNode::IsPure() const { return false; }
+
+        void BaseNode::RemapNodes(const NodeRemap& /*a_remap*/) { /*DO NOTHING*/ }
+
+        bool BaseNode::ExecuteBatch(BTBatchInterpreter& /*a_batch*/, const BTBatchMask& /*a_active*/, BTBatchResult& /*a_result*/) const { return false; }
+
+        void BaseNode::DestroyNode(BaseNode* a_node) {
+            if (a_node == nullptr) { return; }
+
+            if (a_node->in_node_block_) {
+                a_node->~BaseNode();
+            } else {
+                delete a_node;
+            }
+        }
+
         NodeResult BaseNode::ExecuteNode() {
 
             if (this->behaviour_tree_ == nullptr) {
@@ -35,8 +78,6 @@ namespace iga {
             NodeResult result = this->OnUpdate();
 
             this->OnExit();
-
-            return result;
 #else
             this->behaviour_tree_->GetDebugger()->OnNodeEntry(this);
             this->OnEntry();
@@ -46,9 +87,15 @@ namespace iga {
 
             this->behaviour_tree_->GetDebugger()->OnNodeExit(this);
             this->OnExit();
+#endif // BT_DEBUG
+
+            this->behaviour_tree_->CountNodeVisit(result == NodeResult::RUNNING);
+
+#ifdef BT_COVERAGE
+            this->behaviour_tree_->GetCoverage()->RecordNode(this->editor_node_id_, result);
+#endif // BT_COVERAGE
 
             return result;
-#endif // BT_DEBUG
 
         }
 
@@ -70,6 +117,14 @@ namespace iga {
             return this->node_id_;
         }
 
+        std::uint32_t BaseNode::GetNodeIndex() const {
+            return this->node_index_;
+        }
+
+        int BaseNode::GetEditorNodeID() const {
+            return this->editor_node_id_;
+        }
+
         NodeType BaseNode::GetNodeType() const {
             return this->node_type_;
         }
@@ -87,7 +142,7 @@ namespace iga {
         }
 
         unsigned int BaseNode::GetNextID() {
-            return ++node_id_counter_;
+            return node_id_counter_.fetch_add(1, std::memory_order_relaxed) + 1;
         }
 
     } // End of namespace ~ bt
@@ -3,10 +3,9 @@
 #include <AI/BT/behaviour_tree.h>
 #include <AI/BT/Nodes/node_enums.h> 
 
-#include <Editor/BTEditor/bt_editor_node_library.h>
+#include <AI/BT/bt_node_library.h>
 
-#include <defines.h>
-#include <iga_util.h>
+#include <AI/BT/bt_platform.h>
 
 #include <cereal/cereal.hpp>
 #include <cereal/types/memory.hpp>
@@ -22,10 +21,14 @@
 #include <Editor/BTEditor/bt_editor_enums.h>
 #endif // EDITOR
 
+#include <cstddef>
+#include <cstdint>
 #include <string>
 #include <map>
 #include <string>
+#include <unordered_map>
 #include <utility>
+#include <vector>
 
 /**
 * @file base_node.h
@@ -58,15 +61,55 @@ namespace iga {
     */
     namespace bt {
 
-        static unsigned int node_id_counter_ = 0; /** Static integer that keeps track of the IDs that have been given out. */
-
         class BehaviourTree;
         class BTDebugger;
         class BTBuilder;
+        class BTRuntimeWriter;
+        class BTRuntimeReader;
+        class BTBatchInterpreter;
+        class BTBatchMask;
+        struct BTBatchResult;
+        struct BlackBoardKey;
 
         enum class NodeResult;
         enum class NodeType;
 
+        class BaseNode;
+
+        /**
+        *   iga::bt::NodeRemap; Maps the nodes of a prototype tree to the nodes of a copy of the tree.
+        *   Used by iga::bt::BTBuilder::BuildTrees to relocate the node pointers of copied nodes.
+        */
+        class NodeRemap final {
+        public:
+
+            /**
+            *   NodeRemap Constructor
+            *   @param std::unordered_map<const BaseNode*, std::size_t> a_indices Index of every prototype node.
+            *   @param BaseNode* a_nodes The copied nodes, by index of their prototype node.
+            */
+            NodeRemap(const std::unordered_map<const BaseNode*, std::size_t>& a_indices, BaseNode* const* a_nodes) :
+                indices_(a_indices),
+                nodes_(a_nodes)
+            { /*EMPTY*/ }
+
+            /**
+            *   Returns the copy of a prototype node.
+            *   @param BaseNode a_node Pointer to the prototype node.
+            *   @return BaseNode pointer to the copy, nullptr if a_node is nullptr or not part of the prototype.
+            */
+            BaseNode* operator()(const BaseNode* a_node) const {
+                std::unordered_map<const BaseNode*, std::size_t>::const_iterator it = this->indices_.find(a_node);
+                return (it == this->indices_.end()) ? nullptr : this->nodes_[it->second];
+            }
+
+        private:
+
+            const std::unordered_map<const BaseNode*, std::size_t>& indices_;   /**< Index of every prototype node. */
+            BaseNode* const* nodes_;                                            /**< The copied nodes. */
+
+        };
+
         class BaseNode {
         public:
             friend class BTBuilder;
@@ -82,6 +125,12 @@ namespace iga {
             /** BaseNode Constructor */
             BaseNode();
 
+            /**
+            *   BaseNode Copy Constructor. The copy gets a new ID.
+            *   @param BaseNode a_other The copied node.
+            */
+            BaseNode(const BaseNode& a_other);
+
             /** BaseNode Virtual Destructor */
             virtual ~BaseNode();
 
@@ -100,6 +149,73 @@ namespace iga {
             /** Virtual Function that gets called whenever the behaviour tree is getting build. */
             virtual void OnBehaviourTreeBuild();
 
+            /**
+            *   Virtual function that writes the parameters of the node into a runtime asset (.btr).
+            *   Nodes with parameters should override it, together with ReadRuntimeData.
+            *   @param BTRuntimeWriter a_writer The writer of the runtime asset.
+            */
+            virtual void WriteRuntimeData(BTRuntimeWriter& a_writer) const;
+
+            /**
+            *   Virtual function that reads the parameters of the node from a runtime asset (.btr).
+            *   Values have to be read in the same order as they were written by WriteRuntimeData.
+            *   @param BTRuntimeReader a_reader The reader of the runtime asset.
+            */
+            virtual void ReadRuntimeData(BTRuntimeReader& a_reader);
+
+            /**
+            *   Virtual function that takes over the runtime state of a node that this node replaces,
+            *   when a live behaviour tree gets hot reloaded. Only gets called when both nodes were built
+            *   from the same editor node and are of the same type. Nodes with runtime state should override it.
+            *   @param BaseNode a_previous_node The replaced node. Same type as this node.
+            */
+            virtual void TransferRuntimeState(const BaseNode& a_previous_node);
+
+            /**
+            *   Virtual function that resets the runtime state of the node, as if the behaviour tree was just built.
+            *   Gets called when a behaviour tree gets recycled, see iga::bt::BTTreePool. Nodes with runtime state should override it.
+            */
+            virtual void ResetRuntimeState();
+
+            /**
+            *   Virtual function that returns the blackboard values that the node reads and writes.
+            *   Used to validate a behaviour tree when it gets cooked. Nodes that use the blackboard should override it.
+            *   @param std::vector<BlackBoardKey> a_keys The container that the keys get added to.
+            */
+            virtual void GetBlackBoardKeys(std::vector<BlackBoardKey>& a_keys) const;
+
+            /**
+            *   Virtual function that returns True if executing the node has no side effects, apart from
+            *   executing its children. Subtrees of pure nodes whose result is unused get removed when cooking.
+            *   @return bool value. False by default.
+            */
+            virtual bool IsPure() const;
+
+            /**
+            *   Virtual function that points the node pointers of a copied node to the copies of the nodes.
+            *   Nodes that store pointers to other nodes should override it.
+            *   @param NodeRemap a_remap Maps prototype nodes to copied nodes.
+            */
+            virtual void RemapNodes(const NodeRemap& a_remap);
+
+            /**
+            *   Virtual function that executes the node for many agents at once, see iga::bt::BTBatchInterpreter.
+            *   Every agent of a_active has to be added to exactly one mask of a_result. The node is part of the tree
+            *   template and shared by all agents; per agent state belongs in the columns of the store.
+            *   @param BTBatchInterpreter a_batch The interpreter, executes the children and gives access to the store.
+            *   @param BTBatchMask a_active The agents that execute the node.
+            *   @param BTBatchResult a_result The container that the agents get stored in, by result. Cleared.
+            *   @return bool - If True ~ The node has been executed. False by default, the node then gets executed per agent.
+            */
+            virtual bool ExecuteBatch(BTBatchInterpreter& a_batch, const BTBatchMask& a_active, BTBatchResult& a_result) const;
+
+            /**
+            *   Destroys a node that is tracked by a behaviour tree. Nodes that were built into a node block
+            *   get destroyed in place, the block gets freed by the behaviour trees that share it.
+            *   @param BaseNode a_node Pointer to the node.
+            */
+            static void DestroyNode(BaseNode* a_node);
+
             /**
             *   Executes the node and runs its functionality.
             *   @param a_bt is a pointer to the BehaviourTree.
@@ -107,11 +223,26 @@ namespace iga {
             NodeResult ExecuteNode();
 
             /**
-            *   Returns the ID of the node.
+            *   Returns the ID of the node. The ID is unique between all nodes of the process, including copies.
             *   @return int value.
             */
             int GetID() const;
 
+            /**
+            *   Returns the index of the node in its behaviour tree. Indices are assigned by iga::bt::BTBuilder,
+            *   start at 0 and are contiguous, see iga::bt::BehaviourTree::GetNodeCount. Use it to keep
+            *   per node data of a behaviour tree in flat arrays.
+            *   @return std::uint32_t value. 0 if the node wasn't built by iga::bt::BTBuilder.
+            */
+            std::uint32_t GetNodeIndex() const;
+
+            /**
+            *   Returns the ID of the editor node that this node was built from.
+            *   The ID is stable between sessions, unlike the ID of the node.
+            *   @return int value. -1 if the node wasn't built from a BT File.
+            */
+            int GetEditorNodeID() const;
+
             /**
             *   Returns the type of the node.
             *   @return NodeType enum value.
@@ -181,14 +312,20 @@ namespace iga {
             virtual void OnExit() { /* Empty */ }
 
             /**
-            *   Returns a new unsigned integer value.
+            *   Returns a new unsigned integer value. Thread-safe.
             *   @return unsigned int.
             */
-            unsigned int GetNextID();
+            static unsigned int GetNextID();
 
             unsigned int node_id_ = 0; /** The ID of the node. */
 
-            BehaviourTree* behaviour_tree_; /** Pointer to the behaviour tree. */
+            std::uint32_t node_index_ = 0; /** Index of the node in its behaviour tree. */
+
+            int editor_node_id_ = -1; /** The ID of the editor node that this node was built from. */
+
+            BehaviourTree* behaviour_tree_ = nullptr; /** Pointer to the behaviour tree. */
+
+            bool in_node_block_ = false; /** True if the node was built into a node block, see iga::bt::BTBuilder::BuildTrees. */
 
         };
 
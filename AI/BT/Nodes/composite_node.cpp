@@ -1,4 +1,4 @@
-#include <AI\BT\Nodes/composite_node.h>
+#include <AI/BT/Nodes/composite_node.h>
 
 CEREAL_REGISTER_TYPE(iga::bt::CompositeNode)
 CEREAL_REGISTER_POLYMORPHIC_RELATION(iga::bt::BaseNode, iga::bt::CompositeNode)
@@ -24,6 +24,16 @@ namespace iga {
             return this->children_;
         }
 
+        void CompositeNode::RemapNodes(const NodeRemap& a_remap) {
+            for (auto& child : this->children_) {
+                child = a_remap(child);
+            }
+        }
+
+        bool CompositeNode::GetContinueResult(NodeResult& /*a_result*/) const {
+            return false;
+        }
+
     } // End of namespace ~ bt;
 
 } // End of namespcae ~ iga
@@ -1,8 +1,8 @@
 #pragma once
 
-#include <AI\BT\Nodes\base_node.h>
+#include <AI/BT/Nodes/base_node.h>
 
-#include <AI\BT\Nodes/node_enums.h>
+#include <AI/BT/Nodes/node_enums.h>
 
 #include <vector>
 
@@ -53,6 +53,21 @@ namespace iga {
             /** Returns a copy of the BaseNode* vector of this composite node. */
             std::vector<BaseNode*> GetChildren() const;
 
+            /**
+            *   Virtual function for composites that execute their children in order, continue while a child
+            *   returns a specific result, return any other result directly and return the continue result once
+            *   all children have been executed. Such composites get optimized when cooking.
+            *   @param NodeResult a_result The container that the continue result gets stored in.
+            *   @return bool - If True ~ The composite behaves like this. False by default.
+            */
+            virtual bool GetContinueResult(NodeResult& a_result) const;
+
+            /**
+            *   Overriden function that points the children to the copies of the children.
+            *   @param NodeRemap a_remap Maps prototype nodes to copied nodes.
+            */
+            virtual void RemapNodes(const NodeRemap& a_remap) override;
+
         private:
 
             std::vector<BaseNode*> children_;   /** Vector of BaseNode pointers which are the children of this node. */
@@ -1,4 +1,4 @@
-#include <AI\BT\Nodes/decorator_node.h>
+#include <AI/BT/Nodes/decorator_node.h>
 
 CEREAL_REGISTER_TYPE(iga::bt::DecoratorNode)
 CEREAL_REGISTER_POLYMORPHIC_RELATION(iga::bt::BaseNode, iga::bt::DecoratorNode)
@@ -21,6 +21,10 @@ namespace iga {
             return this->child_;
         }
 
+        void DecoratorNode::RemapNodes(const NodeRemap& a_remap) {
+            this->child_ = a_remap(this->child_);
+        }
+
     } // End of namespace ~ bt;
 
 } // End of namespcae ~ iga
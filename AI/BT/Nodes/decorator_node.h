@@ -1,8 +1,8 @@
 #pragma once
 
-#include <AI\BT\Nodes\base_node.h>
+#include <AI/BT/Nodes/base_node.h>
 
-#include <AI\BT\Nodes/node_enums.h>
+#include <AI/BT/Nodes/node_enums.h>
 
 #ifdef EDITOR
 #include <Editor/BTEditor/bt_editor_structs.h>
@@ -51,6 +51,12 @@ namespace iga {
             /** Returns the child of this node which is a pointer to a BaseNode. */
             BaseNode* GetChild() const;
 
+            /**
+            *   Overriden function that points the child to the copy of the child.
+            *   @param NodeRemap a_remap Maps prototype nodes to copied nodes.
+            */
+            virtual void RemapNodes(const NodeRemap& a_remap) override;
+
         private:
 
             BaseNode* child_; /** BaseNode pointer to the child of this node. */
@@ -1,4 +1,4 @@
-#include <AI\BT\Nodes/leaf_node.h>
+#include <AI/BT/Nodes/leaf_node.h>
 
 CEREAL_REGISTER_TYPE(iga::bt::LeafNode)
 CEREAL_REGISTER_POLYMORPHIC_RELATION(iga::bt::BaseNode, iga::bt::LeafNode)
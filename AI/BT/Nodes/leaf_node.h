@@ -1,8 +1,8 @@
 #pragma once
 
-#include <AI\BT\Nodes\base_node.h>
+#include <AI/BT/Nodes/base_node.h>
 
-#include <AI\BT\Nodes/node_enums.h>
+#include <AI/BT/Nodes/node_enums.h>
 
 #ifdef EDITOR
 #include <Editor/BTEditor/bt_editor_structs.h>
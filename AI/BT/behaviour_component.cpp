@@ -1,9 +1,15 @@
-#include <AI\BT\behaviour_component.h>
+#include <AI/BT/behaviour_component.h>
 
 #include <ig_art_engine.h>
 
-#include <AI\BT\behaviour_tree.h>
+#include <AI/BT/behaviour_tree.h>
 #include <AI/BT/bt_builder.h>
+#include <AI/BT/bt_asset_library.h>
+#include <AI/BT/bt_entity_agent.h>
+#include <AI/BT/bt_tree_pool.h>
+
+#include <chrono>
+#include <iostream>
 
 #ifdef EDITOR
 #include <imgui/include/imgui.h>
@@ -37,9 +43,7 @@ namespace iga {
             }
 
             BehaviourComponent::~BehaviourComponent() {
-                if (behaviour_tree_ != nullptr) {
-                    delete this->behaviour_tree_;
-                }
+                ClearBehaviourTree();
             }
 
             void BehaviourComponent::OnCreate(bool /*a_on_load*/) {
@@ -48,8 +52,13 @@ namespace iga {
 
             void BehaviourComponent::Update() {
                 if (GetGame()->IsPlaying()) {
-                    if (this->behaviour_tree_ == nullptr && this->bt_file_path_ != "") {
-                        BuildBehaviourTree(false);
+                    if (this->behaviour_tree_ == nullptr && this->bt_file_path_ != "" && !IsTreeLoading() && !this->build_failed_) {
+                        BuildBehaviourTreeAsync(false);
+                    }
+
+                    // Publish the tree once its asset has been loaded.
+                    if (IsTreeLoading()) {
+                        FinishBuildBehaviourTree();
                     }
 
                     if (this->execute_behaviour_ && behaviour_tree_ != nullptr) {
@@ -67,7 +76,7 @@ namespace iga {
                 // Get path from windows explorer
                 if (ImGui::Button("Clear")) {
                     bt_file_path_ = "";
-                    if (this->behaviour_tree_ != nullptr) { delete this->behaviour_tree_; }
+                    ClearBehaviourTree();
                 }
 
                 ImGui::SameLine();
@@ -81,6 +90,8 @@ namespace iga {
                         DEBUGASSERT(false); 
                     }
 
+                    this->build_failed_ = false;
+
                     if (bt_file_path_ != "") {
                         // Make full path a relative one.
                         std::string wd;
@@ -106,13 +117,63 @@ namespace iga {
 #endif
             }
 
-            void BehaviourComponent::BuildBehaviourTree(bool a_overwrite_bt) {
+            void BehaviourComponent::BuildBehaviourTreeAsync(bool a_overwrite_bt) {
+                if (this->bt_file_path_ == "") { return; }
+
+                this->pending_asset_ = BTAssetLibrary::Get().LoadAsync(this->bt_file_path_);
+                this->pending_overwrite_ = a_overwrite_bt;
+                this->build_failed_ = false;
+            }
+
+            bool BehaviourComponent::IsTreeLoading() const {
+                return this->pending_asset_.valid();
+            }
+
+            void BehaviourComponent::FinishBuildBehaviourTree() {
+                if (this->pending_asset_.wait_for(std::chrono::seconds(0)) != std::future_status::ready) { return; }
+
+                std::shared_ptr<const BTRuntimeAsset> asset = this->pending_asset_.get();
+                this->pending_asset_ = std::shared_future<std::shared_ptr<const BTRuntimeAsset>>();
+
+                if (asset == nullptr) {
+                    std::cout << "ERROR - Behaviour Tree System - Failed to load BT File: " << this->bt_file_path_ << std::endl;
+                    this->build_failed_ = true;
+                    return;
+                }
+
+                // A tree that got built in the meantime is only replaced when asked for.
+                if (this->behaviour_tree_ != nullptr && !this->pending_overwrite_) { return; }
+
+                BuildFromAsset(asset);
+            }
+
+            void BehaviourComponent::BuildFromAsset(const std::shared_ptr<const BTRuntimeAsset>& a_asset) {
+                if (this->agent_ == nullptr) {
+                    this->agent_ = std::make_shared<BTEntityAgent>(this->GetOwner());
+                }
+
+                // Take a recycled tree of an entity that got destroyed, if there is one.
+                BehaviourTree* pooled_tree = BTTreePool::Get().Acquire(a_asset, this->bt_file_path_, this->agent_);
+
+                BTTreePool::Get().Release(this->behaviour_tree_);
+                this->behaviour_tree_ = pooled_tree;
+                if (pooled_tree != nullptr) { return; }
+
                 BTBuilder builder;
-#ifdef DEBUG
-                DEBUGASSERT(builder.BuildTree(bt_file_path_, this->behaviour_tree_, this->GetOwner(), a_overwrite_bt));
-#else
-                builder.BuildTree(bt_file_path_, this->behaviour_tree_, this->GetOwner(), a_overwrite_bt);
-#endif
+                if (!builder.BuildTree(a_asset, this->bt_file_path_, this->behaviour_tree_, this->agent_, false)) {
+                    this->build_failed_ = true;
+                }
+            }
+
+            void BehaviourComponent::ClearBehaviourTree() {
+                // The asset library keeps loading the asset; the result just gets dropped.
+                this->pending_asset_ = std::shared_future<std::shared_ptr<const BTRuntimeAsset>>();
+
+                // The tree gets recycled by the next entity that uses the same BT File.
+                if (this->behaviour_tree_ != nullptr) {
+                    BTTreePool::Get().Release(this->behaviour_tree_);
+                    this->behaviour_tree_ = nullptr;
+                }
             }
 
             void BehaviourComponent::RunTree() {
@@ -7,6 +7,7 @@
 #include <cereal/types/memory.hpp>
 #include <cereal/types/vector.hpp>
 
+#include <future>
 #include <memory>
 
 /**
@@ -20,6 +21,13 @@
 *   Behaviour Component inherits from Component.
 *   This component will give the entity behaviour.
 *
+*   The behaviour tree gets built lazily during play. Its asset is loaded on the worker thread of
+*   iga::bt::BTAssetLibrary, the tree itself gets built on the game thread once the asset is ready.
+*   While the tree is loading the entity has no behaviour; an existing tree keeps executing until
+*   the new tree replaces it.
+*
+*   When the component gets destroyed, its behaviour tree gets recycled through iga::bt::BTTreePool.
+*
 */
 
 /**
@@ -35,6 +43,8 @@ namespace iga {
     namespace bt {
 
         class BehaviourTree;
+        class BTEntityAgent;
+        class BTRuntimeAsset;
 
         class BehaviourComponent : public iga::Component {
         public:
@@ -89,6 +99,19 @@ namespace iga {
             */
             void StopTree();
 
+            /**
+            *   Starts building the behaviour tree without blocking. The asset gets loaded on a worker thread,
+            *   the tree gets published during an Update once the asset is ready.
+            *   @param bool a_overwrite_bt If True ~ the new tree replaces an existing behaviour tree.
+            */
+            void BuildBehaviourTreeAsync(bool a_overwrite_bt);
+
+            /**
+            *   Returns True while the asset of the behaviour tree is loading.
+            *   @return bool value.
+            */
+            bool IsTreeLoading() const;
+
             BehaviourTree* behaviour_tree_ = nullptr; /**< The Behaviour Tree of the component */
 
             /**
@@ -100,14 +123,29 @@ namespace iga {
         private:
 
             /**
-            *   Function will attempt to build the behaviour tree.
-            *   @param bool a_overwrite_bt If True ~ function will overwrite an existing behaviour tree.
+            *   Builds the behaviour tree if its asset has finished loading.
+            */
+            void FinishBuildBehaviourTree();
+
+            /**
+            *   Gives the component a behaviour tree for a loaded asset. Takes a tree from iga::bt::BTTreePool,
+            *   or builds a new one. Replaces the existing behaviour tree.
+            *   @param std::shared_ptr<const BTRuntimeAsset> a_asset The loaded runtime asset of the BT File.
             */
-            void BuildBehaviourTree(bool a_overwrite_bt);
+            void BuildFromAsset(const std::shared_ptr<const BTRuntimeAsset>& a_asset);
+
+            /** Drops a pending asynchronous build and returns the behaviour tree to iga::bt::BTTreePool. */
+            void ClearBehaviourTree();
+
+            std::shared_ptr<BTEntityAgent> agent_;  /**< The agent of the entity, owns the behaviour tree. */
 
             bool execute_behaviour_;    /**< Boolean whether the behaviour tree will get excuted or not each frame. */
             std::string bt_file_path_;  /**< The file path of the behaviour tree file. */
 
+            std::shared_future<std::shared_ptr<const BTRuntimeAsset>> pending_asset_; /**< Asset of an asynchronous build, valid while it is pending. */
+            bool pending_overwrite_ = false;    /**< Whether the pending build replaces the existing behaviour tree. */
+            bool build_failed_ = false;         /**< True if building failed, the tree won't be built lazily again until its file changes. */
+
         };
 
         SUBSCRIBECOMPONENT(BehaviourComponent)
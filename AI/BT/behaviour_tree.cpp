@@ -1,25 +1,32 @@
 #include <AI/BT/behaviour_tree.h>
 
+#ifndef IGART_BT_HEADLESS
 #include <Core/entity.h>
+#endif // IGART_BT_HEADLESS
 
 #include <AI/BT/Nodes/base_node.h>
 #include <AI/BT/black_board.h>
 #include <AI/BT/bt_debugger.h>
+#include <AI/BT/bt_coverage.h>
+#include <AI/BT/bt_runtime_stats.h>
+#include <AI/BT/bt_runtime_asset.h>
+#include <AI/BT/bt_hot_reload.h>
 
 #include <AI/BT/bt_defines.h>
 
 #include <iostream>
+#include <utility>
 
 namespace iga {
 
     namespace bt {
 
-        BehaviourTree::BehaviourTree(std::weak_ptr<iga::Entity> a_target) :
+        BehaviourTree::BehaviourTree(std::weak_ptr<Agent> a_target) :
             target_(a_target),
             blackboard_(),
             debugger_()
         { 
-            std::shared_ptr<iga::Entity> target = a_target.lock();
+            std::shared_ptr<Agent> target = a_target.lock();
             DEBUGASSERT(target);
             this->name_ = "BT-ID-";
             this->name_.append(std::to_string(target->GetID()));
@@ -27,24 +34,51 @@ namespace iga {
             this->blackboard_ = new BlackBoard();
             this->debugger_ = new BTDebugger();
 
+#ifdef BT_COVERAGE
+            this->coverage_ = new BTCoverageReport();
+#endif // BT_COVERAGE
+
+#ifdef BT_HOT_RELOAD
+            BTHotReload::Get().RegisterTree(this);
+#endif // BT_HOT_RELOAD
+
+            BTRuntimeStats::Get().OnTreeCreated();
         }
 
         BehaviourTree::~BehaviourTree() { 
+#ifdef BT_HOT_RELOAD
+            BTHotReload::Get().UnregisterTree(this);
+#endif // BT_HOT_RELOAD
+
             // Delete the blackboard.
             if (this->blackboard_ != nullptr) { delete this->blackboard_; }
 
+            // Merge and delete the coverage.
+            if (this->coverage_ != nullptr) {
+                FlushCoverage();
+                delete this->coverage_;
+            }
+
             // Delete tracked nodes.
             for (auto& tracked_node : this->tracked_nodes_) {
                 if (tracked_node != nullptr) {
-                    delete tracked_node;
+                    BaseNode::DestroyNode(tracked_node);
                     tracked_node = nullptr;
                 }
             }
             tracked_nodes_.clear();
+
+            BTRuntimeStats::Get().OnTreeDestroyed();
         }
 
         void BehaviourTree::ExecuteTree() {
 
+            // Writes posted by other systems become visible at the start of the tick.
+            this->blackboard_->PublishPendingWrites();
+
+            this->tick_node_visits_ = 0;
+            this->tick_running_nodes_ = 0;
+
 #ifndef BT_DEBUG
             this->root_->ExecuteNode();
 #else
@@ -52,30 +86,77 @@ namespace iga {
 
             std::cout << "Executing: " << this->name_ << std::endl;
 
-            this->root_->ExecuteNode(this);
+            this->root_->ExecuteNode();
 
             this->debugger_->ResetDebugger();
 
             std::cout << "------------" << std::endl;
 #endif
+
+            // Publish the counts of this tick at once, instead of per node.
+            BTRuntimeStats::Get().OnTreeTicked(this->tick_node_visits_, this->tick_running_nodes_);
         }
 
         void BehaviourTree::SetRoot(BaseNode* a_node) {
             this->root_ = a_node;
         }
 
-        std::weak_ptr<Entity> BehaviourTree::GetTarget() const {
+        BaseNode* BehaviourTree::GetRoot() const {
+            return this->root_;
+        }
+
+        std::weak_ptr<Agent> BehaviourTree::GetTarget() const {
             return this->target_;
         }
 
+        void BehaviourTree::SetTarget(std::weak_ptr<Agent> a_target) {
+            this->target_ = a_target;
+
+            std::shared_ptr<Agent> target = a_target.lock();
+            if (target != nullptr) {
+                this->name_ = "BT-ID-";
+                this->name_.append(std::to_string(target->GetID()));
+            }
+        }
+
+        void BehaviourTree::ResetRuntimeState() {
+            this->blackboard_->Clear();
+            this->blackboard_->SetParent(nullptr);
+            // The callbacks belong to the previous owner.
+            this->blackboard_->UnsubscribeAll();
+            this->debugger_->ResetDebugger();
+            FlushCoverage();
+
+            this->tick_node_visits_ = 0;
+            this->tick_running_nodes_ = 0;
+
+            for (auto& tracked_node : this->tracked_nodes_) {
+                tracked_node->ResetRuntimeState();
+            }
+        }
+
         void BehaviourTree::TrackNode(BaseNode* a_node_to_be_tracked) {
             this->tracked_nodes_.push_back(a_node_to_be_tracked);
         }
 
+        std::size_t BehaviourTree::GetNodeCount() const {
+            return this->tracked_nodes_.size();
+        }
+
+        void BehaviourTree::SetNodeBlock(std::shared_ptr<void> a_node_block) {
+            this->node_block_ = std::move(a_node_block);
+        }
+
         void BehaviourTree::GetTrackedNodes(std::vector<iga::bt::BaseNode*>* a_empty_vector) {
             (*a_empty_vector) = this->tracked_nodes_;
         }
 
+        void BehaviourTree::ReleaseNodes(std::vector<iga::bt::BaseNode*>& a_nodes) {
+            a_nodes.swap(this->tracked_nodes_);
+            this->tracked_nodes_.clear();
+            this->root_ = nullptr;
+        }
+
 
         BlackBoard* BehaviourTree::GetBlackBoard() const {
             return this->blackboard_;
@@ -85,6 +166,37 @@ namespace iga {
             return this->debugger_;
         }
 
+        void BehaviourTree::SetFilePath(const std::string& a_file_path) {
+            this->file_path_ = a_file_path;
+
+            if (this->coverage_ != nullptr) {
+                this->coverage_->asset_path = a_file_path;
+            }
+        }
+
+        const std::string& BehaviourTree::GetFilePath() const {
+            return this->file_path_;
+        }
+
+        void BehaviourTree::SetRuntimeAsset(std::shared_ptr<const BTRuntimeAsset> a_asset) {
+            this->runtime_asset_ = std::move(a_asset);
+        }
+
+        const std::shared_ptr<const BTRuntimeAsset>& BehaviourTree::GetRuntimeAsset() const {
+            return this->runtime_asset_;
+        }
+
+        BTCoverageReport* BehaviourTree::GetCoverage() const {
+            return this->coverage_;
+        }
+
+        void BehaviourTree::FlushCoverage() {
+            if (this->coverage_ == nullptr) { return; }
+
+            BTCoverage::Get().MergeReport(*this->coverage_);
+            this->coverage_->nodes.clear();
+        }
+
     } // End of namespace ~ bt
 
 } // End of namespace ~ iga
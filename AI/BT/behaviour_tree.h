@@ -1,8 +1,12 @@
 #pragma once
 
+#include <AI/BT/bt_agent.h>
+
 #include <string>
 #include <memory>
 #include <vector>
+#include <cstddef>
+#include <cstdint>
 
 /**
 *   @file behaviour_tree.h
@@ -15,7 +19,7 @@
 *   Class contains a base_node root that connects to other base_nodes.
 *   Class has a function; ExecuteTree, which will update the whole tree.
 *   Each Behaviour Tree has its own BlackBoard.
-*   A Behaviour Tree has access to the Entity it is targetting.
+*   A Behaviour Tree has access to the Agent it is targetting, see iga::bt::Agent.
 *   Behaviour Tree debugging can be enabled by define #BT_DEBUG in bt_defines.h
 *
 */
@@ -25,8 +29,6 @@
 */
 namespace iga {
 
-    class Entity;
-
     /**
     *  BT namespace
     */
@@ -35,6 +37,8 @@ namespace iga {
         class BaseNode;
         class BlackBoard;
         class BTDebugger;
+        struct BTCoverageReport;
+        class BTRuntimeAsset;
 
         /**
         *  iga::bt::BehaviourTree; Class functions as the main "brain" of the system.
@@ -44,17 +48,17 @@ namespace iga {
 
             /**
             *   BehaviourTree Constructor
-            *   @param a_target is a weak pointer to an iga:Entity. This BehaviourTree will 
-            *   target this entity. 
+            *   @param a_target is a weak pointer to an iga::bt::Agent. This BehaviourTree will 
+            *   target this agent. 
             */
-            BehaviourTree(std::weak_ptr<iga::Entity> a_target);
+            BehaviourTree(std::weak_ptr<Agent> a_target);
 
             /// BehaviourTree Destructor.
             ~BehaviourTree();
 
             /**
-            *   Function that executes the tree its behaviour. It
-            *   calls the root's update function.
+            *   Function that executes the tree its behaviour. It publishes the
+            *   pending writes of the blackboard, then calls the root's update function.
             *   @see iga::BaseNode
             */
             void ExecuteTree();
@@ -66,10 +70,31 @@ namespace iga {
             void SetRoot(BaseNode* a_node);
 
             /**
-            *   Returns a pointer of the behaviour trees's targeted Entitiy.
-            *   @return Pointer to target iga::Entity.
+            *   Returns the root node of this behaviour tree.
+            *   @return Pointer to iga::bt::BaseNode.
+            */
+            BaseNode* GetRoot() const;
+
+            /**
+            *   Returns a pointer of the behaviour trees's targeted Agent.
+            *   @return Pointer to target iga::bt::Agent.
+            */
+            std::weak_ptr<Agent> GetTarget() const;
+
+            /**
+            *   Sets the agent that the behaviour tree targets. Used when a recycled behaviour tree
+            *   gets a new owner, see iga::bt::BTTreePool.
+            *   @param std::weak_ptr<iga::bt::Agent> a_target The new target, may be empty.
+            */
+            void SetTarget(std::weak_ptr<Agent> a_target);
+
+            /**
+            *   Resets the behaviour tree to the state it had right after it was built. Clears the blackboard,
+            *   removes its subscriptions and detaches it from its parent scope, resets the debugger and the tick
+            *   counts, flushes the coverage and resets the runtime state of all nodes.
+            *   The nodes are kept; the blackboard only keeps the bucket arrays of its maps.
             */
-            std::weak_ptr<Entity> GetTarget() const;
+            void ResetRuntimeState();
 
             /**
             *   Adds the BaseNode to a vector. The behaviour tree will keep track of it.
@@ -78,12 +103,34 @@ namespace iga {
             */
             void TrackNode(BaseNode* a_node_to_be_tracked);
 
+            /**
+            *   Returns the amount of tracked nodes. Node indices of the tree run from 0 to the amount - 1.
+            *   @see iga::bt::BaseNode::GetNodeIndex
+            *   @return std::size_t value.
+            */
+            std::size_t GetNodeCount() const;
+
             /**
             *   Function returns tracked nodes stored inside of the vector that got passed through.
             *   @param std::vector<iga::bte::BaseNode*> a_empty_vector The returned vector with nodes.
             */
             void GetTrackedNodes(std::vector<iga::bt::BaseNode*>* a_empty_vector);
 
+            /**
+            *   Stops tracking all nodes and clears the root. The caller becomes the owner of the nodes.
+            *   Used to swap the nodes of a live behaviour tree, see iga::bt::BTBuilder::RebuildTree.
+            *   @param std::vector<iga::bte::BaseNode*> a_nodes The returned vector with the released nodes.
+            */
+            void ReleaseNodes(std::vector<iga::bt::BaseNode*>& a_nodes);
+
+            /**
+            *   Sets the node block that the nodes of this behaviour tree were built into. The block is shared by
+            *   every behaviour tree that was built by the same iga::bt::BTBuilder::BuildTrees call, and gets freed
+            *   once all of them have been destroyed.
+            *   @param std::shared_ptr<void> a_node_block The node block.
+            */
+            void SetNodeBlock(std::shared_ptr<void> a_node_block);
+
             /**
             *   Returns a pointer to the blackboard of the behaviour tree.
             *   @return Pointer to iga::bt::BlackBoard.
@@ -96,20 +143,77 @@ namespace iga {
             */
             BTDebugger* GetDebugger() const;
 
+            /**
+            *   Sets the file path of the BT File that this behaviour tree was built from.
+            *   @param std::string a_file_path The file path of the BT File.
+            */
+            void SetFilePath(const std::string& a_file_path);
+
+            /**
+            *   Returns the file path of the BT File that this behaviour tree was built from.
+            *   @return std::string value.
+            */
+            const std::string& GetFilePath() const;
+
+            /**
+            *   Sets the runtime asset that this behaviour tree was built from. The behaviour tree
+            *   keeps the asset loaded, so nodes can keep referring to its strings and parameters.
+            *   @param std::shared_ptr<const BTRuntimeAsset> a_asset The runtime asset.
+            */
+            void SetRuntimeAsset(std::shared_ptr<const BTRuntimeAsset> a_asset);
+
+            /**
+            *   Returns the runtime asset that this behaviour tree was built from.
+            *   @return std::shared_ptr<const BTRuntimeAsset> reference, empty if the tree wasn't built from an asset.
+            */
+            const std::shared_ptr<const BTRuntimeAsset>& GetRuntimeAsset() const;
+
+            /**
+            *   Returns a pointer to the coverage report of the behaviour tree.
+            *   Only valid when coverage recording is enabled by #BT_COVERAGE in bt_defines.h.
+            *   @return Pointer to iga::bt::BTCoverageReport, nullptr if coverage isn't recorded.
+            */
+            BTCoverageReport* GetCoverage() const;
+
+            /**
+            *   Merges the coverage recorded by this behaviour tree into the report of its
+            *   BT File and clears the recorded coverage. Also happens when the tree gets destroyed.
+            */
+            void FlushCoverage();
+
+            /**
+            *   Counts a node execution of the current tick. The counts get published
+            *   to iga::bt::BTRuntimeStats at the end of ExecuteTree.
+            *   @param bool a_running Whether the node returned RUNNING.
+            */
+            void CountNodeVisit(bool a_running);
+
         private:
 
             std::string name_ = "";                 /**< Name of the Behaviour Tree. */
+            std::string file_path_ = "";            /**< File path of the BT File that the Behaviour Tree was built from. */
+            std::shared_ptr<const BTRuntimeAsset> runtime_asset_; /**< Runtime asset that the Behaviour Tree was built from. Released after the nodes. */
 
             BaseNode* root_ = nullptr;              /**< Root Node of the Behaviour Tree. */
             std::vector<BaseNode*> tracked_nodes_;  /**< Vector of nodes that this behaviour tree ownes. Only used to delete nodes when behaviour tree destructor gets called.*/
+            std::shared_ptr<void> node_block_;      /**< Memory of the nodes, when they were built in bulk. Released after the nodes. */
 
-            std::weak_ptr<iga::Entity> target_;     /**< The target of the Behaviour Tree. */
+            std::weak_ptr<Agent> target_;           /**< The target of the Behaviour Tree. */
 
             BlackBoard* blackboard_ = nullptr;      /**< Blackboard for this behaviour tree. */
             BTDebugger* debugger_ = nullptr;        /**< Behaviour Tree Debugger. */
+            BTCoverageReport* coverage_ = nullptr;  /**< Coverage recorded by the Behaviour Tree. Only allocated with #BT_COVERAGE. */
+
+            std::uint32_t tick_node_visits_ = 0;    /**< Node executions during the current tick. */
+            std::uint32_t tick_running_nodes_ = 0;  /**< RUNNING results during the current tick. */
             
         };
 
+        inline void BehaviourTree::CountNodeVisit(bool a_running) {
+            ++this->tick_node_visits_;
+            if (a_running) { ++this->tick_running_nodes_; }
+        }
+
     } // End of namespace ~ bt
 
 } // End of namespace ~ iga
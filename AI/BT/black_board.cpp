@@ -1,152 +1,800 @@
-#include <AI\BT\black_board.h>
+#include <AI/BT/black_board.h>
 
-#include <AI\BT\Nodes\base_node.h>
+#include <AI/BT/Nodes/base_node.h>
+#include <AI/BT/black_board_snapshot.h>
+#include <AI/BT/bt_runtime_stats.h>
+#include <AI/BT/bt_timer_wheel.h>
 
+#include <algorithm>
+#include <atomic>
+#include <cstddef>
 #include <iostream>
+#include <utility>
+
+namespace {
+
+    std::atomic<std::uint64_t> version_counter(0);  /**< Versions of all blackboards, so versions of different scopes can be compared. */
+
+    /** Returns a version that is newer than every version handed out before. */
+    std::uint64_t NextVersion() { return version_counter.fetch_add(1, std::memory_order_relaxed) + 1; }
+
+    /** Estimated bytes of a value, used for the memory totals. */
+    template<typename T>
+    std::int64_t ValueBytes(const T& /*a_value*/) { return static_cast<std::int64_t>(sizeof(T)); }
+
+    std::int64_t ValueBytes(const std::string& a_value) { return static_cast<std::int64_t>(a_value.size()); }
+
+}
 
 namespace iga {
 
     namespace bt {
 
-        BlackBoard::BlackBoard() { /*EMPTY*/ }
+        /**
+        *   iga::bt::BlackBoardWrite; A posted blackboard write.
+        */
+        struct BlackBoardWrite {
+            BlackBoardTypes type = BlackBoardTypes::INT;    /**< Type of the value. */
+            std::string id;                                 /**< ID of the value. */
+            int int_value = 0;                              /**< Value, if the type is INT. */
+            float float_value = 0.0f;                       /**< Value, if the type is FLOAT. */
+            bool bool_value = false;                        /**< Value, if the type is BOOL. */
+            std::string string_value;                       /**< Value, if the type is STRING. */
+            BlackBoardVector2 vector2_value;                /**< Value, if the type is VECTOR2. */
+            BlackBoardVector4 vector4_value;                /**< Value, if the type is VECTOR4. */
+            BlackBoardEntity entity_value;                  /**< Value, if the type is ENTITY. */
+            BlackBoardWrite* next = nullptr;                /**< The write that was posted before this one. */
+        };
+
+        BlackBoardWriteBatch::BlackBoardWriteBatch() { /*EMPTY*/ }
+
+        BlackBoardWriteBatch::~BlackBoardWriteBatch() {
+            while (this->newest_ != nullptr) {
+                BlackBoardWrite* next = this->newest_->next;
+                delete this->newest_;
+                this->newest_ = next;
+            }
+        }
+
+        BlackBoardWriteBatch::BlackBoardWriteBatch(BlackBoardWriteBatch&& a_other) :
+            newest_(a_other.newest_),
+            oldest_(a_other.oldest_)
+        {
+            a_other.newest_ = nullptr;
+            a_other.oldest_ = nullptr;
+        }
+
+        BlackBoardWriteBatch& BlackBoardWriteBatch::operator=(BlackBoardWriteBatch&& a_other) {
+            if (this != &a_other) {
+                std::swap(this->newest_, a_other.newest_);
+                std::swap(this->oldest_, a_other.oldest_);
+            }
+            return *this;
+        }
+
+        void BlackBoardWriteBatch::SetIntMemory(std::string a_id, int a_value) {
+            BlackBoardWrite* write = new BlackBoardWrite();
+            write->type = BlackBoardTypes::INT;
+            write->id = std::move(a_id);
+            write->int_value = a_value;
+            AddWrite(write);
+        }
+
+        void BlackBoardWriteBatch::SetFloatMemory(std::string a_id, float a_value) {
+            BlackBoardWrite* write = new BlackBoardWrite();
+            write->type = BlackBoardTypes::FLOAT;
+            write->id = std::move(a_id);
+            write->float_value = a_value;
+            AddWrite(write);
+        }
+
+        void BlackBoardWriteBatch::SetBoolMemory(std::string a_id, bool a_value) {
+            BlackBoardWrite* write = new BlackBoardWrite();
+            write->type = BlackBoardTypes::BOOL;
+            write->id = std::move(a_id);
+            write->bool_value = a_value;
+            AddWrite(write);
+        }
+
+        void BlackBoardWriteBatch::SetStringMemory(std::string a_id, std::string a_value) {
+            BlackBoardWrite* write = new BlackBoardWrite();
+            write->type = BlackBoardTypes::STRING;
+            write->id = std::move(a_id);
+            write->string_value = std::move(a_value);
+            AddWrite(write);
+        }
+
+        void BlackBoardWriteBatch::SetVector2Memory(std::string a_id, const BlackBoardVector2& a_value) {
+            BlackBoardWrite* write = new BlackBoardWrite();
+            write->type = BlackBoardTypes::VECTOR2;
+            write->id = std::move(a_id);
+            write->vector2_value = a_value;
+            AddWrite(write);
+        }
+
+        void BlackBoardWriteBatch::SetVector4Memory(std::string a_id, const BlackBoardVector4& a_value) {
+            BlackBoardWrite* write = new BlackBoardWrite();
+            write->type = BlackBoardTypes::VECTOR4;
+            write->id = std::move(a_id);
+            write->vector4_value = a_value;
+            AddWrite(write);
+        }
+
+        void BlackBoardWriteBatch::SetEntityMemory(std::string a_id, const BlackBoardEntity& a_value) {
+            BlackBoardWrite* write = new BlackBoardWrite();
+            write->type = BlackBoardTypes::ENTITY;
+            write->id = std::move(a_id);
+            write->entity_value = a_value;
+            AddWrite(write);
+        }
+
+        bool BlackBoardWriteBatch::IsEmpty() const {
+            return this->newest_ == nullptr;
+        }
+
+        void BlackBoardWriteBatch::AddWrite(BlackBoardWrite* a_write) {
+            a_write->next = this->newest_;
+            this->newest_ = a_write;
+            if (this->oldest_ == nullptr) {
+                this->oldest_ = a_write;
+            }
+        }
+
+        BlackBoard::BlackBoard(BlackBoardScope a_scope) :
+            scope_(a_scope),
+            pending_writes_(nullptr)
+        {
+            // The timer wheel has to outlive every blackboard that registers with it.
+            BTTimerWheel::Get();
+        }
 
         BlackBoard::~BlackBoard() { 
+            Clear();
+
+            if (this->timer_owner_ != 0) {
+                BTTimerWheel::Get().Unregister(this->timer_owner_);
+            }
+        }
+
+        void BlackBoard::Clear() {
+            // Drop the pending writes, they were meant for the previous owner.
+            BlackBoardWriteBatch pending_writes;
+            pending_writes.newest_ = this->pending_writes_.exchange(nullptr, std::memory_order_acquire);
+
+            CountMemoryChange(-this->memory_entries_, -this->memory_bytes_);
+
             this->int_memory_.clear();
             this->float_memory_.clear();
             this->bool_memory_.clear();
             this->string_memory_.clear();
+            this->vector2_memory_.clear();
+            this->vector4_memory_.clear();
+            this->entity_memory_.clear();
+
+            this->version_ = this->removal_version_ = NextVersion();
         }
 
-        void BlackBoard::SetGlobalIntMemory(std::string a_id, int a_value) {
-            std::unordered_map<std::string, int>::const_iterator it;
-            it = this->int_memory_.find(a_id);
+        BlackBoardScope BlackBoard::GetScope() const {
+            return this->scope_;
+        }
 
-            if (it != this->int_memory_.end()) {
-                this->int_memory_.at(a_id) = a_value;
-            } else {
-                this->int_memory_.emplace(a_id, a_value);
+        bool BlackBoard::SetParent(std::shared_ptr<const BlackBoard> a_parent) {
+            // Scopes only resolve into broader scopes, so the hierarchy can't form a cycle.
+            if (a_parent != nullptr && static_cast<int>(a_parent->GetScope()) <= static_cast<int>(this->scope_)) {
+                std::cout << "ERROR - Behaviour Tree System - The parent of a blackboard has to be a broader scope." << std::endl;
+                return false;
+            }
+
+            // Values may resolve differently now.
+            this->parent_ = std::move(a_parent);
+            this->version_ = this->removal_version_ = NextVersion();
+            return true;
+        }
+
+        const std::shared_ptr<const BlackBoard>& BlackBoard::GetParent() const {
+            return this->parent_;
+        }
+
+        std::uint64_t BlackBoard::GetVersion() const {
+            std::uint64_t version = 0;
+            for (const BlackBoard* scope = this; scope != nullptr; scope = scope->parent_.get()) {
+                version = std::max(version, scope->version_);
             }
+            return version;
+        }
+
+        std::uint64_t BlackBoard::GetVersion(const std::string& a_id, BlackBoardTypes a_type) const {
+            // Closest scope first, like the getters.
+            for (const BlackBoard* scope = this; scope != nullptr; scope = scope->parent_.get()) {
+                std::uint64_t version = scope->GetScopeVersion(a_id, a_type);
+                if (version != 0) { return version; }
+            }
+            return 0;
+        }
+
+        std::uint64_t BlackBoard::GetScopeVersion(const std::string& a_id, BlackBoardTypes a_type) const {
+            switch (a_type) {
+            case BlackBoardTypes::INT: {
+                std::unordered_map<std::string, BlackBoardValue<int>>::const_iterator it = this->int_memory_.find(a_id);
+                return (it != this->int_memory_.end()) ? it->second.version : 0;
+            }
+            case BlackBoardTypes::FLOAT: {
+                std::unordered_map<std::string, BlackBoardValue<float>>::const_iterator it = this->float_memory_.find(a_id);
+                return (it != this->float_memory_.end()) ? it->second.version : 0;
+            }
+            case BlackBoardTypes::BOOL: {
+                std::unordered_map<std::string, BlackBoardValue<bool>>::const_iterator it = this->bool_memory_.find(a_id);
+                return (it != this->bool_memory_.end()) ? it->second.version : 0;
+            }
+            case BlackBoardTypes::STRING: {
+                std::unordered_map<std::string, BlackBoardValue<std::string>>::const_iterator it = this->string_memory_.find(a_id);
+                return (it != this->string_memory_.end()) ? it->second.version : 0;
+            }
+            case BlackBoardTypes::VECTOR2: {
+                std::unordered_map<std::string, BlackBoardValue<BlackBoardVector2>>::const_iterator it = this->vector2_memory_.find(a_id);
+                return (it != this->vector2_memory_.end()) ? it->second.version : 0;
+            }
+            case BlackBoardTypes::VECTOR4: {
+                std::unordered_map<std::string, BlackBoardValue<BlackBoardVector4>>::const_iterator it = this->vector4_memory_.find(a_id);
+                return (it != this->vector4_memory_.end()) ? it->second.version : 0;
+            }
+            case BlackBoardTypes::ENTITY: {
+                std::unordered_map<std::string, BlackBoardValue<BlackBoardEntity>>::const_iterator it = this->entity_memory_.find(a_id);
+                return (it != this->entity_memory_.end()) ? it->second.version : 0;
+            }
+            }
+            return 0;
+        }
+
+        bool BlackBoard::HasChangedSince(const std::string& a_id, BlackBoardTypes a_type, std::uint64_t a_version) const {
+            // Nothing at all changed in any scope, no lookup needed.
+            if (GetVersion() <= a_version) { return false; }
+
+            for (const BlackBoard* scope = this; scope != nullptr; scope = scope->parent_.get()) {
+                std::uint64_t version = scope->GetScopeVersion(a_id, a_type);
+                if (version != 0) { return version > a_version; }
+
+                // The value may have been removed from a closer scope, which resolves it to another scope now.
+                if (scope->removal_version_ > a_version) { return true; }
+            }
+            return true;
+        }
+
+        BlackBoard::SubscriptionID BlackBoard::Subscribe(std::string a_id, BlackBoardTypes a_type, ChangeCallback a_callback) {
+            Subscription subscription;
+            subscription.id = this->next_subscription_id_++;
+            subscription.type = a_type;
+            subscription.callback = std::move(a_callback);
+
+            this->subscriptions_[std::move(a_id)].push_back(std::move(subscription));
+            return this->next_subscription_id_ - 1;
+        }
+
+        void BlackBoard::Unsubscribe(SubscriptionID a_subscription) {
+            for (std::unordered_map<std::string, std::vector<Subscription>>::iterator it = this->subscriptions_.begin(); it != this->subscriptions_.end(); ++it) {
+                std::vector<Subscription>& subscriptions = it->second;
+                for (std::size_t i = 0; i < subscriptions.size(); ++i) {
+                    if (subscriptions[i].id != a_subscription) { continue; }
+
+                    subscriptions.erase(subscriptions.begin() + i);
+                    if (subscriptions.empty()) {
+                        this->subscriptions_.erase(it);
+                    }
+                    return;
+                }
+            }
+        }
+
+        void BlackBoard::UnsubscribeAll() {
+            this->subscriptions_.clear();
+        }
+
+        void BlackBoard::PostWrites(BlackBoardWriteBatch& a_batch) {
+            if (a_batch.IsEmpty()) { return; }
+
+            // Treiber stack push; the whole batch gets linked in with one exchange, so it gets published at once.
+            BlackBoardWrite* head = this->pending_writes_.load(std::memory_order_relaxed);
+            do {
+                a_batch.oldest_->next = head;
+            } while (!this->pending_writes_.compare_exchange_weak(head, a_batch.newest_, std::memory_order_release, std::memory_order_relaxed));
+
+            a_batch.newest_ = nullptr;
+            a_batch.oldest_ = nullptr;
+        }
+
+        void BlackBoard::PostIntMemory(std::string a_id, int a_value) {
+            BlackBoardWriteBatch batch;
+            batch.SetIntMemory(std::move(a_id), a_value);
+            PostWrites(batch);
+        }
+
+        void BlackBoard::PostFloatMemory(std::string a_id, float a_value) {
+            BlackBoardWriteBatch batch;
+            batch.SetFloatMemory(std::move(a_id), a_value);
+            PostWrites(batch);
+        }
+
+        void BlackBoard::PostBoolMemory(std::string a_id, bool a_value) {
+            BlackBoardWriteBatch batch;
+            batch.SetBoolMemory(std::move(a_id), a_value);
+            PostWrites(batch);
+        }
+
+        void BlackBoard::PostStringMemory(std::string a_id, std::string a_value) {
+            BlackBoardWriteBatch batch;
+            batch.SetStringMemory(std::move(a_id), std::move(a_value));
+            PostWrites(batch);
+        }
+
+        void BlackBoard::PostVector2Memory(std::string a_id, const BlackBoardVector2& a_value) {
+            BlackBoardWriteBatch batch;
+            batch.SetVector2Memory(std::move(a_id), a_value);
+            PostWrites(batch);
+        }
+
+        void BlackBoard::PostVector4Memory(std::string a_id, const BlackBoardVector4& a_value) {
+            BlackBoardWriteBatch batch;
+            batch.SetVector4Memory(std::move(a_id), a_value);
+            PostWrites(batch);
+        }
+
+        void BlackBoard::PostEntityMemory(std::string a_id, const BlackBoardEntity& a_value) {
+            BlackBoardWriteBatch batch;
+            batch.SetEntityMemory(std::move(a_id), a_value);
+            PostWrites(batch);
+        }
+
+        bool BlackBoard::HasPendingWrites() const {
+            return this->pending_writes_.load(std::memory_order_relaxed) != nullptr;
+        }
+
+        bool BlackBoard::PublishPendingWrites() {
+            // Cheap check first, most blackboards don't have posted writes most frames.
+            if (this->pending_writes_.load(std::memory_order_relaxed) == nullptr) { return false; }
+
+            BlackBoardWrite* newest = this->pending_writes_.exchange(nullptr, std::memory_order_acquire);
+            if (newest == nullptr) { return false; }
+
+            // The stack is newest first, reverse it to apply the writes in the order that they were posted.
+            BlackBoardWrite* oldest = nullptr;
+            while (newest != nullptr) {
+                BlackBoardWrite* next = newest->next;
+                newest->next = oldest;
+                oldest = newest;
+                newest = next;
+            }
+
+            while (oldest != nullptr) {
+                BlackBoardWrite* write = oldest;
+                oldest = write->next;
+
+                switch (write->type) {
+                case BlackBoardTypes::INT:
+                    SetGlobalIntMemory(std::move(write->id), write->int_value);
+                    break;
+                case BlackBoardTypes::FLOAT:
+                    SetGlobalFloatMemory(std::move(write->id), write->float_value);
+                    break;
+                case BlackBoardTypes::BOOL:
+                    SetGlobalBoolMemory(std::move(write->id), write->bool_value);
+                    break;
+                case BlackBoardTypes::STRING:
+                    SetGlobalStringMemory(std::move(write->id), std::move(write->string_value));
+                    break;
+                case BlackBoardTypes::VECTOR2:
+                    SetGlobalVector2Memory(std::move(write->id), write->vector2_value);
+                    break;
+                case BlackBoardTypes::VECTOR4:
+                    SetGlobalVector4Memory(std::move(write->id), write->vector4_value);
+                    break;
+                case BlackBoardTypes::ENTITY:
+                    SetGlobalEntityMemory(std::move(write->id), write->entity_value);
+                    break;
+                }
+
+                delete write;
+            }
+
+            return true;
+        }
+
+        bool BlackBoard::WriteSnapshot(std::vector<char>& a_data) const {
+            return BlackBoardSnapshot::Write({ this }, a_data);
+        }
+
+        bool BlackBoard::RestoreSnapshot(const char* a_data, std::size_t a_size) {
+            return BlackBoardSnapshot::Read(a_data, a_size, { this });
+        }
+
+        void BlackBoard::SetGlobalIntMemory(std::string a_id, int a_value) {
+            SetMemory(this->int_memory_, std::move(a_id), std::move(a_value), BlackBoardTypes::INT, 0);
+        }
+
+        void BlackBoard::SetGlobalIntMemory(std::string a_id, int a_value, float a_time_to_live) {
+            std::uint64_t expiry_tick = GetExpiryTick(a_time_to_live);
+            SetMemory(this->int_memory_, std::move(a_id), std::move(a_value), BlackBoardTypes::INT, expiry_tick);
         }
 
         void BlackBoard::SetIntMemory(std::string a_id, BaseNode* a_node, int a_value) {
-            std::string new_id = a_id.append(std::to_string(a_node->GetID()));
+            std::string new_id = a_id.append(std::to_string(a_node->GetNodeIndex()));
             SetGlobalIntMemory(new_id, a_value);
         }
 
         void BlackBoard::SetGlobalFloatMemory(std::string a_id, float a_value) {
-            std::unordered_map<std::string, float>::const_iterator it;
-            it = this->float_memory_.find(a_id);
+            SetMemory(this->float_memory_, std::move(a_id), std::move(a_value), BlackBoardTypes::FLOAT, 0);
+        }
 
-            if (it != this->float_memory_.end()) {
-                this->float_memory_.at(a_id) = a_value;
-            } else {
-                this->float_memory_.emplace(a_id, a_value);
-            }
+        void BlackBoard::SetGlobalFloatMemory(std::string a_id, float a_value, float a_time_to_live) {
+            std::uint64_t expiry_tick = GetExpiryTick(a_time_to_live);
+            SetMemory(this->float_memory_, std::move(a_id), std::move(a_value), BlackBoardTypes::FLOAT, expiry_tick);
         }
 
         void BlackBoard::SetFloatMemory(std::string a_id, BaseNode* a_node, float a_value) {
-            std::string new_id = a_id.append(std::to_string(a_node->GetID()));
+            std::string new_id = a_id.append(std::to_string(a_node->GetNodeIndex()));
             SetGlobalFloatMemory(new_id, a_value);
         }
 
         void BlackBoard::SetGlobalBoolMemory(std::string a_id, bool a_value) {
-            std::unordered_map<std::string, bool>::const_iterator it;
-            it = this->bool_memory_.find(a_id);
+            SetMemory(this->bool_memory_, std::move(a_id), std::move(a_value), BlackBoardTypes::BOOL, 0);
+        }
 
-            if (it != this->bool_memory_.end()) {
-                this->bool_memory_.at(a_id) = a_value;
-            } else {
-                this->bool_memory_.emplace(a_id, a_value);
-            }
+        void BlackBoard::SetGlobalBoolMemory(std::string a_id, bool a_value, float a_time_to_live) {
+            std::uint64_t expiry_tick = GetExpiryTick(a_time_to_live);
+            SetMemory(this->bool_memory_, std::move(a_id), std::move(a_value), BlackBoardTypes::BOOL, expiry_tick);
         }
 
         void BlackBoard::SetBoolMemory(std::string a_id, BaseNode* a_node, bool a_value) {
-            std::string new_id = a_id.append(std::to_string(a_node->GetID()));
+            std::string new_id = a_id.append(std::to_string(a_node->GetNodeIndex()));
             SetGlobalBoolMemory(new_id, a_value);
         }
         
         void BlackBoard::SetGlobalStringMemory(std::string a_id, std::string a_value) {
-            std::unordered_map < std::string, std::string > ::const_iterator it;
-            it = this->string_memory_.find(a_id);
+            SetMemory(this->string_memory_, std::move(a_id), std::move(a_value), BlackBoardTypes::STRING, 0);
+        }
 
-            if (it != this->string_memory_.end()) {
-                this->string_memory_.at(a_id) = a_value;
-            } else {
-                this->string_memory_.emplace(a_id, a_value);
-            }
+        void BlackBoard::SetGlobalStringMemory(std::string a_id, std::string a_value, float a_time_to_live) {
+            std::uint64_t expiry_tick = GetExpiryTick(a_time_to_live);
+            SetMemory(this->string_memory_, std::move(a_id), std::move(a_value), BlackBoardTypes::STRING, expiry_tick);
         }
 
         void BlackBoard::SetStringMemory(std::string a_id, BaseNode* a_node, std::string a_value) {
-            std::string new_id = a_id.append(std::to_string(a_node->GetID()));
+            std::string new_id = a_id.append(std::to_string(a_node->GetNodeIndex()));
             SetGlobalStringMemory(new_id, a_value);
         }
 
+        void BlackBoard::SetGlobalVector2Memory(std::string a_id, const BlackBoardVector2& a_value) {
+            SetMemory(this->vector2_memory_, std::move(a_id), BlackBoardVector2(a_value), BlackBoardTypes::VECTOR2, 0);
+        }
+
+        void BlackBoard::SetGlobalVector2Memory(std::string a_id, const BlackBoardVector2& a_value, float a_time_to_live) {
+            std::uint64_t expiry_tick = GetExpiryTick(a_time_to_live);
+            SetMemory(this->vector2_memory_, std::move(a_id), BlackBoardVector2(a_value), BlackBoardTypes::VECTOR2, expiry_tick);
+        }
+
+        void BlackBoard::SetVector2Memory(std::string a_id, BaseNode* a_node, const BlackBoardVector2& a_value) {
+            a_id.append(std::to_string(a_node->GetNodeIndex()));
+            SetMemory(this->vector2_memory_, std::move(a_id), BlackBoardVector2(a_value), BlackBoardTypes::VECTOR2, 0);
+        }
+
+        void BlackBoard::SetGlobalVector4Memory(std::string a_id, const BlackBoardVector4& a_value) {
+            SetMemory(this->vector4_memory_, std::move(a_id), BlackBoardVector4(a_value), BlackBoardTypes::VECTOR4, 0);
+        }
+
+        void BlackBoard::SetGlobalVector4Memory(std::string a_id, const BlackBoardVector4& a_value, float a_time_to_live) {
+            std::uint64_t expiry_tick = GetExpiryTick(a_time_to_live);
+            SetMemory(this->vector4_memory_, std::move(a_id), BlackBoardVector4(a_value), BlackBoardTypes::VECTOR4, expiry_tick);
+        }
+
+        void BlackBoard::SetVector4Memory(std::string a_id, BaseNode* a_node, const BlackBoardVector4& a_value) {
+            a_id.append(std::to_string(a_node->GetNodeIndex()));
+            SetMemory(this->vector4_memory_, std::move(a_id), BlackBoardVector4(a_value), BlackBoardTypes::VECTOR4, 0);
+        }
+
+        void BlackBoard::SetGlobalEntityMemory(std::string a_id, const BlackBoardEntity& a_value) {
+            SetMemory(this->entity_memory_, std::move(a_id), BlackBoardEntity(a_value), BlackBoardTypes::ENTITY, 0);
+        }
+
+        void BlackBoard::SetGlobalEntityMemory(std::string a_id, const BlackBoardEntity& a_value, float a_time_to_live) {
+            std::uint64_t expiry_tick = GetExpiryTick(a_time_to_live);
+            SetMemory(this->entity_memory_, std::move(a_id), BlackBoardEntity(a_value), BlackBoardTypes::ENTITY, expiry_tick);
+        }
+
+        void BlackBoard::SetEntityMemory(std::string a_id, BaseNode* a_node, const BlackBoardEntity& a_value) {
+            a_id.append(std::to_string(a_node->GetNodeIndex()));
+            SetMemory(this->entity_memory_, std::move(a_id), BlackBoardEntity(a_value), BlackBoardTypes::ENTITY, 0);
+        }
+
         bool BlackBoard::GetIntMemory(std::string a_id, int& a_int_ref) const {
-            std::unordered_map<std::string, int>::const_iterator it;
-            it = this->int_memory_.find(a_id);
+            // Closest scope first.
+            for (const BlackBoard* scope = this; scope != nullptr; scope = scope->parent_.get()) {
+                std::unordered_map<std::string, BlackBoardValue<int>>::const_iterator it;
+                it = scope->int_memory_.find(a_id);
+
+                if (it != scope->int_memory_.end()) {
+                    a_int_ref = it->second.value;
+                    return true;
+                }
+            }
+            return false;
+        }
+
+        bool BlackBoard::GetIntMemory(std::string a_id, BaseNode* a_node, int& a_int_ref) const {
+            // Values in the scope of a node never resolve through the parent scopes.
+            std::string new_id = a_id.append(std::to_string(a_node->GetNodeIndex()));
+            std::unordered_map<std::string, BlackBoardValue<int>>::const_iterator it;
+            it = this->int_memory_.find(new_id);
 
             if (it != this->int_memory_.end()) {
-                a_int_ref = it->second;
+                a_int_ref = it->second.value;
                 return true;
             } else {
-                return false; 
+                return false;
             }
         }
 
-        bool BlackBoard::GetIntMemory(std::string a_id, BaseNode* a_node, int& a_int_ref) const {
-            std::string new_id = a_id.append(std::to_string(a_node->GetID()));
-            return GetIntMemory(new_id, a_int_ref);
+        bool BlackBoard::GetFloatMemory(std::string a_id, float& a_float_ref) const {
+            // Closest scope first.
+            for (const BlackBoard* scope = this; scope != nullptr; scope = scope->parent_.get()) {
+                std::unordered_map<std::string, BlackBoardValue<float>>::const_iterator it;
+                it = scope->float_memory_.find(a_id);
+
+                if (it != scope->float_memory_.end()) {
+                    a_float_ref = it->second.value;
+                    return true;
+                }
+            }
+            return false;
         }
 
-        bool BlackBoard::GetFloatMemory(std::string a_id, float& a_float_ref) const {
-            std::unordered_map<std::string, float>::const_iterator it;
-            it = this->float_memory_.find(a_id);
+        bool BlackBoard::GetFloatMemory(std::string a_id, BaseNode* a_node, float& a_float_ref) const {
+            // Values in the scope of a node never resolve through the parent scopes.
+            std::string new_id = a_id.append(std::to_string(a_node->GetNodeIndex()));
+            std::unordered_map<std::string, BlackBoardValue<float>>::const_iterator it;
+            it = this->float_memory_.find(new_id);
 
             if (it != this->float_memory_.end()) {
-                a_float_ref = it->second;
+                a_float_ref = it->second.value;
                 return true;
             } else {
                 return false;
             }
         }
 
-        bool BlackBoard::GetFloatMemory(std::string a_id, BaseNode* a_node, float& a_float_ref) const {
-            std::string new_id = a_id.append(std::to_string(a_node->GetID()));
-            return GetFloatMemory(new_id, a_float_ref);
+        bool BlackBoard::GetBoolMemory(std::string a_id, bool& a_bool_ref) const {
+            // Closest scope first.
+            for (const BlackBoard* scope = this; scope != nullptr; scope = scope->parent_.get()) {
+                std::unordered_map<std::string, BlackBoardValue<bool>>::const_iterator it;
+                it = scope->bool_memory_.find(a_id);
+
+                if (it != scope->bool_memory_.end()) {
+                    a_bool_ref = it->second.value;
+                    return true;
+                }
+            }
+            return false;
         }
 
-        bool BlackBoard::GetBoolMemory(std::string a_id, bool& a_bool_ref) const {
-            std::unordered_map<std::string, bool>::const_iterator it;
-            it = this->bool_memory_.find(a_id);
+        bool BlackBoard::GetBoolMemory(std::string a_id, BaseNode* a_node, bool& a_bool_ref) const {
+            // Values in the scope of a node never resolve through the parent scopes.
+            std::string new_id = a_id.append(std::to_string(a_node->GetNodeIndex()));
+            std::unordered_map<std::string, BlackBoardValue<bool>>::const_iterator it;
+            it = this->bool_memory_.find(new_id);
 
             if (it != this->bool_memory_.end()) {
-                a_bool_ref = it->second;
+                a_bool_ref = it->second.value;
                 return true;
             } else {
                 return false;
             }
         }
 
-        bool BlackBoard::GetBoolMemory(std::string a_id, BaseNode* a_node, bool& a_bool_ref) const {
-            std::string new_id = a_id.append(std::to_string(a_node->GetID()));
-            return GetBoolMemory(new_id, a_bool_ref);
+        bool BlackBoard::GetStringMemory(std::string a_id, std::string& a_string_ref) const {
+            // Closest scope first.
+            for (const BlackBoard* scope = this; scope != nullptr; scope = scope->parent_.get()) {
+                std::unordered_map<std::string, BlackBoardValue<std::string>>::const_iterator it;
+                it = scope->string_memory_.find(a_id);
+
+                if (it != scope->string_memory_.end()) {
+                    a_string_ref = it->second.value;
+                    return true;
+                }
+            }
+            return false;
         }
 
-        bool BlackBoard::GetStringMemory(std::string a_id, std::string& a_string_ref) const {
-            std::unordered_map<std::string, std::string>::const_iterator it;
-            it = this->string_memory_.find(a_id);
+        bool BlackBoard::GetStringMemory(std::string a_id, BaseNode* a_node, std::string& a_string_ref) const {
+            // Values in the scope of a node never resolve through the parent scopes.
+            std::string new_id = a_id.append(std::to_string(a_node->GetNodeIndex()));
+            std::unordered_map<std::string, BlackBoardValue<std::string>>::const_iterator it;
+            it = this->string_memory_.find(new_id);
 
             if (it != this->string_memory_.end()) {
-                a_string_ref = it->second;
+                a_string_ref = it->second.value;
                 return true;
             } else {
                 return false;
             }
         }
 
-        bool BlackBoard::GetStringMemory(std::string a_id, BaseNode* a_node, std::string& a_string_ref) const {
-            std::string new_id = a_id.append(std::to_string(a_node->GetID()));
-            return GetStringMemory(new_id, a_string_ref);
+        bool BlackBoard::GetVector2Memory(const std::string& a_id, BlackBoardVector2& a_vector2_ref) const {
+            return GetMemory(&BlackBoard::vector2_memory_, a_id, a_vector2_ref);
+        }
+
+        bool BlackBoard::GetVector2Memory(std::string a_id, BaseNode* a_node, BlackBoardVector2& a_vector2_ref) const {
+            // Values in the scope of a node never resolve through the parent scopes.
+            a_id.append(std::to_string(a_node->GetNodeIndex()));
+            std::unordered_map<std::string, BlackBoardValue<BlackBoardVector2>>::const_iterator it = this->vector2_memory_.find(a_id);
+
+            if (it != this->vector2_memory_.end()) {
+                a_vector2_ref = it->second.value;
+                return true;
+            }
+            return false;
+        }
+
+        bool BlackBoard::GetVector4Memory(const std::string& a_id, BlackBoardVector4& a_vector4_ref) const {
+            return GetMemory(&BlackBoard::vector4_memory_, a_id, a_vector4_ref);
+        }
+
+        bool BlackBoard::GetVector4Memory(std::string a_id, BaseNode* a_node, BlackBoardVector4& a_vector4_ref) const {
+            // Values in the scope of a node never resolve through the parent scopes.
+            a_id.append(std::to_string(a_node->GetNodeIndex()));
+            std::unordered_map<std::string, BlackBoardValue<BlackBoardVector4>>::const_iterator it = this->vector4_memory_.find(a_id);
+
+            if (it != this->vector4_memory_.end()) {
+                a_vector4_ref = it->second.value;
+                return true;
+            }
+            return false;
+        }
+
+        bool BlackBoard::GetEntityMemory(const std::string& a_id, BlackBoardEntity& a_entity_ref) const {
+            return GetMemory(&BlackBoard::entity_memory_, a_id, a_entity_ref);
+        }
+
+        bool BlackBoard::GetEntityMemory(std::string a_id, BaseNode* a_node, BlackBoardEntity& a_entity_ref) const {
+            // Values in the scope of a node never resolve through the parent scopes.
+            a_id.append(std::to_string(a_node->GetNodeIndex()));
+            std::unordered_map<std::string, BlackBoardValue<BlackBoardEntity>>::const_iterator it = this->entity_memory_.find(a_id);
+
+            if (it != this->entity_memory_.end()) {
+                a_entity_ref = it->second.value;
+                return true;
+            }
+            return false;
+        }
+
+        template<typename T>
+        void BlackBoard::SetMemory(std::unordered_map<std::string, BlackBoardValue<T>>& a_memory, std::string&& a_id, T&& a_value, BlackBoardTypes a_type, std::uint64_t a_expiry_tick) {
+            std::pair<typename std::unordered_map<std::string, BlackBoardValue<T>>::iterator, bool> result = a_memory.try_emplace(std::move(a_id));
+            BlackBoardValue<T>& entry = result.first->second;
+
+            entry.expiry_tick = a_expiry_tick;
+            if (a_expiry_tick != 0) {
+                ScheduleExpiry(entry, result.first->first, a_type);
+            }
+
+            if (result.second) {
+                CountMemoryChange(1, static_cast<std::int64_t>(result.first->first.size()) + ValueBytes(a_value));
+            } else if (entry.value == a_value) {
+                // Unchanged, the version stays.
+                return;
+            } else {
+                CountMemoryChange(0, ValueBytes(a_value) - ValueBytes(entry.value));
+            }
+
+            entry.value = std::move(a_value);
+            entry.version = this->version_ = NextVersion();
+
+            if (!this->subscriptions_.empty()) {
+                NotifySubscriptions(result.first->first, a_type);
+            }
+        }
+
+        template<typename T>
+        bool BlackBoard::GetMemory(std::unordered_map<std::string, BlackBoardValue<T>> BlackBoard::* a_memory, const std::string& a_id, T& a_ref) const {
+            // Closest scope first.
+            for (const BlackBoard* scope = this; scope != nullptr; scope = scope->parent_.get()) {
+                const std::unordered_map<std::string, BlackBoardValue<T>>& memory = scope->*a_memory;
+                typename std::unordered_map<std::string, BlackBoardValue<T>>::const_iterator it = memory.find(a_id);
+
+                if (it != memory.end()) {
+                    a_ref = it->second.value;
+                    return true;
+                }
+            }
+            return false;
+        }
+
+        std::uint64_t BlackBoard::GetExpiryTick(float a_time_to_live) {
+            return BTTimerWheel::Get().GetExpiryTick(a_time_to_live);
+        }
+
+        template<typename T>
+        void BlackBoard::ScheduleExpiry(BlackBoardValue<T>& a_entry, const std::string& a_id, BlackBoardTypes a_type) {
+            // A pending timer that fires no later than the value expires gets rescheduled when it fires.
+            if (a_entry.timer_tick != 0 && a_entry.timer_tick <= a_entry.expiry_tick) { return; }
+
+            // The pending timer fires too late; it doesn't match the value anymore once it fires.
+            a_entry.timer_tick = BTTimerWheel::Get().Schedule(GetTimerOwner(), a_id, a_type, a_entry.expiry_tick);
+        }
+
+        std::uint64_t BlackBoard::GetTimerOwner() {
+            if (this->timer_owner_ == 0) {
+                this->timer_owner_ = BTTimerWheel::Get().Register(this);
+            }
+            return this->timer_owner_;
+        }
+
+        void BlackBoard::ExpireMemory(const std::string& a_id, BlackBoardTypes a_type, std::uint64_t a_timer_tick) {
+            switch (a_type) {
+            case BlackBoardTypes::INT:
+                ExpireMemory(this->int_memory_, a_id, a_type, a_timer_tick);
+                break;
+            case BlackBoardTypes::FLOAT:
+                ExpireMemory(this->float_memory_, a_id, a_type, a_timer_tick);
+                break;
+            case BlackBoardTypes::BOOL:
+                ExpireMemory(this->bool_memory_, a_id, a_type, a_timer_tick);
+                break;
+            case BlackBoardTypes::STRING:
+                ExpireMemory(this->string_memory_, a_id, a_type, a_timer_tick);
+                break;
+            case BlackBoardTypes::VECTOR2:
+                ExpireMemory(this->vector2_memory_, a_id, a_type, a_timer_tick);
+                break;
+            case BlackBoardTypes::VECTOR4:
+                ExpireMemory(this->vector4_memory_, a_id, a_type, a_timer_tick);
+                break;
+            case BlackBoardTypes::ENTITY:
+                ExpireMemory(this->entity_memory_, a_id, a_type, a_timer_tick);
+                break;
+            }
+        }
+
+        template<typename T>
+        void BlackBoard::ExpireMemory(std::unordered_map<std::string, BlackBoardValue<T>>& a_memory, const std::string& a_id, BlackBoardTypes a_type, std::uint64_t a_timer_tick) {
+            typename std::unordered_map<std::string, BlackBoardValue<T>>::iterator it = a_memory.find(a_id);
+
+            // The value got removed, or got a timer that fires earlier, since the timer was scheduled.
+            if (it == a_memory.end() || it->second.timer_tick != a_timer_tick) { return; }
+
+            BlackBoardValue<T>& entry = it->second;
+            entry.timer_tick = 0;
+
+            // Written again without a time to live.
+            if (entry.expiry_tick == 0) { return; }
+
+            // Written again with a later expiry; the wheel may have advanced past the timer already.
+            if (entry.expiry_tick > BTTimerWheel::Get().GetCurrentTick()) {
+                ScheduleExpiry(entry, it->first, a_type);
+                return;
+            }
+
+            CountMemoryChange(-1, -(static_cast<std::int64_t>(it->first.size()) + ValueBytes(it->second.value)));
+            a_memory.erase(it);
+            this->version_ = this->removal_version_ = NextVersion();
+
+            if (!this->subscriptions_.empty()) {
+                NotifySubscriptions(a_id, a_type);
+            }
+        }
+
+        void BlackBoard::NotifySubscriptions(const std::string& a_id, BlackBoardTypes a_type) {
+            std::unordered_map<std::string, std::vector<Subscription>>::const_iterator it = this->subscriptions_.find(a_id);
+            if (it == this->subscriptions_.end()) { return; }
+
+            for (auto& subscription : it->second) {
+                if (subscription.type == a_type) {
+                    subscription.callback(a_id, a_type);
+                }
+            }
+        }
+
+        void BlackBoard::CountMemoryChange(std::int64_t a_entries, std::int64_t a_bytes) {
+            this->memory_entries_ += a_entries;
+            this->memory_bytes_ += a_bytes;
+            BTRuntimeStats::Get().OnBlackBoardChanged(a_entries, a_bytes);
         }
 
 
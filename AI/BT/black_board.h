@@ -1,7 +1,15 @@
 #pragma once
 
+#include <AI/BT/black_board_values.h>
+
+#include <atomic>
+#include <cstddef>
+#include <functional>
 #include <string>
 #include <unordered_map>
+#include <cstdint>
+#include <memory>
+#include <vector>
 
 /**
 * @file black_board.h
@@ -12,8 +20,42 @@
 * @version $Revision 1.1
 *
 * Class contains std::unordered_maps for the data types;
-* Integer, Float, Bool & String.
+* Integer, Float, Bool, String, Vector2, Vector4 & Entity, see black_board_values.h.
 * Setting memory will create a copy and will store it inside of the maps.
+* Values in the scope of a node are keyed by the index of the node in its behaviour tree,
+* see iga::bt::BaseNode::GetNodeIndex, so copies of a tree use the same keys.
+*
+* Blackboards form a hierarchy of scopes; the blackboard of a behaviour tree is an AGENT scope,
+* its parent can be a GROUP scope that is shared by a squad, whose parent can be the WORLD scope.
+* Reading a global value resolves the key through the agent, then the group, then the world scope.
+* Shared scopes are stored once and read in place, they are never copied into the agents.
+*
+* Write policy; nodes only write into the blackboard of their own behaviour tree, a write shadows the
+* value of a parent scope. Parents are held as const, so a tree can't write into a shared scope. Game
+* code writes shared scopes through its own pointer, outside of the ticks of the behaviour trees that
+* read them. Ticks on several threads may read a shared scope at the same time, since reads don't modify it.
+* Values in the scope of a node are never shared.
+*
+* Systems on other threads, such as perception, don't write a blackboard directly; they post their
+* writes. Posting pushes the writes onto a lock-free stack, the back buffer, and never blocks. The
+* pending writes get published into the blackboard at the frame boundary; the blackboard of a behaviour
+* tree publishes them at the start of its tick, shared scopes publish them when game code calls
+* PublishPendingWrites before the ticks. Reads never lock, and the writes of one batch are always
+* published together, so a tick sees all of them or none of them.
+*
+* Every value carries a version. Setting a value bumps its version only if the stored value actually
+* changes, so decorators and condition caches can skip work with HasChangedSince. Versions come from one
+* counter shared by all blackboards and only ever increase, also across Clear. Versions and HasChangedSince
+* resolve through the parent scopes like the getters, so a change of a GROUP or WORLD value counts too.
+* Callbacks can subscribe to a value, they get called by the setter whenever the value changes.
+*
+* Global values can be written with a time to live, e.g. the last seen position of an enemy. The value
+* gets removed once it expires, by the iga::bt::BTTimerWheel that is shared by all blackboards, so
+* BBIsValid reports FAILED for it. Writing the value again replaces its time to live; writing it without
+* a time to live makes it permanent. Expiring a value counts as a change.
+*
+* The values of blackboards can be written into a compact binary snapshot and restored from it, e.g. for
+* save games and rollback; see iga::bt::BlackBoardSnapshot, which also snapshots many blackboards at once.
 *
 */
 
@@ -29,14 +71,329 @@ namespace iga {
 
         class BaseNode;
 
+        /** The BlackBoardTypes enum, represents the types of values that the blackboard can store. */
+        enum class BlackBoardTypes {
+            INT     = 0,    /**< Integer value. */
+            FLOAT   = 1,    /**< Float value. */
+            BOOL    = 2,    /**< Bool value. */
+            STRING  = 3,    /**< String value. */
+            VECTOR2 = 4,    /**< iga::bt::BlackBoardVector2 value. */
+            VECTOR4 = 5,    /**< iga::bt::BlackBoardVector4 value. */
+            ENTITY  = 6     /**< iga::bt::BlackBoardEntity value, a weak entity handle. */
+        };
+
+        /** The BlackBoardScope enum, represents the level of a blackboard in the scope hierarchy. */
+        enum class BlackBoardScope {
+            AGENT   = 0,    /**< Blackboard of a single behaviour tree. */
+            GROUP   = 1,    /**< Blackboard shared by a group of agents, such as a squad. */
+            WORLD   = 2     /**< Blackboard shared by every agent. */
+        };
+
+        /**
+        *   iga::bt::BlackBoardKey; A blackboard value that a node reads or writes.
+        *   Used to validate the blackboard usage of a behaviour tree when it gets cooked.
+        */
+        struct BlackBoardKey {
+            std::string name;                       /**< ID of the value. */
+            BlackBoardTypes type = BlackBoardTypes::INT; /**< Type of the value. */
+            bool write = false;                     /**< True if the node writes the value, False if it reads it. */
+        };
+
+        struct BlackBoardWrite;
+
+        /**
+        *   iga::bt::BlackBoardValue; A value stored in the blackboard, with the version of its last change.
+        */
+        template<typename T>
+        struct BlackBoardValue {
+            T value = T();                  /**< The value. */
+            std::uint64_t version = 0;      /**< Blackboard version of the last change of the value. */
+            std::uint64_t expiry_tick = 0;  /**< Tick of iga::bt::BTTimerWheel at which the value expires, 0 if it never does. */
+            std::uint64_t timer_tick = 0;   /**< Tick at which the timer of the value fires, 0 if it has none. */
+        };
+
+        /**
+        *   iga::bt::BlackBoardWriteBatch; Blackboard writes that get posted and published together.
+        */
+        class BlackBoardWriteBatch final {
+        public:
+            /** BlackBoardWriteBatch Constructor */
+            BlackBoardWriteBatch();
+
+            /** BlackBoardWriteBatch Destructor. Deletes the writes that haven't been posted. */
+            ~BlackBoardWriteBatch();
+
+            BlackBoardWriteBatch(BlackBoardWriteBatch&& a_other);
+            BlackBoardWriteBatch& operator=(BlackBoardWriteBatch&& a_other);
+
+            BlackBoardWriteBatch(const BlackBoardWriteBatch&) = delete;
+            BlackBoardWriteBatch& operator=(const BlackBoardWriteBatch&) = delete;
+
+            /**
+            *   Adds a write of a global integer value to the batch.
+            *   @param a_id is a string that is assigned this value.
+            *   @param a_value is the integer value.
+            */
+            void SetIntMemory(std::string a_id, int a_value);
+
+            /**
+            *   Adds a write of a global float value to the batch.
+            *   @param a_id is a string that is assigned this value.
+            *   @param a_value is the float value.
+            */
+            void SetFloatMemory(std::string a_id, float a_value);
+
+            /**
+            *   Adds a write of a global bool value to the batch.
+            *   @param a_id is a string that is assigned this value.
+            *   @param a_value is the bool value.
+            */
+            void SetBoolMemory(std::string a_id, bool a_value);
+
+            /**
+            *   Adds a write of a global std::string value to the batch.
+            *   @param a_id is a string that is assigned this value.
+            *   @param a_value is the std::string value.
+            */
+            void SetStringMemory(std::string a_id, std::string a_value);
+
+            /**
+            *   Adds a write of a global iga::bt::BlackBoardVector2 value to the batch.
+            *   @param a_id is a string that is assigned this value.
+            *   @param a_value is the iga::bt::BlackBoardVector2 value.
+            */
+            void SetVector2Memory(std::string a_id, const BlackBoardVector2& a_value);
+
+            /**
+            *   Adds a write of a global iga::bt::BlackBoardVector4 value to the batch.
+            *   @param a_id is a string that is assigned this value.
+            *   @param a_value is the iga::bt::BlackBoardVector4 value.
+            */
+            void SetVector4Memory(std::string a_id, const BlackBoardVector4& a_value);
+
+            /**
+            *   Adds a write of a global iga::bt::BlackBoardEntity value to the batch.
+            *   @param a_id is a string that is assigned this value.
+            *   @param a_value is the iga::bt::BlackBoardEntity value.
+            */
+            void SetEntityMemory(std::string a_id, const BlackBoardEntity& a_value);
+
+            /**
+            *   Returns whether the batch has no writes.
+            *   @return bool - If True ~ The batch is empty.
+            */
+            bool IsEmpty() const;
+
+        private:
+
+            friend class BlackBoard;
+
+            /**
+            *   Adds a write to the batch.
+            *   @param BlackBoardWrite a_write The write. The batch becomes its owner.
+            */
+            void AddWrite(BlackBoardWrite* a_write);
+
+            BlackBoardWrite* newest_ = nullptr; /** Newest write of the batch, the writes are linked from newest to oldest. */
+
+            BlackBoardWrite* oldest_ = nullptr; /** Oldest write of the batch. */
+
+        };
+
         class BlackBoard final {
         public:
-            /** BlackBoard Constructor */
-            BlackBoard();
+
+            friend class BTTimerWheel;
+            friend class BlackBoardSnapshot;
+
+            /**
+            *   Callback of a subscription to a blackboard value.
+            *   @param std::string a_id ID of the value that changed.
+            *   @param BlackBoardTypes a_type Type of the value that changed.
+            */
+            typedef std::function<void(const std::string& a_id, BlackBoardTypes a_type)> ChangeCallback;
+
+            typedef std::uint32_t SubscriptionID; /**< ID of a subscription, 0 is never used. */
+
+            /**
+            *   BlackBoard Constructor
+            *   @param BlackBoardScope a_scope The level of the blackboard in the scope hierarchy.
+            */
+            BlackBoard(BlackBoardScope a_scope = BlackBoardScope::AGENT);
 
             /** BlackBoard Destructor */
             ~BlackBoard();
 
+            /**
+            *   Removes all values and pending writes from the blackboard. The maps only keep their bucket arrays;
+            *   every value and its key get freed, and allocated again when they get written.
+            */
+            void Clear();
+
+            /**
+            *   Returns the level of the blackboard in the scope hierarchy.
+            *   @return BlackBoardScope value.
+            */
+            BlackBoardScope GetScope() const;
+
+            /**
+            *   Sets the scope that global values get resolved through when this blackboard doesn't have them.
+            *   Has to be called outside of the tick of the behaviour tree.
+            *   @param std::shared_ptr<const BlackBoard> a_parent The parent scope, nullptr detaches the blackboard.
+            *   The parent has to be a broader scope than this blackboard.
+            *   @return bool - If True ~ The parent has been set.
+            */
+            bool SetParent(std::shared_ptr<const BlackBoard> a_parent);
+
+            /**
+            *   Returns the parent scope of the blackboard.
+            *   @return std::shared_ptr<const BlackBoard> reference, nullptr if the blackboard has no parent.
+            */
+            const std::shared_ptr<const BlackBoard>& GetParent() const;
+
+#pragma region BlackBoard Versions
+
+            /**
+            *   Returns the version of the last change of the blackboard or one of its parent scopes.
+            *   @return std::uint64_t value, 0 if nothing has been set yet.
+            */
+            std::uint64_t GetVersion() const;
+
+            /**
+            *   Returns the version of the last change of a global value. Resolves through the parent scopes
+            *   if the blackboard doesn't have it.
+            *   @param std::string a_id ID of the value.
+            *   @param BlackBoardTypes a_type Type of the value.
+            *   @return std::uint64_t value, 0 if no scope has the value.
+            */
+            std::uint64_t GetVersion(const std::string& a_id, BlackBoardTypes a_type) const;
+
+            /**
+            *   Returns whether a global value changed after a version, resolving it through the parent scopes.
+            *   A value counts as changed if a value got removed from a closer scope than the one that has it,
+            *   or if anything changed while no scope has it; it may have expired.
+            *   @param std::string a_id ID of the value.
+            *   @param BlackBoardTypes a_type Type of the value.
+            *   @param std::uint64_t a_version The version, usually an earlier result of GetVersion.
+            *   @return bool - If True ~ The value changed after the version.
+            */
+            bool HasChangedSince(const std::string& a_id, BlackBoardTypes a_type, std::uint64_t a_version) const;
+
+            /**
+            *   Subscribes a callback to a value. The callback gets called by the setter, whenever the value changes.
+            *   Callbacks must not subscribe or unsubscribe. Recycling the behaviour tree of the blackboard, e.g. by
+            *   iga::bt::BTTreePool, removes all subscriptions; Clear and restoring a snapshot keep them.
+            *   @param std::string a_id ID of the value, including the node index for values in the scope of a node.
+            *   @param BlackBoardTypes a_type Type of the value.
+            *   @param ChangeCallback a_callback The callback.
+            *   @return SubscriptionID The ID of the subscription.
+            */
+            SubscriptionID Subscribe(std::string a_id, BlackBoardTypes a_type, ChangeCallback a_callback);
+
+            /**
+            *   Removes a subscription.
+            *   @param SubscriptionID a_subscription The ID of the subscription.
+            */
+            void Unsubscribe(SubscriptionID a_subscription);
+
+            /** Removes all subscriptions. IDs of removed subscriptions don't get used again. */
+            void UnsubscribeAll();
+
+#pragma endregion End of BlackBoard Versions
+
+#pragma region BlackBoard Pending Writes
+
+            /**
+            *   Posts the writes of a batch. Lock-free, may be called from any thread while the blackboard exists.
+            *   The writes get applied by the next PublishPendingWrites, all at once.
+            *   @param BlackBoardWriteBatch a_batch The writes. Empty after the call.
+            */
+            void PostWrites(BlackBoardWriteBatch& a_batch);
+
+            /**
+            *   Posts a write of a global integer value. Lock-free, may be called from any thread.
+            *   @param a_id is a string that is assigned this value.
+            *   @param a_value is the integer value.
+            */
+            void PostIntMemory(std::string a_id, int a_value);
+
+            /**
+            *   Posts a write of a global float value. Lock-free, may be called from any thread.
+            *   @param a_id is a string that is assigned this value.
+            *   @param a_value is the float value.
+            */
+            void PostFloatMemory(std::string a_id, float a_value);
+
+            /**
+            *   Posts a write of a global bool value. Lock-free, may be called from any thread.
+            *   @param a_id is a string that is assigned this value.
+            *   @param a_value is the bool value.
+            */
+            void PostBoolMemory(std::string a_id, bool a_value);
+
+            /**
+            *   Posts a write of a global std::string value. Lock-free, may be called from any thread.
+            *   @param a_id is a string that is assigned this value.
+            *   @param a_value is the std::string value.
+            */
+            void PostStringMemory(std::string a_id, std::string a_value);
+
+            /**
+            *   Posts a write of a global iga::bt::BlackBoardVector2 value. Lock-free, may be called from any thread.
+            *   @param a_id is a string that is assigned this value.
+            *   @param a_value is the iga::bt::BlackBoardVector2 value.
+            */
+            void PostVector2Memory(std::string a_id, const BlackBoardVector2& a_value);
+
+            /**
+            *   Posts a write of a global iga::bt::BlackBoardVector4 value. Lock-free, may be called from any thread.
+            *   @param a_id is a string that is assigned this value.
+            *   @param a_value is the iga::bt::BlackBoardVector4 value.
+            */
+            void PostVector4Memory(std::string a_id, const BlackBoardVector4& a_value);
+
+            /**
+            *   Posts a write of a global iga::bt::BlackBoardEntity value. Lock-free, may be called from any thread.
+            *   @param a_id is a string that is assigned this value.
+            *   @param a_value is the iga::bt::BlackBoardEntity value.
+            */
+            void PostEntityMemory(std::string a_id, const BlackBoardEntity& a_value);
+
+            /**
+            *   Returns whether writes have been posted that aren't published yet.
+            *   @return bool - If True ~ There are pending writes.
+            */
+            bool HasPendingWrites() const;
+
+            /**
+            *   Applies the posted writes in the order that they were posted. Has to be called by the thread
+            *   that owns the blackboard, while nothing reads it; the behaviour tree of the blackboard calls it
+            *   at the start of its tick.
+            *   @return bool - If True ~ Writes have been applied.
+            */
+            bool PublishPendingWrites();
+
+#pragma endregion End of BlackBoard Pending Writes
+
+#pragma region BlackBoard Snapshots
+
+            /**
+            *   Writes the values of the blackboard into a binary snapshot, see iga::bt::BlackBoardSnapshot.
+            *   @param std::vector<char> a_data The container that the snapshot gets written to.
+            *   @return bool - If True ~ The snapshot has been written.
+            */
+            bool WriteSnapshot(std::vector<char>& a_data) const;
+
+            /**
+            *   Replaces the values of the blackboard with the values of a binary snapshot, see iga::bt::BlackBoardSnapshot.
+            *   @param const char* a_data The snapshot.
+            *   @param std::size_t a_size Size of the snapshot.
+            *   @return bool - If True ~ The snapshot is valid and has been restored.
+            */
+            bool RestoreSnapshot(const char* a_data, std::size_t a_size);
+
+#pragma endregion End of BlackBoard Snapshots
+
 #pragma region BlackBoard Memory Setters
 
             /**
@@ -46,6 +403,14 @@ namespace iga {
             */
             void SetGlobalIntMemory(std::string a_id, int a_value);
 
+            /**
+            *   Stores a copy of the integer with a string ID, until its time to live runs out.
+            *   @param a_id is a string that is assigned this value.
+            *   @param a_value is the integer value that you want to store inside of the blackboard.
+            *   @param a_time_to_live is the time in seconds after which the value gets removed.
+            */
+            void SetGlobalIntMemory(std::string a_id, int a_value, float a_time_to_live);
+
             /**
             *   Stores a copy of the integer inside of the std::map of the blackboard with a string ID
             *   in the scope of the node.
@@ -62,6 +427,14 @@ namespace iga {
             */
             void SetGlobalFloatMemory(std::string a_id, float a_value);
 
+            /**
+            *   Stores a copy of the float with a string ID, until its time to live runs out.
+            *   @param a_id is a string that is assigned this value.
+            *   @param a_value is the float value that you want to store inside of the blackboard.
+            *   @param a_time_to_live is the time in seconds after which the value gets removed.
+            */
+            void SetGlobalFloatMemory(std::string a_id, float a_value, float a_time_to_live);
+
             /**
             *   Stores a copy of the float inside of the std::map of the blackboard with a string ID.
             *   in the scope of the node.
@@ -78,6 +451,14 @@ namespace iga {
             */
             void SetGlobalBoolMemory(std::string a_id, bool a_value);
 
+            /**
+            *   Stores a copy of the bool with a string ID, until its time to live runs out.
+            *   @param a_id is a string that is assigned this value.
+            *   @param a_value is the bool value that you want to store inside of the blackboard.
+            *   @param a_time_to_live is the time in seconds after which the value gets removed.
+            */
+            void SetGlobalBoolMemory(std::string a_id, bool a_value, float a_time_to_live);
+
             /**
             *   Stores a copy of the bool inside of the std::map of the blackboard with a string ID.
             *   in the scope of the node.
@@ -94,6 +475,14 @@ namespace iga {
             */
             void SetGlobalStringMemory(std::string a_id, std::string a_value);
 
+            /**
+            *   Stores a copy of the std::string with a string ID, until its time to live runs out.
+            *   @param a_id is a string that is assigned this value.
+            *   @param a_value is the std::string value that you want to store inside of the blackboard.
+            *   @param a_time_to_live is the time in seconds after which the value gets removed.
+            */
+            void SetGlobalStringMemory(std::string a_id, std::string a_value, float a_time_to_live);
+
             /**
             *   Stores a copy of the std::string inside of the std::map of the blackboard with a string ID.
             *   in the scope of the node.
@@ -103,13 +492,85 @@ namespace iga {
             */
             void SetStringMemory(std::string a_id, BaseNode* a_node, std::string a_value);
 
+            /**
+            *   Stores a copy of the iga::bt::BlackBoardVector2 inside of the std::map of the blackboard with a string ID.
+            *   @param a_id is a string that is assigned to this value.
+            *   @param a_value is the iga::bt::BlackBoardVector2 value that you want to store inside of the blackboard.
+            */
+            void SetGlobalVector2Memory(std::string a_id, const BlackBoardVector2& a_value);
+
+            /**
+            *   Stores a copy of the iga::bt::BlackBoardVector2 with a string ID, until its time to live runs out.
+            *   @param a_id is a string that is assigned this value.
+            *   @param a_value is the iga::bt::BlackBoardVector2 value that you want to store inside of the blackboard.
+            *   @param a_time_to_live is the time in seconds after which the value gets removed.
+            */
+            void SetGlobalVector2Memory(std::string a_id, const BlackBoardVector2& a_value, float a_time_to_live);
+
+            /**
+            *   Stores a copy of the iga::bt::BlackBoardVector2 inside of the std::map of the blackboard with a string ID
+            *   in the scope of the node.
+            *   @param a_id is a string that is assigned to this value.
+            *   @param a_node is a pointer to the node that will have access to this memory value.
+            *   @param a_value is the iga::bt::BlackBoardVector2 value that you want to store inside of the blackboard.
+            */
+            void SetVector2Memory(std::string a_id, BaseNode* a_node, const BlackBoardVector2& a_value);
+
+            /**
+            *   Stores a copy of the iga::bt::BlackBoardVector4 inside of the std::map of the blackboard with a string ID.
+            *   @param a_id is a string that is assigned to this value.
+            *   @param a_value is the iga::bt::BlackBoardVector4 value that you want to store inside of the blackboard.
+            */
+            void SetGlobalVector4Memory(std::string a_id, const BlackBoardVector4& a_value);
+
+            /**
+            *   Stores a copy of the iga::bt::BlackBoardVector4 with a string ID, until its time to live runs out.
+            *   @param a_id is a string that is assigned this value.
+            *   @param a_value is the iga::bt::BlackBoardVector4 value that you want to store inside of the blackboard.
+            *   @param a_time_to_live is the time in seconds after which the value gets removed.
+            */
+            void SetGlobalVector4Memory(std::string a_id, const BlackBoardVector4& a_value, float a_time_to_live);
+
+            /**
+            *   Stores a copy of the iga::bt::BlackBoardVector4 inside of the std::map of the blackboard with a string ID
+            *   in the scope of the node.
+            *   @param a_id is a string that is assigned to this value.
+            *   @param a_node is a pointer to the node that will have access to this memory value.
+            *   @param a_value is the iga::bt::BlackBoardVector4 value that you want to store inside of the blackboard.
+            */
+            void SetVector4Memory(std::string a_id, BaseNode* a_node, const BlackBoardVector4& a_value);
+
+            /**
+            *   Stores a copy of the iga::bt::BlackBoardEntity inside of the std::map of the blackboard with a string ID.
+            *   @param a_id is a string that is assigned to this value.
+            *   @param a_value is the iga::bt::BlackBoardEntity value that you want to store inside of the blackboard.
+            */
+            void SetGlobalEntityMemory(std::string a_id, const BlackBoardEntity& a_value);
+
+            /**
+            *   Stores a copy of the iga::bt::BlackBoardEntity with a string ID, until its time to live runs out.
+            *   @param a_id is a string that is assigned this value.
+            *   @param a_value is the iga::bt::BlackBoardEntity value that you want to store inside of the blackboard.
+            *   @param a_time_to_live is the time in seconds after which the value gets removed.
+            */
+            void SetGlobalEntityMemory(std::string a_id, const BlackBoardEntity& a_value, float a_time_to_live);
+
+            /**
+            *   Stores a copy of the iga::bt::BlackBoardEntity inside of the std::map of the blackboard with a string ID
+            *   in the scope of the node.
+            *   @param a_id is a string that is assigned to this value.
+            *   @param a_node is a pointer to the node that will have access to this memory value.
+            *   @param a_value is the iga::bt::BlackBoardEntity value that you want to store inside of the blackboard.
+            */
+            void SetEntityMemory(std::string a_id, BaseNode* a_node, const BlackBoardEntity& a_value);
+
 #pragma endregion End of Blackboard Memory Setters
 
 #pragma region BlackBoard Memory Getters
 
             /**
             *   Sets the value of the passed through item to the value that was stored 
-            *   inside of the blackboard.
+            *   inside of the blackboard. Resolves through the parent scopes if the blackboard doesn't have it.
             *   @param a_id is the string to access the value inside of the std::map.
             *   @param a_int_ref is the container that you want to store the value in.
             *   @return bool - If True ~ Value with ID has been found.
@@ -128,7 +589,7 @@ namespace iga {
 
             /**
             *   Sets the value of the passed through item to the value that was stored
-            *   inside of the blackboard.
+            *   inside of the blackboard. Resolves through the parent scopes if the blackboard doesn't have it.
             *   @param a_id is the string to access the value inside of the std::map.
             *   @param a_float_ref is the container that you want to store the value in.
             *   @return bool - If True ~ Value with ID has been found.
@@ -147,7 +608,7 @@ namespace iga {
 
             /**
             *   Sets the value of the passed through item to the value that was stored
-            *   inside of the blackboard.
+            *   inside of the blackboard. Resolves through the parent scopes if the blackboard doesn't have it.
             *   @param a_id is the string to access the value inside of the std::map.
             *   @param a_bool_ref is the container that you want to store the value in.
             *   @return bool - If True ~ Value with ID has been found.
@@ -166,7 +627,7 @@ namespace iga {
 
             /**
             *   Sets the value of the passed through item to the value that was stored
-            *   inside of the blackboard.
+            *   inside of the blackboard. Resolves through the parent scopes if the blackboard doesn't have it.
             *   @param a_id is the string to access the value inside of the std::map.
             *   @param a_string_ref is the container that you want to store the value in.
             *   @return bool - If True ~ Value with ID has been found.
@@ -183,17 +644,193 @@ namespace iga {
             */
             bool GetStringMemory(std::string a_id, BaseNode* a_node, std::string& a_string_ref) const;
 
+            /**
+            *   Sets the value of the passed through item to the value that was stored
+            *   inside of the blackboard. Resolves through the parent scopes if the blackboard doesn't have it.
+            *   @param a_id is the string to access the value inside of the std::map.
+            *   @param a_vector2_ref is the container that you want to store the value in.
+            *   @return bool - If True ~ Value with ID has been found.
+            */
+            bool GetVector2Memory(const std::string& a_id, BlackBoardVector2& a_vector2_ref) const;
+
+            /**
+            *   Sets the value of the passed through item to the value that was stored
+            *   inside of the blackboard.
+            *   @param a_id is the string to access the value inside of the std::map.
+            *   @param a_node is a pointer to the node that will have access to this memory value.
+            *   @param a_vector2_ref is the container that you want to store the value in.
+            *   @return bool - If True ~ Value with ID has been found.
+            */
+            bool GetVector2Memory(std::string a_id, BaseNode* a_node, BlackBoardVector2& a_vector2_ref) const;
+
+            /**
+            *   Sets the value of the passed through item to the value that was stored
+            *   inside of the blackboard. Resolves through the parent scopes if the blackboard doesn't have it.
+            *   @param a_id is the string to access the value inside of the std::map.
+            *   @param a_vector4_ref is the container that you want to store the value in.
+            *   @return bool - If True ~ Value with ID has been found.
+            */
+            bool GetVector4Memory(const std::string& a_id, BlackBoardVector4& a_vector4_ref) const;
+
+            /**
+            *   Sets the value of the passed through item to the value that was stored
+            *   inside of the blackboard.
+            *   @param a_id is the string to access the value inside of the std::map.
+            *   @param a_node is a pointer to the node that will have access to this memory value.
+            *   @param a_vector4_ref is the container that you want to store the value in.
+            *   @return bool - If True ~ Value with ID has been found.
+            */
+            bool GetVector4Memory(std::string a_id, BaseNode* a_node, BlackBoardVector4& a_vector4_ref) const;
+
+            /**
+            *   Sets the value of the passed through item to the value that was stored
+            *   inside of the blackboard. Resolves through the parent scopes if the blackboard doesn't have it.
+            *   @param a_id is the string to access the value inside of the std::map.
+            *   @param a_entity_ref is the container that you want to store the value in.
+            *   @return bool - If True ~ Value with ID has been found.
+            */
+            bool GetEntityMemory(const std::string& a_id, BlackBoardEntity& a_entity_ref) const;
+
+            /**
+            *   Sets the value of the passed through item to the value that was stored
+            *   inside of the blackboard.
+            *   @param a_id is the string to access the value inside of the std::map.
+            *   @param a_node is a pointer to the node that will have access to this memory value.
+            *   @param a_entity_ref is the container that you want to store the value in.
+            *   @return bool - If True ~ Value with ID has been found.
+            */
+            bool GetEntityMemory(std::string a_id, BaseNode* a_node, BlackBoardEntity& a_entity_ref) const;
+
 #pragma endregion End of BlackBoard Memory Getters
 
         private:
 
-            std::unordered_map<std::string, int> int_memory_; /** Unordered std::string~integer map - Stores values for the BehaviourTree. */
+            /**
+            *   iga::bt::BlackBoard::Subscription; A callback that is subscribed to a value.
+            */
+            struct Subscription {
+                SubscriptionID id;          /**< ID of the subscription. */
+                BlackBoardTypes type;       /**< Type of the value. */
+                ChangeCallback callback;    /**< The callback. */
+            };
+
+            /**
+            *   Stores a value with a single lookup. Bumps the version of the value and notifies the
+            *   subscriptions if the value changed.
+            *   @param std::unordered_map<std::string, BlackBoardValue<T>> a_memory The map of the type.
+            *   @param std::string a_id ID of the value.
+            *   @param T a_value The value.
+            *   @param BlackBoardTypes a_type Type of the value.
+            *   @param std::uint64_t a_expiry_tick Tick at which the value expires, 0 if it never does.
+            */
+            template<typename T>
+            void SetMemory(std::unordered_map<std::string, BlackBoardValue<T>>& a_memory, std::string&& a_id, T&& a_value, BlackBoardTypes a_type, std::uint64_t a_expiry_tick);
+
+            /**
+            *   Looks up a global value, closest scope first.
+            *   @param std::unordered_map<std::string, BlackBoardValue<T>> BlackBoard::* a_memory The map of the type.
+            *   @param std::string a_id ID of the value.
+            *   @param T a_ref The container that the value gets stored in.
+            *   @return bool - If True ~ Value with ID has been found.
+            */
+            template<typename T>
+            bool GetMemory(std::unordered_map<std::string, BlackBoardValue<T>> BlackBoard::* a_memory, const std::string& a_id, T& a_ref) const;
+
+            /**
+            *   Returns the version of the last change of a global value of this blackboard only.
+            *   @param std::string a_id ID of the value.
+            *   @param BlackBoardTypes a_type Type of the value.
+            *   @return std::uint64_t value, 0 if this blackboard doesn't have the value.
+            */
+            std::uint64_t GetScopeVersion(const std::string& a_id, BlackBoardTypes a_type) const;
+
+            /**
+            *   Returns the tick of iga::bt::BTTimerWheel at which a value with a time to live expires.
+            *   @param float a_time_to_live Time to live of the value in seconds.
+            *   @return std::uint64_t value.
+            */
+            std::uint64_t GetExpiryTick(float a_time_to_live);
+
+            /**
+            *   Makes sure that a value has a timer that fires no later than the value expires.
+            *   @param BlackBoardValue<T> a_entry The value.
+            *   @param std::string a_id ID of the value.
+            *   @param BlackBoardTypes a_type Type of the value.
+            */
+            template<typename T>
+            void ScheduleExpiry(BlackBoardValue<T>& a_entry, const std::string& a_id, BlackBoardTypes a_type);
+
+            /**
+            *   Returns the registration of the blackboard with iga::bt::BTTimerWheel, registers it on the first call.
+            *   @return std::uint64_t value.
+            */
+            std::uint64_t GetTimerOwner();
+
+            /**
+            *   Handles the timer of a value. Gets called by iga::bt::BTTimerWheel.
+            *   @param std::string a_id ID of the value.
+            *   @param BlackBoardTypes a_type Type of the value.
+            *   @param std::uint64_t a_timer_tick The tick at which the timer fired.
+            */
+            void ExpireMemory(const std::string& a_id, BlackBoardTypes a_type, std::uint64_t a_timer_tick);
+
+            /**
+            *   Handles the timer of a value of a type; removes the value if it expired, or reschedules the
+            *   timer if the value got written again with a later expiry since.
+            *   @param std::unordered_map<std::string, BlackBoardValue<T>> a_memory The map of the type.
+            *   @param std::string a_id ID of the value.
+            *   @param BlackBoardTypes a_type Type of the value.
+            *   @param std::uint64_t a_timer_tick The tick at which the timer fired.
+            */
+            template<typename T>
+            void ExpireMemory(std::unordered_map<std::string, BlackBoardValue<T>>& a_memory, const std::string& a_id, BlackBoardTypes a_type, std::uint64_t a_timer_tick);
+
+            /**
+            *   Calls the callbacks that are subscribed to a value.
+            *   @param std::string a_id ID of the value.
+            *   @param BlackBoardTypes a_type Type of the value.
+            */
+            void NotifySubscriptions(const std::string& a_id, BlackBoardTypes a_type);
+
+            /**
+            *   Changes the memory totals of the blackboard and reports the change to iga::bt::BTRuntimeStats.
+            *   @param std::int64_t a_entries Amount of entries that got added.
+            *   @param std::int64_t a_bytes Amount of bytes that got added. Negative when bytes got removed.
+            */
+            void CountMemoryChange(std::int64_t a_entries, std::int64_t a_bytes);
+
+            BlackBoardScope scope_; /** Level of the blackboard in the scope hierarchy. */
+
+            std::shared_ptr<const BlackBoard> parent_; /** Scope that global values get resolved through. */
+
+            std::atomic<BlackBoardWrite*> pending_writes_; /** Lock-free stack of posted writes, newest first. */
+
+            std::uint64_t timer_owner_ = 0; /** Registration with iga::bt::BTTimerWheel, 0 until the first value with a time to live. */
+
+            std::int64_t memory_entries_ = 0; /** Amount of values stored in the blackboard. */
+
+            std::int64_t memory_bytes_ = 0; /** Estimated bytes of keys and values stored in the blackboard. */
+
+            std::uint64_t version_ = 0; /** Version of the last change of the blackboard. */
+            std::uint64_t removal_version_ = 0; /** Version of the last removal of a value or change of the parent. */
+
+            SubscriptionID next_subscription_id_ = 1; /** ID of the next subscription. */
+
+            std::unordered_map<std::string, std::vector<Subscription>> subscriptions_; /** Subscriptions, by ID of the value. */
+
+            std::unordered_map<std::string, BlackBoardValue<int>> int_memory_; /** Unordered std::string~integer map - Stores values for the BehaviourTree. */
+
+            std::unordered_map<std::string, BlackBoardValue<float>> float_memory_; /** Unordered std::string~float map - Stores values for the BehaviourTree. */
+
+            std::unordered_map<std::string, BlackBoardValue<bool>> bool_memory_; /** Unordered std::string~bool map - Stores values for the BehaviourTree. */
+
+            std::unordered_map<std::string, BlackBoardValue<std::string>> string_memory_; /** Unordered std::string~std::string map - Stores values for the BehaviourTree. */
 
-            std::unordered_map<std::string, float> float_memory_; /** Unordered std::string~float map - Stores values for the BehaviourTree. */
+            std::unordered_map<std::string, BlackBoardValue<BlackBoardVector2>> vector2_memory_; /** Unordered std::string~iga::bt::BlackBoardVector2 map - Stores values for the BehaviourTree. */
 
-            std::unordered_map<std::string, bool> bool_memory_; /** Unordered std::string~bool map - Stores values for the BehaviourTree. */
+            std::unordered_map<std::string, BlackBoardValue<BlackBoardVector4>> vector4_memory_; /** Unordered std::string~iga::bt::BlackBoardVector4 map - Stores values for the BehaviourTree. */
 
-            std::unordered_map<std::string, std::string> string_memory_; /** Unordered std::string~std::string map - Stores values for the BehaviourTree. */
+            std::unordered_map<std::string, BlackBoardValue<BlackBoardEntity>> entity_memory_; /** Unordered std::string~iga::bt::BlackBoardEntity map - Stores values for the BehaviourTree. */
 
     };
 
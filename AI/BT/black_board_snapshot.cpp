@@ -0,0 +1,310 @@
+#include <AI/BT/black_board_snapshot.h>
+
+#include <AI/BT/black_board.h>
+#include <AI/BT/bt_runtime_asset.h>
+#include <AI/BT/bt_timer_wheel.h>
+
+#include <algorithm>
+#include <cstdint>
+#include <cstring>
+#include <iostream>
+#include <limits>
+#include <string>
+#include <unordered_map>
+#include <utility>
+
+namespace {
+
+    /** The tables that records refer to. */
+    struct SnapshotTables {
+        iga::bt::BTRuntimeStringTable strings;                      /**< Keys and string values. */
+        std::vector<iga::bt::BlackBoardSnapshotValue> values;       /**< Vector and entity values. */
+    };
+
+    /** Returns the bits of a value as they are stored in a record. */
+    std::uint32_t EncodeValue(int a_value, SnapshotTables& /*a_tables*/) {
+        std::uint32_t bits;
+        std::memcpy(&bits, &a_value, sizeof(bits));
+        return bits;
+    }
+
+    std::uint32_t EncodeValue(float a_value, SnapshotTables& /*a_tables*/) {
+        std::uint32_t bits;
+        std::memcpy(&bits, &a_value, sizeof(bits));
+        return bits;
+    }
+
+    std::uint32_t EncodeValue(bool a_value, SnapshotTables& /*a_tables*/) {
+        return a_value ? 1 : 0;
+    }
+
+    std::uint32_t EncodeValue(const std::string& a_value, SnapshotTables& a_tables) {
+        return a_tables.strings.Intern(a_value);
+    }
+
+    /** Vectors and entities are stored in the value table, the record holds their index. */
+    template<typename T>
+    std::uint32_t EncodeValue(const T& a_value, SnapshotTables& a_tables) {
+        static_assert(sizeof(T) <= sizeof(iga::bt::BlackBoardSnapshotValue), "Value doesn't fit into the value table.");
+
+        iga::bt::BlackBoardSnapshotValue value = {};
+        std::memcpy(value.words, &a_value, sizeof(T));
+        a_tables.values.push_back(value);
+        return static_cast<std::uint32_t>(a_tables.values.size() - 1);
+    }
+
+    /** Returns a vector or entity value of the value table. */
+    template<typename T>
+    T DecodeValue(const iga::bt::BlackBoardSnapshotValue* a_values, std::uint32_t a_index) {
+        T value;
+        std::memcpy(&value, a_values[a_index].words, sizeof(T));
+        return value;
+    }
+
+    /** Appends a record for every value of a map. */
+    template<typename T>
+    void WriteRecords(const std::unordered_map<std::string, iga::bt::BlackBoardValue<T>>& a_memory, iga::bt::BlackBoardTypes a_type, std::uint64_t a_current_tick,
+        SnapshotTables& a_tables, std::vector<iga::bt::BlackBoardSnapshotRecord>& a_records)
+    {
+        for (auto& entry : a_memory) {
+            iga::bt::BlackBoardSnapshotRecord record;
+            record.key = a_tables.strings.Intern(entry.first);
+            record.type = static_cast<std::uint32_t>(a_type);
+            record.value = EncodeValue(entry.second.value, a_tables);
+            record.ticks_to_live = 0;
+
+            // A value that is due but hasn't been expired yet expires on the first tick after the restore.
+            if (entry.second.expiry_tick != 0) {
+                std::uint64_t ticks = (entry.second.expiry_tick > a_current_tick) ? (entry.second.expiry_tick - a_current_tick) : 1;
+                record.ticks_to_live = static_cast<std::uint32_t>(std::min<std::uint64_t>(ticks, std::numeric_limits<std::uint32_t>::max()));
+            }
+
+            a_records.push_back(record);
+        }
+    }
+
+}
+
+namespace iga {
+
+    namespace bt {
+
+        bool BlackBoardSnapshot::Write(const std::vector<const BlackBoard*>& a_blackboards, std::vector<char>& a_data) {
+            std::uint64_t current_tick = BTTimerWheel::Get().GetCurrentTick();
+
+            SnapshotTables tables;
+            std::vector<BlackBoardSnapshotRange> ranges;
+            std::vector<BlackBoardSnapshotRecord> records;
+            ranges.reserve(a_blackboards.size());
+
+            for (const BlackBoard* blackboard : a_blackboards) {
+                BlackBoardSnapshotRange range;
+                range.first_record = static_cast<std::uint32_t>(records.size());
+
+                if (blackboard != nullptr) {
+                    WriteRecords(blackboard->int_memory_, BlackBoardTypes::INT, current_tick, tables, records);
+                    WriteRecords(blackboard->float_memory_, BlackBoardTypes::FLOAT, current_tick, tables, records);
+                    WriteRecords(blackboard->bool_memory_, BlackBoardTypes::BOOL, current_tick, tables, records);
+                    WriteRecords(blackboard->string_memory_, BlackBoardTypes::STRING, current_tick, tables, records);
+                    WriteRecords(blackboard->vector2_memory_, BlackBoardTypes::VECTOR2, current_tick, tables, records);
+                    WriteRecords(blackboard->vector4_memory_, BlackBoardTypes::VECTOR4, current_tick, tables, records);
+                    WriteRecords(blackboard->entity_memory_, BlackBoardTypes::ENTITY, current_tick, tables, records);
+                }
+
+                range.record_count = static_cast<std::uint32_t>(records.size()) - range.first_record;
+                ranges.push_back(range);
+            }
+
+            const std::vector<char>& string_table = tables.strings.GetData();
+
+            std::uint64_t range_table_offset = sizeof(BlackBoardSnapshotHeader);
+            std::uint64_t record_table_offset = range_table_offset + ranges.size() * sizeof(BlackBoardSnapshotRange);
+            std::uint64_t value_table_offset = record_table_offset + records.size() * sizeof(BlackBoardSnapshotRecord);
+            std::uint64_t string_table_offset = value_table_offset + tables.values.size() * sizeof(BlackBoardSnapshotValue);
+            std::uint64_t size = string_table_offset + string_table.size();
+
+            if (size > std::numeric_limits<std::uint32_t>::max()) {
+                std::cout << "ERROR - Behaviour Tree System - Blackboard snapshot is too big." << std::endl;
+                return false;
+            }
+
+            BlackBoardSnapshotHeader header;
+            header.magic                = magic_;
+            header.version              = version_;
+            header.size                 = static_cast<std::uint32_t>(size);
+            header.blackboard_count     = static_cast<std::uint32_t>(ranges.size());
+            header.range_table_offset   = static_cast<std::uint32_t>(range_table_offset);
+            header.record_count         = static_cast<std::uint32_t>(records.size());
+            header.record_table_offset  = static_cast<std::uint32_t>(record_table_offset);
+            header.value_count          = static_cast<std::uint32_t>(tables.values.size());
+            header.value_table_offset   = static_cast<std::uint32_t>(value_table_offset);
+            header.string_table_offset  = static_cast<std::uint32_t>(string_table_offset);
+            header.string_table_size    = static_cast<std::uint32_t>(string_table.size());
+
+            a_data.resize(static_cast<std::size_t>(size));
+            char* data = a_data.data();
+
+            std::memcpy(data, &header, sizeof(header));
+            if (!ranges.empty()) {
+                std::memcpy(data + header.range_table_offset, ranges.data(), ranges.size() * sizeof(BlackBoardSnapshotRange));
+            }
+            if (!records.empty()) {
+                std::memcpy(data + header.record_table_offset, records.data(), records.size() * sizeof(BlackBoardSnapshotRecord));
+            }
+            if (!tables.values.empty()) {
+                std::memcpy(data + header.value_table_offset, tables.values.data(), tables.values.size() * sizeof(BlackBoardSnapshotValue));
+            }
+            if (!string_table.empty()) {
+                std::memcpy(data + header.string_table_offset, string_table.data(), string_table.size());
+            }
+
+            return true;
+        }
+
+        bool BlackBoardSnapshot::Read(const char* a_data, std::size_t a_size, const std::vector<BlackBoard*>& a_blackboards) {
+            const BlackBoardSnapshotHeader* header = Validate(a_data, a_size);
+            if (header == nullptr) { return false; }
+
+            if (header->blackboard_count != a_blackboards.size()) {
+                std::cout << "ERROR - Behaviour Tree System - Blackboard snapshot has " << header->blackboard_count << " blackboards, " << a_blackboards.size() << " were passed." << std::endl;
+                return false;
+            }
+
+            const BlackBoardSnapshotRange* ranges = reinterpret_cast<const BlackBoardSnapshotRange*>(a_data + header->range_table_offset);
+            const BlackBoardSnapshotRecord* records = reinterpret_cast<const BlackBoardSnapshotRecord*>(a_data + header->record_table_offset);
+            const BlackBoardSnapshotValue* values = reinterpret_cast<const BlackBoardSnapshotValue*>(a_data + header->value_table_offset);
+            const char* strings = a_data + header->string_table_offset;
+
+            for (std::size_t i = 0; i < a_blackboards.size(); ++i) {
+                BlackBoard* blackboard = a_blackboards[i];
+                if (blackboard == nullptr) { continue; }
+
+                blackboard->Clear();
+
+                const BlackBoardSnapshotRecord* record = records + ranges[i].first_record;
+                const BlackBoardSnapshotRecord* end = record + ranges[i].record_count;
+                for (; record != end; ++record) {
+                    BlackBoardTypes type = static_cast<BlackBoardTypes>(record->type);
+                    std::string id(strings + record->key);
+
+                    std::uint64_t expiry_tick = 0;
+                    if (record->ticks_to_live != 0) {
+                        expiry_tick = BTTimerWheel::Get().GetExpiryTickIn(record->ticks_to_live);
+                    }
+
+                    switch (type) {
+                    case BlackBoardTypes::INT: {
+                        int value;
+                        std::memcpy(&value, &record->value, sizeof(value));
+                        blackboard->SetMemory(blackboard->int_memory_, std::move(id), std::move(value), type, expiry_tick);
+                        break;
+                    }
+                    case BlackBoardTypes::FLOAT: {
+                        float value;
+                        std::memcpy(&value, &record->value, sizeof(value));
+                        blackboard->SetMemory(blackboard->float_memory_, std::move(id), std::move(value), type, expiry_tick);
+                        break;
+                    }
+                    case BlackBoardTypes::BOOL:
+                        blackboard->SetMemory(blackboard->bool_memory_, std::move(id), record->value != 0, type, expiry_tick);
+                        break;
+                    case BlackBoardTypes::STRING:
+                        blackboard->SetMemory(blackboard->string_memory_, std::move(id), std::string(strings + record->value), type, expiry_tick);
+                        break;
+                    case BlackBoardTypes::VECTOR2:
+                        blackboard->SetMemory(blackboard->vector2_memory_, std::move(id), DecodeValue<BlackBoardVector2>(values, record->value), type, expiry_tick);
+                        break;
+                    case BlackBoardTypes::VECTOR4:
+                        blackboard->SetMemory(blackboard->vector4_memory_, std::move(id), DecodeValue<BlackBoardVector4>(values, record->value), type, expiry_tick);
+                        break;
+                    case BlackBoardTypes::ENTITY:
+                        blackboard->SetMemory(blackboard->entity_memory_, std::move(id), DecodeValue<BlackBoardEntity>(values, record->value), type, expiry_tick);
+                        break;
+                    }
+                }
+            }
+
+            return true;
+        }
+
+        std::uint32_t BlackBoardSnapshot::GetBlackBoardCount(const char* a_data, std::size_t a_size) {
+            const BlackBoardSnapshotHeader* header = Validate(a_data, a_size);
+            return (header != nullptr) ? header->blackboard_count : 0;
+        }
+
+        const BlackBoardSnapshotHeader* BlackBoardSnapshot::Validate(const char* a_data, std::size_t a_size) {
+            // Checks if a section lies inside of the snapshot.
+            auto in_bounds = [a_size](std::uint64_t a_offset, std::uint64_t a_section_size) {
+                return (a_offset + a_section_size) <= static_cast<std::uint64_t>(a_size);
+            };
+
+            if (a_data == nullptr || a_size < sizeof(BlackBoardSnapshotHeader)) {
+                std::cout << "ERROR - Behaviour Tree System - Blackboard snapshot is too small." << std::endl;
+                return nullptr;
+            }
+
+            // The tables are read in place.
+            if (reinterpret_cast<std::uintptr_t>(a_data) % alignof(BlackBoardSnapshotHeader) != 0) {
+                std::cout << "ERROR - Behaviour Tree System - Blackboard snapshot is not aligned." << std::endl;
+                return nullptr;
+            }
+
+            const BlackBoardSnapshotHeader* header = reinterpret_cast<const BlackBoardSnapshotHeader*>(a_data);
+
+            if (header->magic != magic_) {
+                std::cout << "ERROR - Behaviour Tree System - Data is not a blackboard snapshot." << std::endl;
+                return nullptr;
+            }
+
+            if (header->version != version_) {
+                std::cout << "ERROR - Behaviour Tree System - Blackboard snapshot version " << header->version << " is not supported." << std::endl;
+                return nullptr;
+            }
+
+            if ((header->size != a_size)                                                                                                        ||
+                (header->range_table_offset % alignof(BlackBoardSnapshotRange) != 0)                                                            ||
+                (header->record_table_offset % alignof(BlackBoardSnapshotRecord) != 0)                                                          ||
+                (header->value_table_offset % alignof(BlackBoardSnapshotValue) != 0)                                                            ||
+                (!in_bounds(header->range_table_offset, static_cast<std::uint64_t>(header->blackboard_count) * sizeof(BlackBoardSnapshotRange))) ||
+                (!in_bounds(header->record_table_offset, static_cast<std::uint64_t>(header->record_count) * sizeof(BlackBoardSnapshotRecord)))   ||
+                (!in_bounds(header->value_table_offset, static_cast<std::uint64_t>(header->value_count) * sizeof(BlackBoardSnapshotValue)))      ||
+                (!in_bounds(header->string_table_offset, header->string_table_size))                                                            ||
+                (header->string_table_size != 0 && a_data[header->string_table_offset + header->string_table_size - 1] != '\0')
+                )
+            {
+                std::cout << "ERROR - Behaviour Tree System - Blackboard snapshot is corrupt." << std::endl;
+                return nullptr;
+            }
+
+            const BlackBoardSnapshotRange* ranges = reinterpret_cast<const BlackBoardSnapshotRange*>(a_data + header->range_table_offset);
+            for (std::uint32_t i = 0; i < header->blackboard_count; ++i) {
+                if (static_cast<std::uint64_t>(ranges[i].first_record) + ranges[i].record_count > header->record_count) {
+                    std::cout << "ERROR - Behaviour Tree System - Blackboard snapshot has a corrupt blackboard: " << i << std::endl;
+                    return nullptr;
+                }
+            }
+
+            const BlackBoardSnapshotRecord* records = reinterpret_cast<const BlackBoardSnapshotRecord*>(a_data + header->record_table_offset);
+            for (std::uint32_t i = 0; i < header->record_count; ++i) {
+                const BlackBoardSnapshotRecord& record = records[i];
+
+                // Types after STRING store their value in the value table.
+                bool in_value_table = (record.type > static_cast<std::uint32_t>(BlackBoardTypes::STRING));
+
+                if ((record.key >= header->string_table_size)                                                           ||
+                    (record.type > static_cast<std::uint32_t>(BlackBoardTypes::ENTITY))                                 ||
+                    (record.type == static_cast<std::uint32_t>(BlackBoardTypes::STRING) && record.value >= header->string_table_size) ||
+                    (in_value_table && record.value >= header->value_count)
+                    )
+                {
+                    std::cout << "ERROR - Behaviour Tree System - Blackboard snapshot has a corrupt record: " << i << std::endl;
+                    return nullptr;
+                }
+            }
+
+            return header;
+        }
+
+    } // End of namespace ~ bt
+
+} // End of namespace ~ iga
@@ -0,0 +1,138 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+/**
+* @file black_board_snapshot.h
+* @brief iga::bt::BlackBoardSnapshot Header File.
+*
+* @author Channing Eggers
+* @date 19 October 2026
+* @version $Revision 1.1
+*
+* A blackboard snapshot is a compact binary copy of the values of one or more blackboards, for save games,
+* rollback and moving agents to another server. Every value is a fixed size record, so the records of all
+* blackboards are written and read as one block. Keys and string values are interned into a single string
+* table, so agents that use the same keys store each key once per snapshot, not once per agent. Values
+* that don't fit into a record, vectors and entities, are stored in a table of 16 byte values.
+*
+* Layout of a snapshot:
+*   BlackBoardSnapshotHeader
+*   BlackBoardSnapshotRange[blackboard_count]
+*   BlackBoardSnapshotRecord[record_count]
+*   BlackBoardSnapshotValue[value_count]
+*   String table ~ Null terminated keys and string values, referenced by offset.
+*
+* Values with a time to live keep the ticks they had left. Restoring replaces all values of a blackboard and
+* counts as a change of every restored value; pending writes get dropped, subscriptions and the parent scope
+* stay. Snapshots use the byte order of the platform that wrote them.
+*
+*/
+
+/**
+*  igart namespace
+*/
+namespace iga {
+
+    /**
+    *  BT namespace
+    */
+    namespace bt {
+
+        class BlackBoard;
+
+        /**
+        *   iga::bt::BlackBoardSnapshotHeader; Header at the start of every snapshot. Offsets are in bytes from the start of the snapshot.
+        */
+        struct BlackBoardSnapshotHeader {
+            std::uint32_t magic;                /**< Always BlackBoardSnapshot::magic_. */
+            std::uint32_t version;              /**< Version of the snapshot format. */
+            std::uint32_t size;                 /**< Size of the whole snapshot. */
+            std::uint32_t blackboard_count;     /**< Amount of blackboards. */
+            std::uint32_t range_table_offset;   /**< Offset of the record ranges of the blackboards. */
+            std::uint32_t record_count;         /**< Amount of records. */
+            std::uint32_t record_table_offset;  /**< Offset of the records. */
+            std::uint32_t value_count;          /**< Amount of 16 byte values. */
+            std::uint32_t value_table_offset;   /**< Offset of the 16 byte values. */
+            std::uint32_t string_table_offset;  /**< Offset of the string table. */
+            std::uint32_t string_table_size;    /**< Size of the string table. */
+        };
+
+        /**
+        *   iga::bt::BlackBoardSnapshotRange; The records of a blackboard.
+        */
+        struct BlackBoardSnapshotRange {
+            std::uint32_t first_record;         /**< Index of the first record of the blackboard. */
+            std::uint32_t record_count;         /**< Amount of records of the blackboard. */
+        };
+
+        /**
+        *   iga::bt::BlackBoardSnapshotRecord; A value of a blackboard.
+        */
+        struct BlackBoardSnapshotRecord {
+            std::uint32_t key;                  /**< String offset of the ID of the value. */
+            std::uint32_t type;                 /**< BlackBoardTypes of the value. */
+            std::uint32_t value;                /**< Bits of the int or float, 0 or 1 for a bool, string offset for a string, index of the 16 byte value otherwise. */
+            std::uint32_t ticks_to_live;        /**< Ticks of iga::bt::BTTimerWheel that the value had left, 0 if it never expires. */
+        };
+
+        /**
+        *   iga::bt::BlackBoardSnapshotValue; A vector or entity value of a blackboard.
+        */
+        struct BlackBoardSnapshotValue {
+            std::uint32_t words[4];             /**< Bits of the value. */
+        };
+
+        /**
+        *   iga::bt::BlackBoardSnapshot; Writes and restores binary snapshots of blackboards.
+        */
+        class BlackBoardSnapshot final {
+        public:
+
+            static const std::uint32_t magic_ = 0x31534242;    /**< "BBS1" */
+            static const std::uint32_t version_ = 1;           /**< Version of the snapshot format. */
+
+            /**
+            *   Writes the values of blackboards into one snapshot.
+            *   @param std::vector<const BlackBoard*> a_blackboards The blackboards, nullptr is written as an empty blackboard.
+            *   @param std::vector<char> a_data The container that the snapshot gets written to.
+            *   @return bool - If True ~ The snapshot has been written.
+            */
+            static bool Write(const std::vector<const BlackBoard*>& a_blackboards, std::vector<char>& a_data);
+
+            /**
+            *   Replaces the values of blackboards with the values of a snapshot. Nothing gets restored if the
+            *   snapshot isn't valid. Has to be called outside of the ticks of the behaviour trees of the blackboards.
+            *   @param const char* a_data The snapshot.
+            *   @param std::size_t a_size Size of the snapshot.
+            *   @param std::vector<BlackBoard*> a_blackboards The blackboards, in the order that they were written.
+            *   nullptr skips a blackboard.
+            *   @return bool - If True ~ The snapshot is valid and has been restored.
+            */
+            static bool Read(const char* a_data, std::size_t a_size, const std::vector<BlackBoard*>& a_blackboards);
+
+            /**
+            *   Returns the amount of blackboards in a snapshot.
+            *   @param const char* a_data The snapshot.
+            *   @param std::size_t a_size Size of the snapshot.
+            *   @return std::uint32_t value, 0 if the snapshot isn't valid.
+            */
+            static std::uint32_t GetBlackBoardCount(const char* a_data, std::size_t a_size);
+
+        private:
+
+            /**
+            *   Validates a snapshot.
+            *   @param const char* a_data The snapshot.
+            *   @param std::size_t a_size Size of the snapshot.
+            *   @return const BlackBoardSnapshotHeader* The header of the snapshot, nullptr if the snapshot isn't valid.
+            */
+            static const BlackBoardSnapshotHeader* Validate(const char* a_data, std::size_t a_size);
+
+        };
+
+    } // End of namespace ~ bt
+
+} // End of namespace ~ iga
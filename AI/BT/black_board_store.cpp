@@ -0,0 +1,373 @@
+#include <AI/BT/black_board_store.h>
+
+#include <AI/BT/behaviour_tree.h>
+#include <AI/BT/Nodes/base_node.h>
+
+#include <iostream>
+#include <utility>
+
+namespace iga {
+
+    namespace bt {
+
+        namespace {
+
+            /** Calls a function with the array of a column that matches the type of its key. */
+            template<typename TColumn, typename TFunction>
+            void ForValues(TColumn& a_column, TFunction&& a_function) {
+                switch (a_column.key.type) {
+                case BlackBoardTypes::INT:      { a_function(a_column.ints);        break; }
+                case BlackBoardTypes::FLOAT:    { a_function(a_column.floats);      break; }
+                case BlackBoardTypes::BOOL:     { a_function(a_column.bools);       break; }
+                case BlackBoardTypes::STRING:   { a_function(a_column.strings);     break; }
+                case BlackBoardTypes::VECTOR2:  { a_function(a_column.vector2s);    break; }
+                case BlackBoardTypes::VECTOR4:  { a_function(a_column.vector4s);    break; }
+                case BlackBoardTypes::ENTITY:   { a_function(a_column.entities);    break; }
+                }
+            }
+
+        }
+
+        BlackBoardStore::BlackBoardStore() { /*EMPTY*/ }
+
+        BlackBoardStore::~BlackBoardStore() { /*EMPTY*/ }
+
+        void BlackBoardStore::CollectSchema(BehaviourTree& a_tree, std::vector<BlackBoardKey>& a_schema) {
+            std::vector<BaseNode*> nodes;
+            a_tree.GetTrackedNodes(&nodes);
+
+            std::vector<BlackBoardKey> keys;
+            for (auto& node : nodes) {
+                node->GetBlackBoardKeys(keys);
+            }
+
+            for (auto& key : keys) {
+                bool known = false;
+                for (auto& schema_key : a_schema) {
+                    if (schema_key.name == key.name && schema_key.type == key.type) { known = true; break; }
+                }
+                if (!known) {
+                    a_schema.push_back(key);
+                }
+            }
+        }
+
+        BlackBoardStore::TableID BlackBoardStore::CreateTable(const std::string& a_name, const std::vector<BlackBoardKey>& a_schema) {
+            if (this->table_names_.find(a_name) != this->table_names_.end()) {
+                std::cout << "ERROR - Behaviour Tree System - Blackboard store already has a table named: " << a_name << std::endl;
+                return invalid_;
+            }
+
+            Table table;
+            table.name = a_name;
+            for (auto& key : a_schema) {
+                bool known = false;
+                for (auto& column : table.columns) {
+                    if (column.key.name == key.name && column.key.type == key.type) { known = true; break; }
+                }
+                if (known) { continue; }
+
+                Column column;
+                column.key = key;
+                column.key.write = false;
+                table.columns.push_back(std::move(column));
+            }
+
+            TableID table_id = static_cast<TableID>(this->tables_.size());
+            this->tables_.push_back(std::move(table));
+            this->table_names_.emplace(a_name, table_id);
+            return table_id;
+        }
+
+        BlackBoardStore::TableID BlackBoardStore::FindTable(const std::string& a_name) const {
+            std::unordered_map<std::string, TableID>::const_iterator it = this->table_names_.find(a_name);
+            return (it != this->table_names_.end()) ? it->second : invalid_;
+        }
+
+        std::uint32_t BlackBoardStore::GetTableCount() const {
+            return static_cast<std::uint32_t>(this->tables_.size());
+        }
+
+        BlackBoardStore::AgentID BlackBoardStore::AddAgent(TableID a_table) {
+            DEBUGASSERT(a_table < this->tables_.size());
+            Table& table = this->tables_[a_table];
+
+            AgentID agent;
+            if (!this->free_agents_.empty()) {
+                agent = this->free_agents_.back();
+                this->free_agents_.pop_back();
+            } else {
+                agent = static_cast<AgentID>(this->agents_.size());
+                this->agents_.emplace_back();
+            }
+
+            this->agents_[agent].table = a_table;
+            this->agents_[agent].row = static_cast<std::uint32_t>(table.agents.size());
+            table.agents.push_back(agent);
+
+            for (auto& column : table.columns) {
+                column.valid.push_back(0);
+                ForValues(column, [](auto& a_values) { a_values.emplace_back(); });
+            }
+
+            return agent;
+        }
+
+        void BlackBoardStore::RemoveAgent(AgentID a_agent) {
+            if (a_agent >= this->agents_.size() || this->agents_[a_agent].table == invalid_) { return; }
+
+            Table& table = this->tables_[this->agents_[a_agent].table];
+            std::uint32_t row = this->agents_[a_agent].row;
+            std::uint32_t last_row = static_cast<std::uint32_t>(table.agents.size()) - 1;
+
+            // Keep the rows contiguous; the last agent moves into the row.
+            for (auto& column : table.columns) {
+                column.valid[row] = column.valid[last_row];
+                column.valid.pop_back();
+                ForValues(column, [row, last_row](auto& a_values) {
+                    if (row != last_row) { a_values[row] = std::move(a_values[last_row]); }
+                    a_values.pop_back();
+                });
+            }
+
+            AgentID moved_agent = table.agents[last_row];
+            table.agents[row] = moved_agent;
+            table.agents.pop_back();
+            this->agents_[moved_agent].row = row;
+
+            this->agents_[a_agent].table = invalid_;
+            this->free_agents_.push_back(a_agent);
+        }
+
+        BlackBoardStore::TableID BlackBoardStore::GetTable(AgentID a_agent) const {
+            return (a_agent < this->agents_.size()) ? this->agents_[a_agent].table : invalid_;
+        }
+
+        std::uint32_t BlackBoardStore::GetRow(AgentID a_agent) const {
+            DEBUGASSERT(a_agent < this->agents_.size());
+            return this->agents_[a_agent].row;
+        }
+
+        BlackBoardStore::AgentID BlackBoardStore::GetAgent(TableID a_table, std::uint32_t a_row) const {
+            DEBUGASSERT(a_table < this->tables_.size() && a_row < this->tables_[a_table].agents.size());
+            return this->tables_[a_table].agents[a_row];
+        }
+
+        std::uint32_t BlackBoardStore::GetAgentCount(TableID a_table) const {
+            return (a_table < this->tables_.size()) ? static_cast<std::uint32_t>(this->tables_[a_table].agents.size()) : 0;
+        }
+
+        std::uint32_t BlackBoardStore::FindColumn(TableID a_table, const std::string& a_id, BlackBoardTypes a_type) const {
+            if (a_table >= this->tables_.size()) { return invalid_; }
+
+            const std::vector<Column>& columns = this->tables_[a_table].columns;
+            for (std::size_t i = 0; i < columns.size(); ++i) {
+                if (columns[i].key.type == a_type && columns[i].key.name == a_id) {
+                    return static_cast<std::uint32_t>(i);
+                }
+            }
+            return invalid_;
+        }
+
+        std::uint32_t BlackBoardStore::GetColumnCount(TableID a_table) const {
+            return (a_table < this->tables_.size()) ? static_cast<std::uint32_t>(this->tables_[a_table].columns.size()) : 0;
+        }
+
+        BlackBoardKey BlackBoardStore::GetColumnKey(TableID a_table, std::uint32_t a_column) const {
+            DEBUGASSERT(a_column < GetColumnCount(a_table));
+            return this->tables_[a_table].columns[a_column].key;
+        }
+
+        std::uint8_t* BlackBoardStore::GetValidColumn(TableID a_table, std::uint32_t a_column) {
+            if (a_column >= GetColumnCount(a_table)) { return nullptr; }
+            return this->tables_[a_table].columns[a_column].valid.data();
+        }
+
+        const std::uint8_t* BlackBoardStore::GetValidColumn(TableID a_table, std::uint32_t a_column) const {
+            if (a_column >= GetColumnCount(a_table)) { return nullptr; }
+            return this->tables_[a_table].columns[a_column].valid.data();
+        }
+
+        int* BlackBoardStore::GetIntColumn(TableID a_table, std::uint32_t a_column) {
+            Column* column = GetColumn(a_table, a_column, BlackBoardTypes::INT);
+            return (column != nullptr) ? column->ints.data() : nullptr;
+        }
+
+        const int* BlackBoardStore::GetIntColumn(TableID a_table, std::uint32_t a_column) const {
+            const Column* column = GetColumn(a_table, a_column, BlackBoardTypes::INT);
+            return (column != nullptr) ? column->ints.data() : nullptr;
+        }
+
+        float* BlackBoardStore::GetFloatColumn(TableID a_table, std::uint32_t a_column) {
+            Column* column = GetColumn(a_table, a_column, BlackBoardTypes::FLOAT);
+            return (column != nullptr) ? column->floats.data() : nullptr;
+        }
+
+        const float* BlackBoardStore::GetFloatColumn(TableID a_table, std::uint32_t a_column) const {
+            const Column* column = GetColumn(a_table, a_column, BlackBoardTypes::FLOAT);
+            return (column != nullptr) ? column->floats.data() : nullptr;
+        }
+
+        std::uint8_t* BlackBoardStore::GetBoolColumn(TableID a_table, std::uint32_t a_column) {
+            Column* column = GetColumn(a_table, a_column, BlackBoardTypes::BOOL);
+            return (column != nullptr) ? column->bools.data() : nullptr;
+        }
+
+        const std::uint8_t* BlackBoardStore::GetBoolColumn(TableID a_table, std::uint32_t a_column) const {
+            const Column* column = GetColumn(a_table, a_column, BlackBoardTypes::BOOL);
+            return (column != nullptr) ? column->bools.data() : nullptr;
+        }
+
+        std::string* BlackBoardStore::GetStringColumn(TableID a_table, std::uint32_t a_column) {
+            Column* column = GetColumn(a_table, a_column, BlackBoardTypes::STRING);
+            return (column != nullptr) ? column->strings.data() : nullptr;
+        }
+
+        const std::string* BlackBoardStore::GetStringColumn(TableID a_table, std::uint32_t a_column) const {
+            const Column* column = GetColumn(a_table, a_column, BlackBoardTypes::STRING);
+            return (column != nullptr) ? column->strings.data() : nullptr;
+        }
+
+        BlackBoardVector2* BlackBoardStore::GetVector2Column(TableID a_table, std::uint32_t a_column) {
+            Column* column = GetColumn(a_table, a_column, BlackBoardTypes::VECTOR2);
+            return (column != nullptr) ? column->vector2s.data() : nullptr;
+        }
+
+        const BlackBoardVector2* BlackBoardStore::GetVector2Column(TableID a_table, std::uint32_t a_column) const {
+            const Column* column = GetColumn(a_table, a_column, BlackBoardTypes::VECTOR2);
+            return (column != nullptr) ? column->vector2s.data() : nullptr;
+        }
+
+        BlackBoardVector4* BlackBoardStore::GetVector4Column(TableID a_table, std::uint32_t a_column) {
+            Column* column = GetColumn(a_table, a_column, BlackBoardTypes::VECTOR4);
+            return (column != nullptr) ? column->vector4s.data() : nullptr;
+        }
+
+        const BlackBoardVector4* BlackBoardStore::GetVector4Column(TableID a_table, std::uint32_t a_column) const {
+            const Column* column = GetColumn(a_table, a_column, BlackBoardTypes::VECTOR4);
+            return (column != nullptr) ? column->vector4s.data() : nullptr;
+        }
+
+        BlackBoardEntity* BlackBoardStore::GetEntityColumn(TableID a_table, std::uint32_t a_column) {
+            Column* column = GetColumn(a_table, a_column, BlackBoardTypes::ENTITY);
+            return (column != nullptr) ? column->entities.data() : nullptr;
+        }
+
+        const BlackBoardEntity* BlackBoardStore::GetEntityColumn(TableID a_table, std::uint32_t a_column) const {
+            const Column* column = GetColumn(a_table, a_column, BlackBoardTypes::ENTITY);
+            return (column != nullptr) ? column->entities.data() : nullptr;
+        }
+
+        bool BlackBoardStore::SetIntMemory(AgentID a_agent, std::uint32_t a_column, int a_value) {
+            return SetMemory(a_agent, a_column, BlackBoardTypes::INT, &Column::ints, std::move(a_value));
+        }
+
+        bool BlackBoardStore::SetFloatMemory(AgentID a_agent, std::uint32_t a_column, float a_value) {
+            return SetMemory(a_agent, a_column, BlackBoardTypes::FLOAT, &Column::floats, std::move(a_value));
+        }
+
+        bool BlackBoardStore::SetBoolMemory(AgentID a_agent, std::uint32_t a_column, bool a_value) {
+            return SetMemory(a_agent, a_column, BlackBoardTypes::BOOL, &Column::bools, static_cast<std::uint8_t>(a_value ? 1 : 0));
+        }
+
+        bool BlackBoardStore::SetStringMemory(AgentID a_agent, std::uint32_t a_column, std::string a_value) {
+            return SetMemory(a_agent, a_column, BlackBoardTypes::STRING, &Column::strings, std::move(a_value));
+        }
+
+        bool BlackBoardStore::SetVector2Memory(AgentID a_agent, std::uint32_t a_column, const BlackBoardVector2& a_value) {
+            return SetMemory(a_agent, a_column, BlackBoardTypes::VECTOR2, &Column::vector2s, BlackBoardVector2(a_value));
+        }
+
+        bool BlackBoardStore::SetVector4Memory(AgentID a_agent, std::uint32_t a_column, const BlackBoardVector4& a_value) {
+            return SetMemory(a_agent, a_column, BlackBoardTypes::VECTOR4, &Column::vector4s, BlackBoardVector4(a_value));
+        }
+
+        bool BlackBoardStore::SetEntityMemory(AgentID a_agent, std::uint32_t a_column, const BlackBoardEntity& a_value) {
+            return SetMemory(a_agent, a_column, BlackBoardTypes::ENTITY, &Column::entities, BlackBoardEntity(a_value));
+        }
+
+        bool BlackBoardStore::GetIntMemory(AgentID a_agent, std::uint32_t a_column, int& a_ref) const {
+            return GetMemory(a_agent, a_column, BlackBoardTypes::INT, &Column::ints, a_ref);
+        }
+
+        bool BlackBoardStore::GetFloatMemory(AgentID a_agent, std::uint32_t a_column, float& a_ref) const {
+            return GetMemory(a_agent, a_column, BlackBoardTypes::FLOAT, &Column::floats, a_ref);
+        }
+
+        bool BlackBoardStore::GetBoolMemory(AgentID a_agent, std::uint32_t a_column, bool& a_ref) const {
+            std::uint8_t value = 0;
+            if (!GetMemory(a_agent, a_column, BlackBoardTypes::BOOL, &Column::bools, value)) { return false; }
+            a_ref = (value != 0);
+            return true;
+        }
+
+        bool BlackBoardStore::GetStringMemory(AgentID a_agent, std::uint32_t a_column, std::string& a_ref) const {
+            return GetMemory(a_agent, a_column, BlackBoardTypes::STRING, &Column::strings, a_ref);
+        }
+
+        bool BlackBoardStore::GetVector2Memory(AgentID a_agent, std::uint32_t a_column, BlackBoardVector2& a_ref) const {
+            return GetMemory(a_agent, a_column, BlackBoardTypes::VECTOR2, &Column::vector2s, a_ref);
+        }
+
+        bool BlackBoardStore::GetVector4Memory(AgentID a_agent, std::uint32_t a_column, BlackBoardVector4& a_ref) const {
+            return GetMemory(a_agent, a_column, BlackBoardTypes::VECTOR4, &Column::vector4s, a_ref);
+        }
+
+        bool BlackBoardStore::GetEntityMemory(AgentID a_agent, std::uint32_t a_column, BlackBoardEntity& a_ref) const {
+            return GetMemory(a_agent, a_column, BlackBoardTypes::ENTITY, &Column::entities, a_ref);
+        }
+
+        void BlackBoardStore::ClearMemory(AgentID a_agent, std::uint32_t a_column) {
+            TableID table = GetTable(a_agent);
+            if (table == invalid_ || a_column >= GetColumnCount(table)) { return; }
+
+            Column& column = this->tables_[table].columns[a_column];
+            std::uint32_t row = this->agents_[a_agent].row;
+            column.valid[row] = 0;
+
+            // Strings release their memory, the other types keep their stale value.
+            if (column.key.type == BlackBoardTypes::STRING) {
+                std::string().swap(column.strings[row]);
+            }
+        }
+
+        BlackBoardStore::Column* BlackBoardStore::GetColumn(TableID a_table, std::uint32_t a_column, BlackBoardTypes a_type) {
+            if (a_column >= GetColumnCount(a_table)) { return nullptr; }
+
+            Column& column = this->tables_[a_table].columns[a_column];
+            return (column.key.type == a_type) ? &column : nullptr;
+        }
+
+        const BlackBoardStore::Column* BlackBoardStore::GetColumn(TableID a_table, std::uint32_t a_column, BlackBoardTypes a_type) const {
+            if (a_column >= GetColumnCount(a_table)) { return nullptr; }
+
+            const Column& column = this->tables_[a_table].columns[a_column];
+            return (column.key.type == a_type) ? &column : nullptr;
+        }
+
+        template<typename T>
+        bool BlackBoardStore::SetMemory(AgentID a_agent, std::uint32_t a_column, BlackBoardTypes a_type, std::vector<T> Column::* a_values, T&& a_value) {
+            Column* column = GetColumn(GetTable(a_agent), a_column, a_type);
+            if (column == nullptr) { return false; }
+
+            std::uint32_t row = this->agents_[a_agent].row;
+            (column->*a_values)[row] = std::move(a_value);
+            column->valid[row] = 1;
+            return true;
+        }
+
+        template<typename T>
+        bool BlackBoardStore::GetMemory(AgentID a_agent, std::uint32_t a_column, BlackBoardTypes a_type, std::vector<T> Column::* a_values, T& a_ref) const {
+            const Column* column = GetColumn(GetTable(a_agent), a_column, a_type);
+            if (column == nullptr) { return false; }
+
+            std::uint32_t row = this->agents_[a_agent].row;
+            if (column->valid[row] == 0) { return false; }
+
+            a_ref = (column->*a_values)[row];
+            return true;
+        }
+
+    } // End of namespace ~ bt
+
+} // End of namespace ~ iga
@@ -0,0 +1,356 @@
+#pragma once
+
+#include <AI/BT/black_board.h>
+#include <AI/BT/black_board_values.h>
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+/**
+* @file black_board_store.h
+* @brief iga::bt::BlackBoardStore Header File.
+*
+* @author Channing Eggers
+* @date 19 October 2026
+* @version $Revision 1.1
+*
+* The blackboard store keeps the blackboard values of many agents in structure of arrays form, instead of
+* one iga::bt::BlackBoard with hash maps per behaviour tree. Agents that run the same tree template share a
+* table; every key of the schema of the table is a column, an array with one value per agent. The rows of a
+* table are always contiguous, removing an agent moves the last agent of the table into its row.
+*
+* Columns are plain arrays, so a condition can be evaluated for every agent of a table in one pass, see
+* iga::bt::BTBatchInterpreter. Bools are stored as bytes, 0 or 1. Every column also has a byte per agent
+* that is 1 if the agent has a value, which is what BBIsValid checks.
+*
+* The store is optional and owned by game code. Values in the store have no versions, subscriptions or time
+* to live, those stay with iga::bt::BlackBoard. Keys are resolved to columns once, by FindColumn; reads and
+* writes by column index don't hash. The store isn't thread-safe, it has to be written outside of the ticks.
+*
+*/
+
+/**
+*  igart namespace
+*/
+namespace iga {
+
+    /**
+    *  BT namespace
+    */
+    namespace bt {
+
+        class BehaviourTree;
+
+        /**
+        *   iga::bt::BlackBoardStore; Blackboard values of many agents, one column per key.
+        */
+        class BlackBoardStore final {
+        public:
+
+            typedef std::uint32_t TableID;  /**< ID of a table, the index of the table in the store. */
+            typedef std::uint32_t AgentID;  /**< ID of an agent of the store, stays the same while rows move. */
+
+            static const std::uint32_t invalid_ = 0xFFFFFFFF; /**< Invalid table, agent or column. */
+
+            /** BlackBoardStore Constructor */
+            BlackBoardStore();
+
+            /** BlackBoardStore Destructor */
+            ~BlackBoardStore();
+
+            BlackBoardStore(const BlackBoardStore&) = delete;
+            BlackBoardStore& operator=(const BlackBoardStore&) = delete;
+
+            /**
+            *   Collects the schema of a tree template; every blackboard key that its nodes read or write.
+            *   @param BehaviourTree a_tree The tree template.
+            *   @param std::vector<BlackBoardKey> a_schema The container that the keys get added to, without duplicates.
+            */
+            static void CollectSchema(BehaviourTree& a_tree, std::vector<BlackBoardKey>& a_schema);
+
+            /**
+            *   Creates a table. Keys that occur more than once, with the same type, get a single column.
+            *   @param std::string a_name Name of the table, usually the file path of the tree template.
+            *   @param std::vector<BlackBoardKey> a_schema The keys of the table.
+            *   @return TableID The ID of the table, invalid_ if a table with the name exists.
+            */
+            TableID CreateTable(const std::string& a_name, const std::vector<BlackBoardKey>& a_schema);
+
+            /**
+            *   Returns the table with a name.
+            *   @param std::string a_name Name of the table.
+            *   @return TableID The ID of the table, invalid_ if there is no table with the name.
+            */
+            TableID FindTable(const std::string& a_name) const;
+
+            /**
+            *   Returns the amount of tables.
+            *   @return std::uint32_t value.
+            */
+            std::uint32_t GetTableCount() const;
+
+            /**
+            *   Adds an agent to a table. The agent has no values yet.
+            *   @param TableID a_table The table.
+            *   @return AgentID The ID of the agent.
+            */
+            AgentID AddAgent(TableID a_table);
+
+            /**
+            *   Removes an agent. The last agent of the table moves into its row.
+            *   @param AgentID a_agent The agent.
+            */
+            void RemoveAgent(AgentID a_agent);
+
+            /**
+            *   Returns the table of an agent.
+            *   @param AgentID a_agent The agent.
+            *   @return TableID value.
+            */
+            TableID GetTable(AgentID a_agent) const;
+
+            /**
+            *   Returns the row of an agent in its table. Rows change when agents get removed.
+            *   @param AgentID a_agent The agent.
+            *   @return std::uint32_t value.
+            */
+            std::uint32_t GetRow(AgentID a_agent) const;
+
+            /**
+            *   Returns the agent in a row of a table.
+            *   @param TableID a_table The table.
+            *   @param std::uint32_t a_row The row.
+            *   @return AgentID value.
+            */
+            AgentID GetAgent(TableID a_table, std::uint32_t a_row) const;
+
+            /**
+            *   Returns the amount of agents, the rows, of a table.
+            *   @param TableID a_table The table.
+            *   @return std::uint32_t value.
+            */
+            std::uint32_t GetAgentCount(TableID a_table) const;
+
+            /**
+            *   Returns the column of a key in a table.
+            *   @param TableID a_table The table.
+            *   @param std::string a_id ID of the key.
+            *   @param BlackBoardTypes a_type Type of the key.
+            *   @return std::uint32_t Index of the column, invalid_ if the table doesn't have the key.
+            */
+            std::uint32_t FindColumn(TableID a_table, const std::string& a_id, BlackBoardTypes a_type) const;
+
+            /**
+            *   Returns the amount of columns of a table.
+            *   @param TableID a_table The table.
+            *   @return std::uint32_t value.
+            */
+            std::uint32_t GetColumnCount(TableID a_table) const;
+
+            /**
+            *   Returns the key of a column.
+            *   @param TableID a_table The table.
+            *   @param std::uint32_t a_column The column.
+            *   @return BlackBoardKey value.
+            */
+            BlackBoardKey GetColumnKey(TableID a_table, std::uint32_t a_column) const;
+
+#pragma region BlackBoardStore Columns
+
+            /**
+            *   Returns the bytes of a column that are 1 for every agent that has a value, one per row.
+            *   @param TableID a_table The table.
+            *   @param std::uint32_t a_column The column.
+            *   @return std::uint8_t pointer, valid until agents get added to the table.
+            */
+            std::uint8_t* GetValidColumn(TableID a_table, std::uint32_t a_column);
+            const std::uint8_t* GetValidColumn(TableID a_table, std::uint32_t a_column) const;
+
+            /**
+            *   Returns the values of an INT column, one per row. Writing a value directly doesn't set its valid byte.
+            *   @param TableID a_table The table.
+            *   @param std::uint32_t a_column The column.
+            *   @return int pointer, nullptr if the column has another type. Valid until agents get added to the table.
+            */
+            int* GetIntColumn(TableID a_table, std::uint32_t a_column);
+            const int* GetIntColumn(TableID a_table, std::uint32_t a_column) const;
+
+            /**
+            *   Returns the values of a FLOAT column, one per row. Writing a value directly doesn't set its valid byte.
+            *   @param TableID a_table The table.
+            *   @param std::uint32_t a_column The column.
+            *   @return float pointer, nullptr if the column has another type. Valid until agents get added to the table.
+            */
+            float* GetFloatColumn(TableID a_table, std::uint32_t a_column);
+            const float* GetFloatColumn(TableID a_table, std::uint32_t a_column) const;
+
+            /**
+            *   Returns the values of a BOOL column, one byte per row, 0 or 1. Writing a value directly doesn't set its valid byte.
+            *   @param TableID a_table The table.
+            *   @param std::uint32_t a_column The column.
+            *   @return std::uint8_t pointer, nullptr if the column has another type. Valid until agents get added to the table.
+            */
+            std::uint8_t* GetBoolColumn(TableID a_table, std::uint32_t a_column);
+            const std::uint8_t* GetBoolColumn(TableID a_table, std::uint32_t a_column) const;
+
+            /**
+            *   Returns the values of a STRING column, one per row. Writing a value directly doesn't set its valid byte.
+            *   @param TableID a_table The table.
+            *   @param std::uint32_t a_column The column.
+            *   @return std::string pointer, nullptr if the column has another type. Valid until agents get added to the table.
+            */
+            std::string* GetStringColumn(TableID a_table, std::uint32_t a_column);
+            const std::string* GetStringColumn(TableID a_table, std::uint32_t a_column) const;
+
+            /**
+            *   Returns the values of a VECTOR2 column, one per row. Writing a value directly doesn't set its valid byte.
+            *   @param TableID a_table The table.
+            *   @param std::uint32_t a_column The column.
+            *   @return BlackBoardVector2 pointer, nullptr if the column has another type. Valid until agents get added to the table.
+            */
+            BlackBoardVector2* GetVector2Column(TableID a_table, std::uint32_t a_column);
+            const BlackBoardVector2* GetVector2Column(TableID a_table, std::uint32_t a_column) const;
+
+            /**
+            *   Returns the values of a VECTOR4 column, one per row. Writing a value directly doesn't set its valid byte.
+            *   @param TableID a_table The table.
+            *   @param std::uint32_t a_column The column.
+            *   @return BlackBoardVector4 pointer, nullptr if the column has another type. Valid until agents get added to the table.
+            */
+            BlackBoardVector4* GetVector4Column(TableID a_table, std::uint32_t a_column);
+            const BlackBoardVector4* GetVector4Column(TableID a_table, std::uint32_t a_column) const;
+
+            /**
+            *   Returns the values of an ENTITY column, one per row. Writing a value directly doesn't set its valid byte.
+            *   @param TableID a_table The table.
+            *   @param std::uint32_t a_column The column.
+            *   @return BlackBoardEntity pointer, nullptr if the column has another type. Valid until agents get added to the table.
+            */
+            BlackBoardEntity* GetEntityColumn(TableID a_table, std::uint32_t a_column);
+            const BlackBoardEntity* GetEntityColumn(TableID a_table, std::uint32_t a_column) const;
+
+#pragma endregion End of BlackBoardStore Columns
+
+#pragma region BlackBoardStore Agent Values
+
+            /**
+            *   Stores a value of an agent and marks it as valid.
+            *   @param AgentID a_agent The agent.
+            *   @param std::uint32_t a_column The column, has to be of the type of the value.
+            *   @param a_value The value.
+            *   @return bool - If True ~ The value has been stored.
+            */
+            bool SetIntMemory(AgentID a_agent, std::uint32_t a_column, int a_value);
+            bool SetFloatMemory(AgentID a_agent, std::uint32_t a_column, float a_value);
+            bool SetBoolMemory(AgentID a_agent, std::uint32_t a_column, bool a_value);
+            bool SetStringMemory(AgentID a_agent, std::uint32_t a_column, std::string a_value);
+            bool SetVector2Memory(AgentID a_agent, std::uint32_t a_column, const BlackBoardVector2& a_value);
+            bool SetVector4Memory(AgentID a_agent, std::uint32_t a_column, const BlackBoardVector4& a_value);
+            bool SetEntityMemory(AgentID a_agent, std::uint32_t a_column, const BlackBoardEntity& a_value);
+
+            /**
+            *   Sets the value of the passed through item to the value of an agent.
+            *   @param AgentID a_agent The agent.
+            *   @param std::uint32_t a_column The column, has to be of the type of the value.
+            *   @param a_ref The container that the value gets stored in.
+            *   @return bool - If True ~ The agent has a value.
+            */
+            bool GetIntMemory(AgentID a_agent, std::uint32_t a_column, int& a_ref) const;
+            bool GetFloatMemory(AgentID a_agent, std::uint32_t a_column, float& a_ref) const;
+            bool GetBoolMemory(AgentID a_agent, std::uint32_t a_column, bool& a_ref) const;
+            bool GetStringMemory(AgentID a_agent, std::uint32_t a_column, std::string& a_ref) const;
+            bool GetVector2Memory(AgentID a_agent, std::uint32_t a_column, BlackBoardVector2& a_ref) const;
+            bool GetVector4Memory(AgentID a_agent, std::uint32_t a_column, BlackBoardVector4& a_ref) const;
+            bool GetEntityMemory(AgentID a_agent, std::uint32_t a_column, BlackBoardEntity& a_ref) const;
+
+            /**
+            *   Removes a value of an agent, BBIsValid fails for it.
+            *   @param AgentID a_agent The agent.
+            *   @param std::uint32_t a_column The column.
+            */
+            void ClearMemory(AgentID a_agent, std::uint32_t a_column);
+
+#pragma endregion End of BlackBoardStore Agent Values
+
+        private:
+
+            /**
+            *   iga::bt::BlackBoardStore::Column; The values of a key, for every agent of a table.
+            *   Only the array of the type of the key is used.
+            */
+            struct Column {
+                BlackBoardKey key;                          /**< The key. */
+                std::vector<std::uint8_t> valid;            /**< 1 if the agent has a value. */
+                std::vector<int> ints;                      /**< Values, if the type is INT. */
+                std::vector<float> floats;                  /**< Values, if the type is FLOAT. */
+                std::vector<std::uint8_t> bools;            /**< Values, if the type is BOOL. */
+                std::vector<std::string> strings;           /**< Values, if the type is STRING. */
+                std::vector<BlackBoardVector2> vector2s;    /**< Values, if the type is VECTOR2. */
+                std::vector<BlackBoardVector4> vector4s;    /**< Values, if the type is VECTOR4. */
+                std::vector<BlackBoardEntity> entities;     /**< Values, if the type is ENTITY. */
+            };
+
+            /**
+            *   iga::bt::BlackBoardStore::Table; The agents of a tree template.
+            */
+            struct Table {
+                std::string name;                           /**< Name of the table. */
+                std::vector<Column> columns;                /**< One column per key. */
+                std::vector<AgentID> agents;                /**< Agent of every row. */
+            };
+
+            /**
+            *   iga::bt::BlackBoardStore::AgentSlot; Where the values of an agent are.
+            */
+            struct AgentSlot {
+                TableID table = invalid_;                   /**< Table of the agent, invalid_ if the ID is unused. */
+                std::uint32_t row = 0;                      /**< Row of the agent. */
+            };
+
+            /**
+            *   Returns a column of the type of a value, nullptr if the table or column doesn't exist or has another type.
+            *   @param TableID a_table The table.
+            *   @param std::uint32_t a_column The column.
+            *   @param BlackBoardTypes a_type The type.
+            *   @return Column pointer.
+            */
+            Column* GetColumn(TableID a_table, std::uint32_t a_column, BlackBoardTypes a_type);
+            const Column* GetColumn(TableID a_table, std::uint32_t a_column, BlackBoardTypes a_type) const;
+
+            /**
+            *   Stores a value of an agent.
+            *   @param AgentID a_agent The agent.
+            *   @param std::uint32_t a_column The column.
+            *   @param BlackBoardTypes a_type Type of the value.
+            *   @param std::vector<T> Column::* a_values The array of the type.
+            *   @param T a_value The value.
+            *   @return bool - If True ~ The value has been stored.
+            */
+            template<typename T>
+            bool SetMemory(AgentID a_agent, std::uint32_t a_column, BlackBoardTypes a_type, std::vector<T> Column::* a_values, T&& a_value);
+
+            /**
+            *   Reads a value of an agent.
+            *   @param AgentID a_agent The agent.
+            *   @param std::uint32_t a_column The column.
+            *   @param BlackBoardTypes a_type Type of the value.
+            *   @param std::vector<T> Column::* a_values The array of the type.
+            *   @param T a_ref The container that the value gets stored in.
+            *   @return bool - If True ~ The agent has a value.
+            */
+            template<typename T>
+            bool GetMemory(AgentID a_agent, std::uint32_t a_column, BlackBoardTypes a_type, std::vector<T> Column::* a_values, T& a_ref) const;
+
+            std::vector<Table> tables_;                                 /**< The tables, by ID. */
+            std::unordered_map<std::string, TableID> table_names_;      /**< Tables by name. */
+            std::vector<AgentSlot> agents_;                             /**< Slot of every agent, by ID. */
+            std::vector<AgentID> free_agents_;                          /**< Unused agent IDs. */
+
+        };
+
+    } // End of namespace ~ bt
+
+} // End of namespace ~ iga
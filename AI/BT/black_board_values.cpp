@@ -0,0 +1,20 @@
+#include <AI/BT/black_board_values.h>
+
+namespace iga {
+
+    namespace bt {
+
+        BlackBoardEntity::Validator BlackBoardEntity::validator_ = nullptr;
+
+        bool BlackBoardEntity::IsValid() const {
+            if (this->id == 0) { return false; }
+            return (validator_ == nullptr) || validator_(*this);
+        }
+
+        void BlackBoardEntity::SetValidator(Validator a_validator) {
+            validator_ = a_validator;
+        }
+
+    } // End of namespace ~ bt
+
+} // End of namespace ~ iga
@@ -0,0 +1,214 @@
+#pragma once
+
+#include <cstdint>
+
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#define BT_SSE2
+#include <emmintrin.h>
+#endif
+
+/**
+* @file black_board_values.h
+* @brief Vector and entity values of the BlackBoard.
+*
+* @author Channing Eggers
+* @date 19 October 2026
+* @version $Revision 1.1
+*
+* Positions, directions and targets are stored as native blackboard values instead of strings or
+* separate floats. Vectors are 16 byte aligned, so a Vector4 is a single SSE register and a Vector2 is
+* the lower half of one; the distance and equality checks use SSE2 where available.
+*
+* Entities are stored as weak handles; an ID and a generation. A handle never keeps its entity alive.
+* Game code registers a validator that reports whether the entity of a handle still exists, which
+* BBIsValid uses. Without a validator every handle other than the null handle counts as valid.
+*
+* Conditions compare values with a CompareOperator. CompareValues takes the operator as a template
+* argument, so a comparator that is resolved once per node doesn't branch on the operator.
+*
+*/
+
+/**
+*  igart namespace
+*/
+namespace iga {
+
+    /**
+    *  BT namespace
+    */
+    namespace bt {
+
+        /** The CompareOperator enum, represents how a condition compares a blackboard value. */
+        enum class CompareOperator {
+            EQUAL           = 0,    /**< The value is equal to the compared value. */
+            NOT_EQUAL       = 1,    /**< The value isn't equal to the compared value. */
+            LESS            = 2,    /**< The value is less than the compared value. */
+            LESS_EQUAL      = 3,    /**< The value is less than or equal to the compared value. */
+            GREATER         = 4,    /**< The value is greater than the compared value. */
+            GREATER_EQUAL   = 5,    /**< The value is greater than or equal to the compared value. */
+            IN_RANGE        = 6     /**< The value is in the range from the compared value to the max value, both included. */
+        };
+
+        /**
+        *   Compares a value.
+        *   @param T a_value The value.
+        *   @param T a_compare The compared value, the min value of IN_RANGE.
+        *   @param T a_max The max value of IN_RANGE, unused by the other operators.
+        *   @return bool - If True ~ The compare passes.
+        */
+        template<CompareOperator TOperator, typename T>
+        inline bool CompareValues(const T& a_value, const T& a_compare, const T& a_max) {
+            switch (TOperator) {
+            case CompareOperator::EQUAL:            { return a_value == a_compare; }
+            case CompareOperator::NOT_EQUAL:        { return a_value != a_compare; }
+            case CompareOperator::LESS:             { return a_value < a_compare; }
+            case CompareOperator::LESS_EQUAL:       { return a_value <= a_compare; }
+            case CompareOperator::GREATER:          { return a_value > a_compare; }
+            case CompareOperator::GREATER_EQUAL:    { return a_value >= a_compare; }
+            case CompareOperator::IN_RANGE:         { return a_compare <= a_value && a_value <= a_max; }
+            }
+            return false;
+        }
+
+        /**
+        *   iga::bt::BlackBoardVector2; A 2D vector value of the blackboard.
+        */
+        struct alignas(16) BlackBoardVector2 {
+            float x = 0.0f;     /**< X component. */
+            float y = 0.0f;     /**< Y component. */
+
+            /** BlackBoardVector2 Constructor */
+            BlackBoardVector2() { /*EMPTY*/ }
+
+            /**
+            *   BlackBoardVector2 Constructor
+            *   @param float a_x X component.
+            *   @param float a_y Y component.
+            */
+            BlackBoardVector2(float a_x, float a_y) : x(a_x), y(a_y) { /*EMPTY*/ }
+
+            bool operator==(const BlackBoardVector2& a_other) const { return x == a_other.x && y == a_other.y; }
+            bool operator!=(const BlackBoardVector2& a_other) const { return !(*this == a_other); }
+        };
+
+        /**
+        *   iga::bt::BlackBoardVector4; A 4D vector value of the blackboard.
+        */
+        struct alignas(16) BlackBoardVector4 {
+            float x = 0.0f;     /**< X component. */
+            float y = 0.0f;     /**< Y component. */
+            float z = 0.0f;     /**< Z component. */
+            float w = 0.0f;     /**< W component. */
+
+            /** BlackBoardVector4 Constructor */
+            BlackBoardVector4() { /*EMPTY*/ }
+
+            /**
+            *   BlackBoardVector4 Constructor
+            *   @param float a_x X component.
+            *   @param float a_y Y component.
+            *   @param float a_z Z component.
+            *   @param float a_w W component.
+            */
+            BlackBoardVector4(float a_x, float a_y, float a_z, float a_w) : x(a_x), y(a_y), z(a_z), w(a_w) { /*EMPTY*/ }
+
+            bool operator==(const BlackBoardVector4& a_other) const {
+#ifdef BT_SSE2
+                return _mm_movemask_ps(_mm_cmpeq_ps(_mm_load_ps(&x), _mm_load_ps(&a_other.x))) == 0xF;
+#else
+                return x == a_other.x && y == a_other.y && z == a_other.z && w == a_other.w;
+#endif // BT_SSE2
+            }
+            bool operator!=(const BlackBoardVector4& a_other) const { return !(*this == a_other); }
+        };
+
+        /**
+        *   iga::bt::BlackBoardEntity; A weak handle to an entity, stored in the blackboard.
+        */
+        struct BlackBoardEntity {
+
+            /**
+            *   Reports whether the entity of a handle still exists.
+            *   @param BlackBoardEntity a_entity The handle.
+            *   @return bool - If True ~ The entity exists.
+            */
+            typedef bool (*Validator)(const BlackBoardEntity& a_entity);
+
+            std::uint32_t id = 0;           /**< ID of the entity, 0 is the null handle. */
+            std::uint32_t generation = 0;   /**< Generation of the ID, tells apart entities that reused an ID. */
+
+            /** BlackBoardEntity Constructor */
+            BlackBoardEntity() { /*EMPTY*/ }
+
+            /**
+            *   BlackBoardEntity Constructor
+            *   @param std::uint32_t a_id ID of the entity.
+            *   @param std::uint32_t a_generation Generation of the ID.
+            */
+            BlackBoardEntity(std::uint32_t a_id, std::uint32_t a_generation) : id(a_id), generation(a_generation) { /*EMPTY*/ }
+
+            /**
+            *   Returns whether the handle refers to an entity that still exists.
+            *   @return bool - If True ~ The handle isn't null and the validator accepts it.
+            */
+            bool IsValid() const;
+
+            /**
+            *   Sets the validator of all handles. Has to be set before the behaviour trees tick.
+            *   @param Validator a_validator The validator, nullptr accepts every handle other than the null handle.
+            */
+            static void SetValidator(Validator a_validator);
+
+            bool operator==(const BlackBoardEntity& a_other) const { return id == a_other.id && generation == a_other.generation; }
+            bool operator!=(const BlackBoardEntity& a_other) const { return !(*this == a_other); }
+
+        private:
+
+            static Validator validator_;    /**< Validator of all handles. */
+
+        };
+
+        /**
+        *   Returns the squared distance between two vectors.
+        *   @param BlackBoardVector2 a_a The first vector.
+        *   @param BlackBoardVector2 a_b The second vector.
+        *   @return float value.
+        */
+        inline float DistanceSquared(const BlackBoardVector2& a_a, const BlackBoardVector2& a_b) {
+#ifdef BT_SSE2
+            // Only the lower 8 bytes are loaded, the upper lanes are zero.
+            __m128 delta = _mm_sub_ps(_mm_castpd_ps(_mm_load_sd(reinterpret_cast<const double*>(&a_a.x))),
+                                      _mm_castpd_ps(_mm_load_sd(reinterpret_cast<const double*>(&a_b.x))));
+            delta = _mm_mul_ps(delta, delta);
+            return _mm_cvtss_f32(_mm_add_ss(delta, _mm_shuffle_ps(delta, delta, _MM_SHUFFLE(1, 1, 1, 1))));
+#else
+            float dx = a_a.x - a_b.x;
+            float dy = a_a.y - a_b.y;
+            return dx * dx + dy * dy;
+#endif // BT_SSE2
+        }
+
+        /**
+        *   Returns the squared distance between two vectors, over all 4 components.
+        *   @param BlackBoardVector4 a_a The first vector.
+        *   @param BlackBoardVector4 a_b The second vector.
+        *   @return float value.
+        */
+        inline float DistanceSquared(const BlackBoardVector4& a_a, const BlackBoardVector4& a_b) {
+#ifdef BT_SSE2
+            __m128 delta = _mm_sub_ps(_mm_load_ps(&a_a.x), _mm_load_ps(&a_b.x));
+            delta = _mm_mul_ps(delta, delta);
+            __m128 sum = _mm_add_ps(delta, _mm_shuffle_ps(delta, delta, _MM_SHUFFLE(2, 3, 0, 1)));
+            return _mm_cvtss_f32(_mm_add_ss(sum, _mm_movehl_ps(sum, sum)));
+#else
+            float dx = a_a.x - a_b.x;
+            float dy = a_a.y - a_b.y;
+            float dz = a_a.z - a_b.z;
+            float dw = a_a.w - a_b.w;
+            return dx * dx + dy * dy + dz * dz + dw * dw;
+#endif // BT_SSE2
+        }
+
+    } // End of namespace ~ bt
+
+} // End of namespace ~ iga
@@ -0,0 +1,52 @@
+#pragma once
+
+/**
+* @file bt_agent.h
+* @brief iga::bt::BTAgent Header File.
+*
+* @author Channing Eggers
+* @date 19 October 2026
+* @version $Revision 1.1
+*
+* iga::bt::Agent is the type of the owner of a behaviour tree, it is iga::bt::BTAgent in every build.
+* Code that uses the owner of a tree only uses the interface of BTAgent, so it compiles the same with
+* and without the engine.
+*
+* Headless builds (IGART_BT_HEADLESS) don't have the engine; game code and tools derive their own
+* agents from BTAgent. Engine builds wrap entities in an iga::bt::BTEntityAgent, see bt_entity_agent.h.
+* A behaviour tree only asks its owner for its ID, which names the behaviour tree.
+*
+*/
+
+/**
+*  igart namespace
+*/
+namespace iga {
+
+    /**
+    *  BT namespace
+    */
+    namespace bt {
+
+        /**
+        *   iga::bt::BTAgent; Owner of a behaviour tree.
+        */
+        class BTAgent {
+        public:
+
+            /** BTAgent Destructor */
+            virtual ~BTAgent() { /*EMPTY*/ }
+
+            /**
+            *   Returns the ID of the agent.
+            *   @return unsigned int value.
+            */
+            virtual unsigned int GetID() const = 0;
+
+        };
+
+        typedef BTAgent Agent;          /**< Owner type of behaviour trees. */
+
+    } // End of namespace ~ bt
+
+} // End of namespace ~ iga
@@ -0,0 +1,245 @@
+#include <AI/BT/bt_asset_library.h>
+
+#include <AI/BT/bt_runtime_asset.h>
+#include <AI/BT/bt_cooker.h>
+
+#include <AI/BT/bt_platform.h>
+
+#include <chrono>
+#include <cstdint>
+#include <iostream>
+
+#if defined(_WIN32)
+#ifndef NOMINMAX
+#define NOMINMAX
+#endif
+#include <windows.h>
+#else
+#include <sys/stat.h>
+#endif
+
+namespace {
+
+    /**
+    *   Returns the time of the last write of a file.
+    *   @param std::string a_file_path The file path.
+    *   @param std::uint64_t a_time The container that the time gets stored in, only comparable with other results.
+    *   @return bool - If True ~ The file exists.
+    */
+    bool GetLastWriteTime(const std::string& a_file_path, std::uint64_t& a_time) {
+#if defined(_WIN32)
+        WIN32_FILE_ATTRIBUTE_DATA attributes;
+        if (!GetFileAttributesExA(a_file_path.c_str(), GetFileExInfoStandard, &attributes)) { return false; }
+
+        a_time = (static_cast<std::uint64_t>(attributes.ftLastWriteTime.dwHighDateTime) << 32) | attributes.ftLastWriteTime.dwLowDateTime;
+#else
+        struct stat file_stat;
+        if (stat(a_file_path.c_str(), &file_stat) != 0) { return false; }
+
+        a_time = static_cast<std::uint64_t>(file_stat.st_mtime);
+#endif
+        return true;
+    }
+
+}
+
+namespace iga {
+
+    namespace bt {
+
+        BTAssetLibrary::BTAssetLibrary() { /*EMPTY*/ }
+
+        BTAssetLibrary::~BTAssetLibrary() {
+            {
+                std::lock_guard<std::mutex> lock(this->mutex_);
+                this->stopping_ = true;
+            }
+            this->condition_.notify_all();
+
+            if (this->worker_.joinable()) {
+                this->worker_.join();
+            }
+
+            // Loads that never started still have to be published.
+            for (auto& request : this->requests_) {
+                request.second.set_value(AssetPtr());
+            }
+            this->requests_.clear();
+        }
+
+        BTAssetLibrary& BTAssetLibrary::Get() {
+            static BTAssetLibrary library;
+            return library;
+        }
+
+        BTAssetLibrary::AssetPtr BTAssetLibrary::Load(const std::string& a_asset_path) {
+            std::promise<AssetPtr> promise;
+            AssetFuture future;
+            bool load = false;
+            {
+                std::lock_guard<std::mutex> lock(this->mutex_);
+
+                std::unordered_map<std::string, AssetFuture>::const_iterator it = this->assets_.find(a_asset_path);
+                if (it != this->assets_.end()) {
+                    future = it->second;
+                } else {
+                    future = promise.get_future().share();
+                    this->assets_.emplace(a_asset_path, future);
+                    load = true;
+                }
+            }
+
+            // Load outside of the lock, other assets can still be requested meanwhile.
+            if (load) {
+                FinishLoad(a_asset_path, promise, LoadAsset(a_asset_path));
+            }
+
+            return future.get();
+        }
+
+        BTAssetLibrary::AssetFuture BTAssetLibrary::LoadAsync(const std::string& a_asset_path) {
+            AssetFuture future;
+            {
+                std::lock_guard<std::mutex> lock(this->mutex_);
+
+                std::unordered_map<std::string, AssetFuture>::const_iterator it = this->assets_.find(a_asset_path);
+                if (it != this->assets_.end()) {
+                    return it->second;
+                }
+
+                std::promise<AssetPtr> promise;
+                future = promise.get_future().share();
+
+                if (this->stopping_) {
+                    promise.set_value(AssetPtr());
+                    return future;
+                }
+
+                this->assets_.emplace(a_asset_path, future);
+                this->requests_.emplace_back(a_asset_path, std::move(promise));
+
+                if (!this->worker_.joinable()) {
+                    this->worker_ = std::thread(&BTAssetLibrary::WorkerLoop, this);
+                }
+            }
+            this->condition_.notify_one();
+
+            return future;
+        }
+
+        void BTAssetLibrary::Prefetch(const std::vector<std::string>& a_asset_paths) {
+            for (auto& asset_path : a_asset_paths) {
+                LoadAsync(asset_path);
+            }
+        }
+
+        bool BTAssetLibrary::IsLoaded(const std::string& a_asset_path) {
+            std::lock_guard<std::mutex> lock(this->mutex_);
+
+            std::unordered_map<std::string, AssetFuture>::const_iterator it = this->assets_.find(a_asset_path);
+            if (it == this->assets_.end()) { return false; }
+
+            return it->second.wait_for(std::chrono::seconds(0)) == std::future_status::ready && it->second.get() != nullptr;
+        }
+
+        void BTAssetLibrary::Release(const std::string& a_asset_path) {
+            std::lock_guard<std::mutex> lock(this->mutex_);
+            this->assets_.erase(a_asset_path);
+        }
+
+        void BTAssetLibrary::Clear() {
+            std::lock_guard<std::mutex> lock(this->mutex_);
+            this->assets_.clear();
+        }
+
+        std::string BTAssetLibrary::GetFullPath(const std::string& a_asset_path) {
+            // Add asset folder prefix
+            std::string full_path = (FILEPATHPREFIX + a_asset_path);
+
+//TODO : ADD OTHER SUPPORT
+#ifdef SN_TARGET_PSP2
+            std::string win_dir("\\");
+            std::size_t found = full_path.find_first_of(win_dir);
+            while (found != std::string::npos) {
+                full_path[found] = '/';
+                found = full_path.find_first_of(win_dir, found + 1);
+            }
+#endif
+
+            return full_path;
+        }
+
+        BTAssetLibrary::AssetPtr BTAssetLibrary::LoadAsset(const std::string& a_asset_path) {
+            std::string full_path = GetFullPath(a_asset_path);
+
+            std::shared_ptr<BTRuntimeAsset> asset = std::make_shared<BTRuntimeAsset>();
+
+            // Runtime assets get mapped directly.
+            std::string extension = iga::GetFileExtension(full_path);
+            if (extension == BTCooker::btr_file_extension_) {
+                if (!asset->MapFile(full_path)) { return AssetPtr(); }
+                return asset;
+            }
+
+            // The editor cooks a runtime asset next to every BT File it saves; map it unless the BT File changed since.
+            std::string btr_path = full_path.substr(0, full_path.size() - extension.size()) + BTCooker::btr_file_extension_;
+            std::uint64_t btr_time = 0;
+            if (GetLastWriteTime(btr_path, btr_time)) {
+                // Headless builds can't cook, they map the runtime asset either way.
+                bool up_to_date = true;
+#ifndef IGART_BT_HEADLESS
+                std::uint64_t bt_time = 0;
+                up_to_date = !GetLastWriteTime(full_path, bt_time) || btr_time >= bt_time;
+#endif // IGART_BT_HEADLESS
+                if (up_to_date && asset->MapFile(btr_path)) { return asset; }
+            }
+
+#ifdef IGART_BT_HEADLESS
+            // Headless builds don't have the editor save format, BT Files have to be cooked up front.
+            std::cout << "ERROR - Behaviour Tree System - Headless builds only load runtime assets (" << BTCooker::btr_file_extension_ << "): " << full_path << std::endl;
+            return AssetPtr();
+#else
+            // Without an up to date runtime asset, the BT File gets cooked in memory.
+            BTCooker cooker;
+            std::vector<char> data;
+            if (!cooker.CookFile(full_path, data)) { return AssetPtr(); }
+            if (!asset->LoadFromMemory(std::move(data))) { return AssetPtr(); }
+
+            return asset;
+#endif // IGART_BT_HEADLESS
+        }
+
+        void BTAssetLibrary::FinishLoad(const std::string& a_asset_path, std::promise<AssetPtr>& a_promise, AssetPtr a_asset) {
+            bool failed = (a_asset == nullptr);
+            a_promise.set_value(std::move(a_asset));
+
+            if (!failed) { return; }
+
+            // Failed loads don't stay cached, so fixing the file and loading again works.
+            std::lock_guard<std::mutex> lock(this->mutex_);
+            std::unordered_map<std::string, AssetFuture>::iterator it = this->assets_.find(a_asset_path);
+            if (it != this->assets_.end() && it->second.wait_for(std::chrono::seconds(0)) == std::future_status::ready && it->second.get() == nullptr) {
+                this->assets_.erase(it);
+            }
+        }
+
+        void BTAssetLibrary::WorkerLoop() {
+            for (;;) {
+                std::pair<std::string, std::promise<AssetPtr>> request;
+                {
+                    std::unique_lock<std::mutex> lock(this->mutex_);
+                    this->condition_.wait(lock, [this]() { return this->stopping_ || !this->requests_.empty(); });
+
+                    if (this->stopping_) { return; }
+
+                    request = std::move(this->requests_.front());
+                    this->requests_.pop_front();
+                }
+
+                FinishLoad(request.first, request.second, LoadAsset(request.first));
+            }
+        }
+
+    } // End of namespace ~ bt
+
+} // End of namespace ~ iga
@@ -0,0 +1,145 @@
+#pragma once
+
+#include <condition_variable>
+#include <deque>
+#include <future>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+/**
+* @file bt_asset_library.h
+* @brief iga::bt::BTAssetLibrary Header File.
+*
+* @author Channing Eggers
+* @date 19 October 2026
+* @version $Revision 1.1
+*
+* BTAssetLibrary loads and caches the runtime assets of behaviour trees, so every behaviour tree
+* that is built from the same file shares one asset. Assets can be loaded on the calling thread
+* or on a worker thread of the library. File I/O and cooking never have to happen on the game thread;
+* levels can prefetch the assets of their entities before the entities get spawned.
+*
+* Runtime assets (.btr) get memory-mapped, so every process shares the pages of an asset. A BT File (.bt)
+* loads the runtime asset that the editor cooked next to it, unless the BT File is newer; only then it gets
+* cooked in memory. Headless builds (IGART_BT_HEADLESS) don't cook, they only load runtime assets.
+*
+*/
+
+/**
+*  igart namespace
+*/
+namespace iga {
+
+    /**
+    *  BT namespace
+    */
+    namespace bt {
+
+        class BTRuntimeAsset;
+
+        /**
+        *   iga::bt::BTAssetLibrary; Global cache of loaded runtime assets.
+        */
+        class BTAssetLibrary final {
+        public:
+
+            using AssetPtr      = std::shared_ptr<const BTRuntimeAsset>;    /**< Shared read-only runtime asset. */
+            using AssetFuture   = std::shared_future<AssetPtr>;             /**< Runtime asset that may still be loading. */
+
+            /**
+            *   Returns the asset library.
+            *   @return iga::bt::BTAssetLibrary reference.
+            */
+            static BTAssetLibrary& Get();
+
+            /**
+            *   Loads a runtime asset on the calling thread, or returns the cached asset.
+            *   Waits for the asset if it is being loaded on the worker thread.
+            *   @param std::string a_asset_path File path of the BT File or runtime asset, relative to the asset folder.
+            *   @return AssetPtr - The asset, empty if loading failed.
+            */
+            AssetPtr Load(const std::string& a_asset_path);
+
+            /**
+            *   Loads a runtime asset on the worker thread, or returns the cached asset.
+            *   @param std::string a_asset_path File path of the BT File or runtime asset, relative to the asset folder.
+            *   @return AssetFuture - Becomes ready once the asset has been loaded. Holds an empty asset if loading failed.
+            */
+            AssetFuture LoadAsync(const std::string& a_asset_path);
+
+            /**
+            *   Starts loading runtime assets on the worker thread, so that they are cached before they are needed.
+            *   @param std::vector<std::string> a_asset_paths File paths of the BT Files or runtime assets.
+            */
+            void Prefetch(const std::vector<std::string>& a_asset_paths);
+
+            /**
+            *   Returns True if the asset has been loaded and is cached.
+            *   @param std::string a_asset_path File path of the BT File or runtime asset.
+            *   @return bool value.
+            */
+            bool IsLoaded(const std::string& a_asset_path);
+
+            /**
+            *   Removes an asset from the cache. Behaviour trees that were built from the asset keep it loaded.
+            *   @param std::string a_asset_path File path of the BT File or runtime asset.
+            */
+            void Release(const std::string& a_asset_path);
+
+            /** Removes all assets from the cache. */
+            void Clear();
+
+            /**
+            *   Returns the full file path of an asset path.
+            *   @param std::string a_asset_path File path of the BT File or runtime asset, relative to the asset folder.
+            *   @return std::string value.
+            */
+            static std::string GetFullPath(const std::string& a_asset_path);
+
+        private:
+
+            /** BTAssetLibrary Constructor */
+            BTAssetLibrary();
+
+            /** BTAssetLibrary Destructor. Stops the worker thread. */
+            ~BTAssetLibrary();
+
+            BTAssetLibrary(const BTAssetLibrary&) = delete;
+            BTAssetLibrary& operator=(const BTAssetLibrary&) = delete;
+
+            /**
+            *   Loads a runtime asset. Runtime assets (.btr) get mapped directly. BT Files map the runtime asset
+            *   next to them if it isn't older than the BT File, otherwise they get cooked in memory.
+            *   @param std::string a_asset_path File path of the BT File or runtime asset, relative to the asset folder.
+            *   @return AssetPtr - The asset, empty if loading failed.
+            */
+            static AssetPtr LoadAsset(const std::string& a_asset_path);
+
+            /**
+            *   Finishes a load; publishes the asset and removes failed loads from the cache so they can be retried.
+            *   @param std::string a_asset_path File path of the asset.
+            *   @param std::promise<AssetPtr> a_promise The promise of the load.
+            *   @param AssetPtr a_asset The loaded asset.
+            */
+            void FinishLoad(const std::string& a_asset_path, std::promise<AssetPtr>& a_promise, AssetPtr a_asset);
+
+            /** Loop of the worker thread. */
+            void WorkerLoop();
+
+            std::mutex mutex_;                                          /**< Guards the cache and the requests. */
+            std::condition_variable condition_;                         /**< Wakes the worker thread. */
+            std::unordered_map<std::string, AssetFuture> assets_;       /**< Loaded and loading assets, by asset path. */
+            std::deque<std::pair<std::string, std::promise<AssetPtr>>> requests_; /**< Assets that the worker thread has to load. */
+            std::thread worker_;                                        /**< Worker thread, started by the first asynchronous load. */
+            bool stopping_ = false;                                     /**< True once the worker thread has to stop. */
+
+        };
+
+    } // End of namespace ~ bt
+
+} // End of namespace ~ iga
@@ -0,0 +1,256 @@
+#include <AI/BT/bt_batch_interpreter.h>
+
+#include <AI/BT/behaviour_tree.h>
+#include <AI/BT/black_board.h>
+#include <AI/BT/bt_runtime_stats.h>
+#include <AI/BT/Nodes/base_node.h>
+
+#include <algorithm>
+#include <bitset>
+#include <iostream>
+
+namespace iga {
+
+    namespace bt {
+
+#pragma region BTBatchMask
+
+        void BTBatchMask::Resize(std::uint32_t a_row_count) {
+            this->row_count_ = a_row_count;
+            this->words_.assign((static_cast<std::size_t>(a_row_count) + 63) / 64, 0);
+        }
+
+        void BTBatchMask::SetAll() {
+            std::fill(this->words_.begin(), this->words_.end(), ~std::uint64_t(0));
+
+            // Bits past the last row stay clear.
+            if ((this->row_count_ & 63) != 0) {
+                this->words_.back() = (std::uint64_t(1) << (this->row_count_ & 63)) - 1;
+            }
+        }
+
+        void BTBatchMask::ClearAll() {
+            std::fill(this->words_.begin(), this->words_.end(), 0);
+        }
+
+        void BTBatchMask::Assign(const BTBatchMask& a_other) {
+            DEBUGASSERT(a_other.row_count_ == this->row_count_);
+            std::copy(a_other.words_.begin(), a_other.words_.end(), this->words_.begin());
+        }
+
+        void BTBatchMask::Or(const BTBatchMask& a_other) {
+            DEBUGASSERT(a_other.row_count_ == this->row_count_);
+            for (std::size_t i = 0; i < this->words_.size(); ++i) {
+                this->words_[i] |= a_other.words_[i];
+            }
+        }
+
+        void BTBatchMask::And(const BTBatchMask& a_other) {
+            DEBUGASSERT(a_other.row_count_ == this->row_count_);
+            for (std::size_t i = 0; i < this->words_.size(); ++i) {
+                this->words_[i] &= a_other.words_[i];
+            }
+        }
+
+        void BTBatchMask::AndNot(const BTBatchMask& a_other) {
+            DEBUGASSERT(a_other.row_count_ == this->row_count_);
+            for (std::size_t i = 0; i < this->words_.size(); ++i) {
+                this->words_[i] &= ~a_other.words_[i];
+            }
+        }
+
+        bool BTBatchMask::IsEmpty() const {
+            for (auto& word : this->words_) {
+                if (word != 0) { return false; }
+            }
+            return true;
+        }
+
+        std::uint32_t BTBatchMask::Count() const {
+            std::uint32_t count = 0;
+            for (auto& word : this->words_) {
+                count += static_cast<std::uint32_t>(std::bitset<64>(word).count());
+            }
+            return count;
+        }
+
+#pragma endregion End of BTBatchMask
+
+#pragma region BTBatchResult
+
+        void BTBatchResult::Resize(std::uint32_t a_row_count) {
+            for (auto& mask : this->masks) {
+                mask.Resize(a_row_count);
+            }
+        }
+
+        void BTBatchResult::ClearAll() {
+            for (auto& mask : this->masks) {
+                mask.ClearAll();
+            }
+        }
+
+        void BTBatchResult::Merge(const BTBatchResult& a_other, NodeResult a_except) {
+            for (int i = 0; i < 4; ++i) {
+                if (i != static_cast<int>(a_except)) {
+                    this->masks[i].Or(a_other.masks[i]);
+                }
+            }
+        }
+
+#pragma endregion End of BTBatchResult
+
+        BTBatchInterpreter::BTBatchInterpreter(BehaviourTree& a_template, BlackBoardStore& a_store, BlackBoardStore::TableID a_table) :
+            template_(a_template),
+            store_(a_store),
+            table_(a_table)
+        { /*EMPTY*/ }
+
+        BTBatchInterpreter::~BTBatchInterpreter() { /*EMPTY*/ }
+
+        void BTBatchInterpreter::BindTree(BlackBoardStore::AgentID a_agent, BehaviourTree* a_tree) {
+            if (a_agent >= this->agent_trees_.size()) {
+                this->agent_trees_.resize(static_cast<std::size_t>(a_agent) + 1, nullptr);
+                this->agent_nodes_.resize(static_cast<std::size_t>(a_agent) + 1);
+            }
+
+            std::vector<BaseNode*>& agent_nodes = this->agent_nodes_[a_agent];
+            this->agent_trees_[a_agent] = nullptr;
+            agent_nodes.clear();
+            if (a_tree == nullptr) { return; }
+
+            std::vector<BaseNode*> tracked_nodes;
+            a_tree->GetTrackedNodes(&tracked_nodes);
+            if (tracked_nodes.size() != this->template_.GetNodeCount()) {
+                std::cout << "ERROR - Behaviour Tree System - Bound tree doesn't match the batch template: " << a_tree->GetFilePath() << std::endl;
+                return;
+            }
+
+            this->agent_trees_[a_agent] = a_tree;
+            agent_nodes.resize(tracked_nodes.size(), nullptr);
+            for (auto& node : tracked_nodes) {
+                agent_nodes[node->GetNodeIndex()] = node;
+            }
+        }
+
+        void BTBatchInterpreter::Tick() {
+            BaseNode* root = this->template_.GetRoot();
+            if (root == nullptr) { return; }
+
+            this->row_count_ = this->store_.GetAgentCount(this->table_);
+            this->active_.Resize(this->row_count_);
+            this->active_.SetAll();
+            this->results_.Resize(this->row_count_);
+
+            this->node_visits_ = 0;
+            this->running_nodes_ = 0;
+
+            // Writes posted to the blackboards of the bound trees become visible at the start of the pass.
+            for (std::uint32_t row = 0; row < this->row_count_; ++row) {
+                BlackBoardStore::AgentID agent = this->store_.GetAgent(this->table_, row);
+                if (agent < this->agent_trees_.size() && this->agent_trees_[agent] != nullptr) {
+                    this->agent_trees_[agent]->GetBlackBoard()->PublishPendingWrites();
+                }
+            }
+
+            Execute(root, this->active_, this->results_);
+
+            // Publish the counts of this pass at once, one tick per agent.
+            BTRuntimeStats::Get().OnTreeTicked(this->node_visits_, this->running_nodes_, this->row_count_);
+        }
+
+        NodeResult BTBatchInterpreter::GetResult(BlackBoardStore::AgentID a_agent) const {
+            if (this->store_.GetTable(a_agent) != this->table_) { return NodeResult::FATAL_ERROR; }
+
+            std::uint32_t row = this->store_.GetRow(a_agent);
+            if (row >= this->row_count_) { return NodeResult::FATAL_ERROR; }
+
+            for (int i = 0; i < 4; ++i) {
+                if (this->results_.masks[i].Test(row)) { return static_cast<NodeResult>(i); }
+            }
+            return NodeResult::FATAL_ERROR;
+        }
+
+        const BTBatchResult& BTBatchInterpreter::GetResults() const {
+            return this->results_;
+        }
+
+        void BTBatchInterpreter::Execute(const BaseNode* a_node, const BTBatchMask& a_active, BTBatchResult& a_result) {
+            a_result.ClearAll();
+            if (a_active.IsEmpty()) { return; }
+
+            if (!a_node->ExecuteBatch(*this, a_active, a_result)) {
+                ExecuteFallback(a_node, a_active, a_result);
+                return;
+            }
+
+            this->node_visits_ += a_active.Count();
+            this->running_nodes_ += a_result.Get(NodeResult::RUNNING).Count();
+        }
+
+        BTBatchFrame& BTBatchInterpreter::PushFrame() {
+            if (this->frame_count_ == this->frames_.size()) {
+                this->frames_.push_back(std::make_unique<BTBatchFrame>());
+            }
+
+            BTBatchFrame& frame = *this->frames_[this->frame_count_++];
+            frame.active.Resize(this->row_count_);
+            frame.result.Resize(this->row_count_);
+            return frame;
+        }
+
+        void BTBatchInterpreter::PopFrame() {
+            DEBUGASSERT(this->frame_count_ > 0);
+            --this->frame_count_;
+        }
+
+        BlackBoardStore& BTBatchInterpreter::GetStore() const {
+            return this->store_;
+        }
+
+        BlackBoardStore::TableID BTBatchInterpreter::GetTable() const {
+            return this->table_;
+        }
+
+        std::uint32_t BTBatchInterpreter::GetRowCount() const {
+            return this->row_count_;
+        }
+
+        std::uint32_t BTBatchInterpreter::FindColumn(const std::string& a_id, BlackBoardTypes a_type) const {
+            return this->store_.FindColumn(this->table_, a_id, a_type);
+        }
+
+        BlackBoard* BTBatchInterpreter::GetBoundBlackBoard(std::uint32_t a_row) const {
+            BlackBoardStore::AgentID agent = this->store_.GetAgent(this->table_, a_row);
+            if (agent >= this->agent_trees_.size() || this->agent_trees_[agent] == nullptr) { return nullptr; }
+
+            return this->agent_trees_[agent]->GetBlackBoard();
+        }
+
+        void BTBatchInterpreter::ExecuteFallback(const BaseNode* a_node, const BTBatchMask& a_active, BTBatchResult& a_result) {
+            std::uint32_t node_index = a_node->GetNodeIndex();
+
+            const std::uint64_t* words = a_active.GetWords();
+            for (std::size_t word_index = 0; word_index < a_active.GetWordCount(); ++word_index) {
+                std::uint64_t word = words[word_index];
+                for (std::uint32_t bit = 0; word != 0; ++bit, word >>= 1) {
+                    if ((word & 1) == 0) { continue; }
+
+                    std::uint32_t row = static_cast<std::uint32_t>(word_index * 64) + bit;
+                    BlackBoardStore::AgentID agent = this->store_.GetAgent(this->table_, row);
+
+                    NodeResult result = NodeResult::FATAL_ERROR;
+                    if (agent < this->agent_nodes_.size() && node_index < this->agent_nodes_[agent].size()) {
+                        result = this->agent_nodes_[agent][node_index]->ExecuteNode();
+                    }
+
+                    a_result.Get(result).Set(row);
+                    ++this->node_visits_;
+                    if (result == NodeResult::RUNNING) { ++this->running_nodes_; }
+                }
+            }
+        }
+
+    } // End of namespace ~ bt
+
+} // End of namespace ~ iga
@@ -0,0 +1,308 @@
+#pragma once
+
+#include <AI/BT/black_board_store.h>
+#include <AI/BT/Nodes/node_enums.h>
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <vector>
+
+/**
+* @file bt_batch_interpreter.h
+* @brief iga::bt::BTBatchInterpreter Header File.
+*
+* @author Channing Eggers
+* @date 19 October 2026
+* @version $Revision 1.1
+*
+* The batch interpreter executes one tree template for every agent of a table of an iga::bt::BlackBoardStore
+* at once. It walks the tree node by node instead of agent by agent; every node gets executed once per pass,
+* for a mask of the agents that reach it, and returns a mask of the agents per result. A Sequence continues
+* with the agents that succeeded, a Selector with the agents that failed, until no agent is left.
+*
+* Nodes support batches by overriding iga::bt::BaseNode::ExecuteBatch, which reads and writes the columns of
+* the store. Nodes that don't are executed per agent, on the tree of the agent that was bound with BindTree;
+* those nodes use the blackboard of that tree, not the store. Agents without a bound tree get FATAL_ERROR.
+* Nodes that write the store in a batch write the blackboards of the bound trees too, see GetBoundBlackBoard,
+* so nodes that get executed per agent read the same values.
+*
+* The interpreter doesn't run the debugger or record coverage. Runtime statistics get published once per pass.
+* The tree template, the store and the bound trees must not change during a pass.
+*
+*/
+
+/**
+*  igart namespace
+*/
+namespace iga {
+
+    /**
+    *  BT namespace
+    */
+    namespace bt {
+
+        class BaseNode;
+        class BehaviourTree;
+        class BlackBoard;
+
+        /**
+        *   iga::bt::BTBatchMask; A bit per row of a table.
+        */
+        class BTBatchMask final {
+        public:
+
+            /**
+            *   Sets the amount of rows and clears all bits.
+            *   @param std::uint32_t a_row_count The amount of rows.
+            */
+            void Resize(std::uint32_t a_row_count);
+
+            /** Sets the bits of all rows. */
+            void SetAll();
+
+            /** Clears all bits. */
+            void ClearAll();
+
+            /**
+            *   Copies the bits of another mask, of the same size.
+            *   @param BTBatchMask a_other The other mask.
+            */
+            void Assign(const BTBatchMask& a_other);
+
+            /**
+            *   Sets the bits that are set in another mask, of the same size.
+            *   @param BTBatchMask a_other The other mask.
+            */
+            void Or(const BTBatchMask& a_other);
+
+            /**
+            *   Clears the bits that aren't set in another mask, of the same size.
+            *   @param BTBatchMask a_other The other mask.
+            */
+            void And(const BTBatchMask& a_other);
+
+            /**
+            *   Clears the bits that are set in another mask, of the same size.
+            *   @param BTBatchMask a_other The other mask.
+            */
+            void AndNot(const BTBatchMask& a_other);
+
+            /**
+            *   Returns whether no bit is set.
+            *   @return bool - If True ~ No bit is set.
+            */
+            bool IsEmpty() const;
+
+            /**
+            *   Returns the amount of bits that are set.
+            *   @return std::uint32_t value.
+            */
+            std::uint32_t Count() const;
+
+            /** Sets the bit of a row. */
+            void Set(std::uint32_t a_row) { this->words_[a_row >> 6] |= (std::uint64_t(1) << (a_row & 63)); }
+
+            /** Clears the bit of a row. */
+            void Clear(std::uint32_t a_row) { this->words_[a_row >> 6] &= ~(std::uint64_t(1) << (a_row & 63)); }
+
+            /** Returns whether the bit of a row is set. */
+            bool Test(std::uint32_t a_row) const { return (this->words_[a_row >> 6] >> (a_row & 63)) & 1; }
+
+            /**
+            *   Returns the amount of rows.
+            *   @return std::uint32_t value.
+            */
+            std::uint32_t GetRowCount() const { return this->row_count_; }
+
+            /**
+            *   Returns the amount of 64 bit words of the mask.
+            *   @return std::size_t value.
+            */
+            std::size_t GetWordCount() const { return this->words_.size(); }
+
+            /**
+            *   Returns the words of the mask. Row i is bit i % 64 of word i / 64. Bits past the last row are always clear.
+            *   @return std::uint64_t pointer.
+            */
+            std::uint64_t* GetWords() { return this->words_.data(); }
+            const std::uint64_t* GetWords() const { return this->words_.data(); }
+
+        private:
+
+            std::vector<std::uint64_t> words_;  /**< The bits. */
+            std::uint32_t row_count_ = 0;       /**< Amount of rows. */
+
+        };
+
+        /**
+        *   iga::bt::BTBatchResult; The agents per result of a node. Every agent that executed the node is in exactly one mask.
+        */
+        struct BTBatchResult {
+            BTBatchMask masks[4];   /**< A mask per iga::bt::NodeResult. */
+
+            /**
+            *   Returns the mask of a result.
+            *   @param NodeResult a_result The result.
+            *   @return BTBatchMask reference.
+            */
+            BTBatchMask& Get(NodeResult a_result) { return this->masks[static_cast<int>(a_result)]; }
+            const BTBatchMask& Get(NodeResult a_result) const { return this->masks[static_cast<int>(a_result)]; }
+
+            /**
+            *   Sets the amount of rows of all masks and clears them.
+            *   @param std::uint32_t a_row_count The amount of rows.
+            */
+            void Resize(std::uint32_t a_row_count);
+
+            /** Clears all masks. */
+            void ClearAll();
+
+            /**
+            *   Adds the agents of another result, apart from the agents of one result.
+            *   @param BTBatchResult a_other The other result.
+            *   @param NodeResult a_except The result whose agents don't get added.
+            */
+            void Merge(const BTBatchResult& a_other, NodeResult a_except);
+        };
+
+        /**
+        *   iga::bt::BTBatchFrame; Scratch memory of a node that executes its children, see BTBatchInterpreter::PushFrame.
+        */
+        struct BTBatchFrame {
+            BTBatchMask active;     /**< The agents that continue. */
+            BTBatchResult result;   /**< The result of a child. */
+        };
+
+        /**
+        *   iga::bt::BTBatchInterpreter; Executes a tree template for all agents of a table of a blackboard store.
+        */
+        class BTBatchInterpreter final {
+        public:
+
+            /**
+            *   BTBatchInterpreter Constructor
+            *   @param BehaviourTree a_template The tree template. Only its nodes get used, it doesn't get executed.
+            *   @param BlackBoardStore a_store The store.
+            *   @param BlackBoardStore::TableID a_table The table of the agents that run the template.
+            */
+            BTBatchInterpreter(BehaviourTree& a_template, BlackBoardStore& a_store, BlackBoardStore::TableID a_table);
+
+            /** BTBatchInterpreter Destructor */
+            ~BTBatchInterpreter();
+
+            BTBatchInterpreter(const BTBatchInterpreter&) = delete;
+            BTBatchInterpreter& operator=(const BTBatchInterpreter&) = delete;
+
+            /**
+            *   Binds the tree of an agent, which executes the nodes that don't support batches for the agent.
+            *   The tree has to be built from the same BT File as the template.
+            *   @param BlackBoardStore::AgentID a_agent The agent.
+            *   @param BehaviourTree a_tree Pointer to the tree of the agent, nullptr unbinds the tree.
+            */
+            void BindTree(BlackBoardStore::AgentID a_agent, BehaviourTree* a_tree);
+
+            /** Executes the tree template once for every agent of the table. */
+            void Tick();
+
+            /**
+            *   Returns the result of the last pass for an agent. Only valid until agents get added to or removed from the table.
+            *   @param BlackBoardStore::AgentID a_agent The agent.
+            *   @return NodeResult value, FATAL_ERROR if the agent wasn't part of the last pass.
+            */
+            NodeResult GetResult(BlackBoardStore::AgentID a_agent) const;
+
+            /**
+            *   Returns the results of the last pass, by row.
+            *   @return BTBatchResult reference.
+            */
+            const BTBatchResult& GetResults() const;
+
+#pragma region BTBatchInterpreter Node Functions
+
+            /**
+            *   Executes a node for the agents of a mask. Called by the nodes that execute their children.
+            *   @param BaseNode a_node The node, part of the tree template.
+            *   @param BTBatchMask a_active The agents that execute the node.
+            *   @param BTBatchResult a_result The container that the agents get stored in, by result.
+            */
+            void Execute(const BaseNode* a_node, const BTBatchMask& a_active, BTBatchResult& a_result);
+
+            /**
+            *   Returns scratch memory for a node that executes its children, sized to the rows of the table.
+            *   Has to be returned with PopFrame before the node returns.
+            *   @return BTBatchFrame reference, valid until PopFrame.
+            */
+            BTBatchFrame& PushFrame();
+
+            /** Returns the scratch memory of the last PushFrame. */
+            void PopFrame();
+
+            /**
+            *   Returns the store.
+            *   @return BlackBoardStore reference.
+            */
+            BlackBoardStore& GetStore() const;
+
+            /**
+            *   Returns the table of the agents.
+            *   @return BlackBoardStore::TableID value.
+            */
+            BlackBoardStore::TableID GetTable() const;
+
+            /**
+            *   Returns the amount of rows of the current pass.
+            *   @return std::uint32_t value.
+            */
+            std::uint32_t GetRowCount() const;
+
+            /**
+            *   Returns the column of a key in the table.
+            *   @param std::string a_id ID of the key.
+            *   @param BlackBoardTypes a_type Type of the key.
+            *   @return std::uint32_t Index of the column, BlackBoardStore::invalid_ if the table doesn't have the key.
+            */
+            std::uint32_t FindColumn(const std::string& a_id, BlackBoardTypes a_type) const;
+
+            /**
+            *   Returns the blackboard of the bound tree of the agent of a row. Nodes that write the store have to
+            *   write it too, since the nodes that don't support batches read it instead of the store.
+            *   @param std::uint32_t a_row The row.
+            *   @return BlackBoard pointer, nullptr if the agent has no bound tree.
+            */
+            BlackBoard* GetBoundBlackBoard(std::uint32_t a_row) const;
+
+#pragma endregion End of BTBatchInterpreter Node Functions
+
+        private:
+
+            /**
+            *   Executes a node per agent, on the bound trees.
+            *   @param BaseNode a_node The node, part of the tree template.
+            *   @param BTBatchMask a_active The agents that execute the node.
+            *   @param BTBatchResult a_result The container that the agents get stored in, by result.
+            */
+            void ExecuteFallback(const BaseNode* a_node, const BTBatchMask& a_active, BTBatchResult& a_result);
+
+            BehaviourTree& template_;                   /**< The tree template. */
+            BlackBoardStore& store_;                    /**< The store. */
+            BlackBoardStore::TableID table_;            /**< The table of the agents. */
+            std::uint32_t row_count_ = 0;               /**< Amount of rows of the current pass. */
+
+            std::vector<BehaviourTree*> agent_trees_;               /**< Bound tree of every agent, nullptr if no tree is bound. */
+            std::vector<std::vector<BaseNode*>> agent_nodes_;       /**< Nodes of the bound tree of every agent, by node index. */
+            std::vector<std::unique_ptr<BTBatchFrame>> frames_;     /**< Scratch memory, reused between passes. */
+            std::size_t frame_count_ = 0;                           /**< Amount of frames in use. */
+
+            BTBatchMask active_;                        /**< All agents of the current pass. */
+            BTBatchResult results_;                     /**< Results of the last pass. */
+
+            std::uint32_t node_visits_ = 0;             /**< Node executions of the current pass, per agent. */
+            std::uint32_t running_nodes_ = 0;           /**< RUNNING results of the current pass, per agent. */
+
+        };
+
+    } // End of namespace ~ bt
+
+} // End of namespace ~ iga
@@ -0,0 +1,240 @@
+#include <AI/BT/bt_batch_kernels.h>
+
+#if defined(__AVX2__)
+#define BT_AVX2
+#include <immintrin.h>
+#endif
+
+namespace iga {
+
+    namespace bt {
+
+        namespace {
+
+            /**
+            *   Compares integer lanes. Integers only have equal and greater compares, the other compares are derived from them.
+            *   @return TLanes::Vector All bits set in the lanes that pass.
+            */
+            template<CompareOperator TOperator, typename TLanes>
+            typename TLanes::Vector CompareIntegerLanes(typename TLanes::Vector a_values, typename TLanes::Vector a_compare, typename TLanes::Vector a_max) {
+                switch (TOperator) {
+                case CompareOperator::EQUAL:            { return TLanes::Equal(a_values, a_compare); }
+                case CompareOperator::NOT_EQUAL:        { return TLanes::Not(TLanes::Equal(a_values, a_compare)); }
+                case CompareOperator::LESS:             { return TLanes::Greater(a_compare, a_values); }
+                case CompareOperator::LESS_EQUAL:       { return TLanes::Not(TLanes::Greater(a_values, a_compare)); }
+                case CompareOperator::GREATER:          { return TLanes::Greater(a_values, a_compare); }
+                case CompareOperator::GREATER_EQUAL:    { return TLanes::Not(TLanes::Greater(a_compare, a_values)); }
+                case CompareOperator::IN_RANGE:         { return TLanes::Not(TLanes::Or(TLanes::Greater(a_compare, a_values), TLanes::Greater(a_values, a_max))); }
+                }
+                return a_values;
+            }
+
+            /**
+            *   Compares float lanes. Every compare is native, so NaN behaves like it does for scalar floats.
+            *   @return TLanes::Vector All bits set in the lanes that pass.
+            */
+            template<CompareOperator TOperator, typename TLanes>
+            typename TLanes::Vector CompareFloatLanes(typename TLanes::Vector a_values, typename TLanes::Vector a_compare, typename TLanes::Vector a_max) {
+                switch (TOperator) {
+                case CompareOperator::EQUAL:            { return TLanes::Equal(a_values, a_compare); }
+                case CompareOperator::NOT_EQUAL:        { return TLanes::NotEqual(a_values, a_compare); }
+                case CompareOperator::LESS:             { return TLanes::Less(a_values, a_compare); }
+                case CompareOperator::LESS_EQUAL:       { return TLanes::LessEqual(a_values, a_compare); }
+                case CompareOperator::GREATER:          { return TLanes::Greater(a_values, a_compare); }
+                case CompareOperator::GREATER_EQUAL:    { return TLanes::GreaterEqual(a_values, a_compare); }
+                case CompareOperator::IN_RANGE:         { return TLanes::And(TLanes::GreaterEqual(a_values, a_compare), TLanes::LessEqual(a_values, a_max)); }
+                }
+                return a_values;
+            }
+
+#if defined(BT_AVX2)
+
+            /** 8 ints per compare. */
+            struct IntLanes {
+                typedef int Value;
+                typedef __m256i Vector;
+                static const std::uint32_t count_ = 8;
+                static Vector Set(Value a_value) { return _mm256_set1_epi32(a_value); }
+                static Vector Load(const Value* a_values) { return _mm256_loadu_si256(reinterpret_cast<const __m256i*>(a_values)); }
+                static Vector Not(Vector a_a) { return _mm256_xor_si256(a_a, _mm256_set1_epi32(-1)); }
+                static Vector Or(Vector a_a, Vector a_b) { return _mm256_or_si256(a_a, a_b); }
+                static Vector Equal(Vector a_a, Vector a_b) { return _mm256_cmpeq_epi32(a_a, a_b); }
+                static Vector Greater(Vector a_a, Vector a_b) { return _mm256_cmpgt_epi32(a_a, a_b); }
+                static std::uint32_t Bits(Vector a_a) { return static_cast<std::uint32_t>(_mm256_movemask_ps(_mm256_castsi256_ps(a_a))); }
+                template<CompareOperator TOperator> static Vector Compare(Vector a_values, Vector a_compare, Vector a_max) { return CompareIntegerLanes<TOperator, IntLanes>(a_values, a_compare, a_max); }
+            };
+
+            /** 32 bytes per compare. */
+            struct ByteLanes {
+                typedef std::uint8_t Value;
+                typedef __m256i Vector;
+                static const std::uint32_t count_ = 32;
+                static Vector Set(Value a_value) { return _mm256_set1_epi8(static_cast<char>(a_value)); }
+                static Vector Load(const Value* a_values) { return _mm256_loadu_si256(reinterpret_cast<const __m256i*>(a_values)); }
+                static Vector Not(Vector a_a) { return _mm256_xor_si256(a_a, _mm256_set1_epi32(-1)); }
+                static Vector Or(Vector a_a, Vector a_b) { return _mm256_or_si256(a_a, a_b); }
+                static Vector Equal(Vector a_a, Vector a_b) { return _mm256_cmpeq_epi8(a_a, a_b); }
+                static Vector Greater(Vector a_a, Vector a_b) { return _mm256_cmpgt_epi8(a_a, a_b); }
+                static std::uint32_t Bits(Vector a_a) { return static_cast<std::uint32_t>(_mm256_movemask_epi8(a_a)); }
+                template<CompareOperator TOperator> static Vector Compare(Vector a_values, Vector a_compare, Vector a_max) { return CompareIntegerLanes<TOperator, ByteLanes>(a_values, a_compare, a_max); }
+            };
+
+            /** 8 floats per compare. */
+            struct FloatLanes {
+                typedef float Value;
+                typedef __m256 Vector;
+                static const std::uint32_t count_ = 8;
+                static Vector Set(Value a_value) { return _mm256_set1_ps(a_value); }
+                static Vector Load(const Value* a_values) { return _mm256_loadu_ps(a_values); }
+                static Vector And(Vector a_a, Vector a_b) { return _mm256_and_ps(a_a, a_b); }
+                static Vector Equal(Vector a_a, Vector a_b) { return _mm256_cmp_ps(a_a, a_b, _CMP_EQ_OQ); }
+                static Vector NotEqual(Vector a_a, Vector a_b) { return _mm256_cmp_ps(a_a, a_b, _CMP_NEQ_UQ); }
+                static Vector Less(Vector a_a, Vector a_b) { return _mm256_cmp_ps(a_a, a_b, _CMP_LT_OQ); }
+                static Vector LessEqual(Vector a_a, Vector a_b) { return _mm256_cmp_ps(a_a, a_b, _CMP_LE_OQ); }
+                static Vector Greater(Vector a_a, Vector a_b) { return _mm256_cmp_ps(a_a, a_b, _CMP_GT_OQ); }
+                static Vector GreaterEqual(Vector a_a, Vector a_b) { return _mm256_cmp_ps(a_a, a_b, _CMP_GE_OQ); }
+                static std::uint32_t Bits(Vector a_a) { return static_cast<std::uint32_t>(_mm256_movemask_ps(a_a)); }
+                template<CompareOperator TOperator> static Vector Compare(Vector a_values, Vector a_compare, Vector a_max) { return CompareFloatLanes<TOperator, FloatLanes>(a_values, a_compare, a_max); }
+            };
+
+#define BT_BATCH_LANES
+
+#elif defined(BT_SSE2)
+
+            /** 4 ints per compare. */
+            struct IntLanes {
+                typedef int Value;
+                typedef __m128i Vector;
+                static const std::uint32_t count_ = 4;
+                static Vector Set(Value a_value) { return _mm_set1_epi32(a_value); }
+                static Vector Load(const Value* a_values) { return _mm_loadu_si128(reinterpret_cast<const __m128i*>(a_values)); }
+                static Vector Not(Vector a_a) { return _mm_xor_si128(a_a, _mm_set1_epi32(-1)); }
+                static Vector Or(Vector a_a, Vector a_b) { return _mm_or_si128(a_a, a_b); }
+                static Vector Equal(Vector a_a, Vector a_b) { return _mm_cmpeq_epi32(a_a, a_b); }
+                static Vector Greater(Vector a_a, Vector a_b) { return _mm_cmpgt_epi32(a_a, a_b); }
+                static std::uint32_t Bits(Vector a_a) { return static_cast<std::uint32_t>(_mm_movemask_ps(_mm_castsi128_ps(a_a))); }
+                template<CompareOperator TOperator> static Vector Compare(Vector a_values, Vector a_compare, Vector a_max) { return CompareIntegerLanes<TOperator, IntLanes>(a_values, a_compare, a_max); }
+            };
+
+            /** 16 bytes per compare. */
+            struct ByteLanes {
+                typedef std::uint8_t Value;
+                typedef __m128i Vector;
+                static const std::uint32_t count_ = 16;
+                static Vector Set(Value a_value) { return _mm_set1_epi8(static_cast<char>(a_value)); }
+                static Vector Load(const Value* a_values) { return _mm_loadu_si128(reinterpret_cast<const __m128i*>(a_values)); }
+                static Vector Not(Vector a_a) { return _mm_xor_si128(a_a, _mm_set1_epi32(-1)); }
+                static Vector Or(Vector a_a, Vector a_b) { return _mm_or_si128(a_a, a_b); }
+                static Vector Equal(Vector a_a, Vector a_b) { return _mm_cmpeq_epi8(a_a, a_b); }
+                static Vector Greater(Vector a_a, Vector a_b) { return _mm_cmpgt_epi8(a_a, a_b); }
+                static std::uint32_t Bits(Vector a_a) { return static_cast<std::uint32_t>(_mm_movemask_epi8(a_a)); }
+                template<CompareOperator TOperator> static Vector Compare(Vector a_values, Vector a_compare, Vector a_max) { return CompareIntegerLanes<TOperator, ByteLanes>(a_values, a_compare, a_max); }
+            };
+
+            /** 4 floats per compare. */
+            struct FloatLanes {
+                typedef float Value;
+                typedef __m128 Vector;
+                static const std::uint32_t count_ = 4;
+                static Vector Set(Value a_value) { return _mm_set1_ps(a_value); }
+                static Vector Load(const Value* a_values) { return _mm_loadu_ps(a_values); }
+                static Vector And(Vector a_a, Vector a_b) { return _mm_and_ps(a_a, a_b); }
+                static Vector Equal(Vector a_a, Vector a_b) { return _mm_cmpeq_ps(a_a, a_b); }
+                static Vector NotEqual(Vector a_a, Vector a_b) { return _mm_cmpneq_ps(a_a, a_b); }
+                static Vector Less(Vector a_a, Vector a_b) { return _mm_cmplt_ps(a_a, a_b); }
+                static Vector LessEqual(Vector a_a, Vector a_b) { return _mm_cmple_ps(a_a, a_b); }
+                static Vector Greater(Vector a_a, Vector a_b) { return _mm_cmpgt_ps(a_a, a_b); }
+                static Vector GreaterEqual(Vector a_a, Vector a_b) { return _mm_cmpge_ps(a_a, a_b); }
+                static std::uint32_t Bits(Vector a_a) { return static_cast<std::uint32_t>(_mm_movemask_ps(a_a)); }
+                template<CompareOperator TOperator> static Vector Compare(Vector a_values, Vector a_compare, Vector a_max) { return CompareFloatLanes<TOperator, FloatLanes>(a_values, a_compare, a_max); }
+            };
+
+#define BT_BATCH_LANES
+
+#else
+
+            /** Plain loops. */
+            struct IntLanes { typedef int Value; };
+            struct ByteLanes { typedef std::uint8_t Value; };
+            struct FloatLanes { typedef float Value; };
+
+#endif
+
+
+            /**
+            *   Compares a column with a constant and writes the rows that pass into a mask, 64 rows per word.
+            *   @param TLanes::Value* a_values The column.
+            *   @param std::uint32_t a_count Amount of rows.
+            *   @param TLanes::Value a_compare The compared value.
+            *   @param TLanes::Value a_max The max value of IN_RANGE.
+            *   @param std::uint64_t* a_mask The mask.
+            */
+            template<CompareOperator TOperator, typename TLanes>
+            void CompareColumn(const typename TLanes::Value* a_values, std::uint32_t a_count, typename TLanes::Value a_compare, typename TLanes::Value a_max, std::uint64_t* a_mask) {
+#ifdef BT_BATCH_LANES
+                const typename TLanes::Vector compare = TLanes::Set(a_compare);
+                const typename TLanes::Vector max = TLanes::Set(a_max);
+#endif // BT_BATCH_LANES
+
+                std::uint32_t full_words = a_count / 64;
+                for (std::uint32_t word = 0; word < full_words; ++word) {
+                    const typename TLanes::Value* values = a_values + word * 64;
+                    std::uint64_t bits = 0;
+#ifdef BT_BATCH_LANES
+                    for (std::uint32_t i = 0; i < 64; i += TLanes::count_) {
+                        typename TLanes::Vector passed = TLanes::template Compare<TOperator>(TLanes::Load(values + i), compare, max);
+                        bits |= std::uint64_t(TLanes::Bits(passed)) << i;
+                    }
+#else
+                    for (std::uint32_t i = 0; i < 64; ++i) {
+                        bits |= std::uint64_t(CompareValues<TOperator>(values[i], a_compare, a_max)) << i;
+                    }
+#endif // BT_BATCH_LANES
+                    a_mask[word] = bits;
+                }
+
+                // The rows of the last word, bits past the last row stay clear.
+                if ((a_count & 63) != 0) {
+                    std::uint64_t bits = 0;
+                    for (std::uint32_t row = full_words * 64; row < a_count; ++row) {
+                        bits |= std::uint64_t(CompareValues<TOperator>(a_values[row], a_compare, a_max)) << (row & 63);
+                    }
+                    a_mask[full_words] = bits;
+                }
+            }
+
+            /** Resolves the operator once per column, instead of once per row. */
+            template<typename TLanes>
+            void CompareColumn(const typename TLanes::Value* a_values, std::uint32_t a_count, CompareOperator a_operator, typename TLanes::Value a_compare, typename TLanes::Value a_max, std::uint64_t* a_mask) {
+                switch (a_operator) {
+                case CompareOperator::EQUAL:            { CompareColumn<CompareOperator::EQUAL, TLanes>(a_values, a_count, a_compare, a_max, a_mask);           break; }
+                case CompareOperator::NOT_EQUAL:        { CompareColumn<CompareOperator::NOT_EQUAL, TLanes>(a_values, a_count, a_compare, a_max, a_mask);       break; }
+                case CompareOperator::LESS:             { CompareColumn<CompareOperator::LESS, TLanes>(a_values, a_count, a_compare, a_max, a_mask);            break; }
+                case CompareOperator::LESS_EQUAL:       { CompareColumn<CompareOperator::LESS_EQUAL, TLanes>(a_values, a_count, a_compare, a_max, a_mask);      break; }
+                case CompareOperator::GREATER:          { CompareColumn<CompareOperator::GREATER, TLanes>(a_values, a_count, a_compare, a_max, a_mask);         break; }
+                case CompareOperator::GREATER_EQUAL:    { CompareColumn<CompareOperator::GREATER_EQUAL, TLanes>(a_values, a_count, a_compare, a_max, a_mask);   break; }
+                case CompareOperator::IN_RANGE:         { CompareColumn<CompareOperator::IN_RANGE, TLanes>(a_values, a_count, a_compare, a_max, a_mask);        break; }
+                }
+            }
+
+        }
+
+        void BTBatchKernels::CompareInt(const int* a_values, std::uint32_t a_count, CompareOperator a_operator, int a_compare, int a_max, std::uint64_t* a_mask) {
+            CompareColumn<IntLanes>(a_values, a_count, a_operator, a_compare, a_max, a_mask);
+        }
+
+        void BTBatchKernels::CompareFloat(const float* a_values, std::uint32_t a_count, CompareOperator a_operator, float a_compare, float a_max, std::uint64_t* a_mask) {
+            CompareColumn<FloatLanes>(a_values, a_count, a_operator, a_compare, a_max, a_mask);
+        }
+
+        void BTBatchKernels::CompareByte(const std::uint8_t* a_values, std::uint32_t a_count, CompareOperator a_operator, std::uint8_t a_compare, std::uint8_t a_max, std::uint64_t* a_mask) {
+            CompareColumn<ByteLanes>(a_values, a_count, a_operator, a_compare, a_max, a_mask);
+        }
+
+        void BTBatchKernels::NotZeroByte(const std::uint8_t* a_values, std::uint32_t a_count, std::uint64_t* a_mask) {
+            CompareColumn<CompareOperator::NOT_EQUAL, ByteLanes>(a_values, a_count, 0, 0, a_mask);
+        }
+
+    } // End of namespace ~ bt
+
+} // End of namespace ~ iga
@@ -0,0 +1,87 @@
+#pragma once
+
+#include <AI/BT/black_board_values.h>
+
+#include <cstddef>
+#include <cstdint>
+
+/**
+* @file bt_batch_kernels.h
+* @brief iga::bt::BTBatchKernels Header File.
+*
+* @author Channing Eggers
+* @date 19 October 2026
+* @version $Revision 1.1
+*
+* The batch kernels compare a column of an iga::bt::BlackBoardStore with a constant, for every row at once,
+* and write the rows that pass as a mask; bit i % 64 of word i / 64 is set if row i passes, like
+* iga::bt::BTBatchMask. Bits past the last row are cleared. Used by the conditions of the blackboard when
+* they get executed by iga::bt::BTBatchInterpreter.
+*
+* The kernels use AVX2 when the build targets it, SSE2 otherwise where available, and plain loops on other
+* platforms. The instruction set is chosen when compiling, there is no check at runtime.
+*
+*/
+
+/**
+*  igart namespace
+*/
+namespace iga {
+
+    /**
+    *  BT namespace
+    */
+    namespace bt {
+
+        /**
+        *   iga::bt::BTBatchKernels; Compares blackboard columns with constants, for many agents at once.
+        */
+        class BTBatchKernels final {
+        public:
+
+            /**
+            *   Sets the bits of the ints that pass a compare.
+            *   @param const int* a_values The column.
+            *   @param std::uint32_t a_count Amount of rows.
+            *   @param CompareOperator a_operator The operator.
+            *   @param int a_compare The compared value, the min value of IN_RANGE.
+            *   @param int a_max The max value of IN_RANGE.
+            *   @param std::uint64_t* a_mask The mask, (a_count + 63) / 64 words.
+            */
+            static void CompareInt(const int* a_values, std::uint32_t a_count, CompareOperator a_operator, int a_compare, int a_max, std::uint64_t* a_mask);
+
+            /**
+            *   Sets the bits of the floats that pass a compare. NaN only passes NOT_EQUAL.
+            *   @param const float* a_values The column.
+            *   @param std::uint32_t a_count Amount of rows.
+            *   @param CompareOperator a_operator The operator.
+            *   @param float a_compare The compared value, the min value of IN_RANGE.
+            *   @param float a_max The max value of IN_RANGE.
+            *   @param std::uint64_t* a_mask The mask, (a_count + 63) / 64 words.
+            */
+            static void CompareFloat(const float* a_values, std::uint32_t a_count, CompareOperator a_operator, float a_compare, float a_max, std::uint64_t* a_mask);
+
+            /**
+            *   Sets the bits of the bytes that pass a compare. Used for bool columns, bytes have to be below 128.
+            *   @param const std::uint8_t* a_values The column.
+            *   @param std::uint32_t a_count Amount of rows.
+            *   @param CompareOperator a_operator The operator.
+            *   @param std::uint8_t a_compare The compared value, the min value of IN_RANGE.
+            *   @param std::uint8_t a_max The max value of IN_RANGE.
+            *   @param std::uint64_t* a_mask The mask, (a_count + 63) / 64 words.
+            */
+            static void CompareByte(const std::uint8_t* a_values, std::uint32_t a_count, CompareOperator a_operator, std::uint8_t a_compare, std::uint8_t a_max, std::uint64_t* a_mask);
+
+            /**
+            *   Sets the bits of the bytes that aren't 0. Used for the valid bytes of a column.
+            *   @param const std::uint8_t* a_values The bytes.
+            *   @param std::uint32_t a_count Amount of rows.
+            *   @param std::uint64_t* a_mask The mask, (a_count + 63) / 64 words.
+            */
+            static void NotZeroByte(const std::uint8_t* a_values, std::uint32_t a_count, std::uint64_t* a_mask);
+
+        };
+
+    } // End of namespace ~ bt
+
+} // End of namespace ~ iga
@@ -1,16 +1,17 @@
 #include <AI/BT/bt_builder.h>
 
 #include <AI/bt_include.h>
+#include <AI/BT/bt_runtime_stats.h>
 
-#include <Editor/BTEditor/bt_editor_finder.h>
+#include <AI/BT/bt_runtime_asset.h>
+#include <AI/BT/bt_asset_library.h>
 
-#include <Editor/BTEditor/bt_editor_node_library.h>
+#include <AI/BT/bt_node_library.h>
 
-#include <cereal/cereal.hpp>
-#include <cereal/archives/json.hpp>
-#include <cereal/archives/binary.hpp>
-
-#include <fstream>
+#include <algorithm>
+#include <cstddef>
+#include <iostream>
+#include <chrono>
 
 namespace iga {
 
@@ -25,20 +26,19 @@ namespace iga {
             // DO NOTHING
         }
 
-        bool BTBuilder::BuildTree(std::string a_bt_file, BehaviourTree*& a_bt, std::weak_ptr<Entity> a_entity, bool a_overwrite_tree) {
+        bool BTBuilder::BuildTree(std::string a_bt_file, BehaviourTree*& a_bt, std::weak_ptr<Agent> a_entity, bool a_overwrite_tree) {
 
-            // Add asset folder prefix
-            a_bt_file = (FILEPATHPREFIX + a_bt_file);
+            // Load the runtime asset, or get it from the cache.
+            std::shared_ptr<const BTRuntimeAsset> asset = BTAssetLibrary::Get().Load(a_bt_file);
+            if (asset == nullptr) { return false; }
 
-//TODO : ADD OTHER SUPPORT
-#ifdef SN_TARGET_PSP2
-            std::string win_dir("\\");
-            std::size_t found = a_bt_file.find_first_of(win_dir);
-            while (found != std::string::npos) {
-                a_bt_file[found] = '/';
-                found = a_bt_file.find_first_of(win_dir, found + 1);
-            }
-#endif
+            return BuildTree(asset, a_bt_file, a_bt, a_entity, a_overwrite_tree);
+        }
+
+        bool BTBuilder::BuildTree(const std::shared_ptr<const BTRuntimeAsset>& a_asset, const std::string& a_asset_path, BehaviourTree*& a_bt, std::weak_ptr<Agent> a_entity, bool a_overwrite_tree) {
+            if (a_asset == nullptr || !a_asset->IsLoaded()) { return false; }
+
+            std::chrono::steady_clock::time_point build_start = std::chrono::steady_clock::now();
 
             // Check if we have an empty behaviour tree
             if (a_overwrite_tree) {
@@ -47,123 +47,299 @@ namespace iga {
             } else {
                 if ( a_bt != nullptr) { 
                     DEBUGASSERT(false); // Overwritting existing behaviour tree. 
+                    return false;
                 } else {
                     a_bt = new BehaviourTree(a_entity);
                 }
             }
+            a_bt->SetFilePath(a_asset_path);
+            a_bt->SetRuntimeAsset(a_asset);
+
+            if (!InstantiateTree(*a_asset, a_bt)) {
+                delete a_bt;
+                a_bt = nullptr;
+                return false;
+            }
+
+            std::chrono::microseconds build_time = std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() - build_start);
+            BTRuntimeStats::Get().OnTreeBuilt(static_cast<std::uint64_t>(build_time.count()));
+
+            // If creation of the behaviour tree was succesful. Return True.
+            return true;
+        }
+
+        bool BTBuilder::BuildTrees(const std::string& a_bt_file, const std::vector<std::weak_ptr<Agent>>& a_entities, std::vector<BehaviourTree*>& a_bts) {
+
+            // Load the runtime asset, or get it from the cache.
+            std::shared_ptr<const BTRuntimeAsset> asset = BTAssetLibrary::Get().Load(a_bt_file);
+            if (asset == nullptr) { return false; }
+
+            return BuildTrees(asset, a_bt_file, a_entities, a_bts);
+        }
+
+        bool BTBuilder::BuildTrees(const std::shared_ptr<const BTRuntimeAsset>& a_asset, const std::string& a_asset_path, const std::vector<std::weak_ptr<Agent>>& a_entities, std::vector<BehaviourTree*>& a_bts) {
+            if (a_asset == nullptr || !a_asset->IsLoaded()) { return false; }
+            if (a_entities.empty()) { return true; }
+
+            std::chrono::steady_clock::time_point build_start = std::chrono::steady_clock::now();
 
-            // Helper
-            iga::bte::BTEditorFinder editor_finder;
+            // Build the prototype, it resolves the node types, parameters and subtrees once for all trees.
+            BehaviourTree prototype(a_entities.front());
+            prototype.SetFilePath(a_asset_path);
+            if (!InstantiateTree(*a_asset, &prototype)) { return false; }
 
-            // Load in the file.
-            std::ifstream is(a_bt_file, std::ios::binary);
-            cereal::BinaryInputArchive iarchive(is);
+            std::vector<BaseNode*> prototype_nodes;
+            prototype.GetTrackedNodes(&prototype_nodes);
 
-            iga::bte::EditorSaveStruct loaded_save_struct;
-            iarchive(loaded_save_struct); // Read the data from the archive
+            // Lay out the nodes of one tree, every tree takes the same amount of memory.
+            std::vector<const NodeFactory*> factories(prototype_nodes.size(), nullptr);
+            std::vector<std::size_t> offsets(prototype_nodes.size(), 0);
+            std::unordered_map<const BaseNode*, std::size_t> prototype_indices;
+            std::size_t tree_size = 0;
 
-            // Temp Vectors
-            std::vector<iga::bte::Link*> link_pointer_vector;
-            for (auto& link : loaded_save_struct.behaviour_tree_links) {
-                link_pointer_vector.emplace_back(&link);
+            for (std::size_t i = 0; i < prototype_nodes.size(); ++i) {
+                factories[i] = StaticNodeLibrary::Find(prototype_nodes[i]->GetNodeName().c_str());
+                if (factories[i] == nullptr) {
+                    std::cout << "ERROR - Behaviour Tree System - Node not found in StaticNodeLibrary: " << prototype_nodes[i]->GetNodeName() << std::endl;
+                    return false;
+                }
+                DEBUGASSERT(factories[i]->alignment <= alignof(std::max_align_t)); // Over-aligned nodes need an aligned node block.
+
+                tree_size = (tree_size + factories[i]->alignment - 1) / factories[i]->alignment * factories[i]->alignment;
+                offsets[i] = tree_size;
+                tree_size += factories[i]->size;
+
+                prototype_indices.emplace(prototype_nodes[i], i);
             }
-            std::vector<iga::bte::EditorNode*> node_pointer_vector;
-            for (auto& node : loaded_save_struct.behaviour_tree_editor_nodes) {
-                node_pointer_vector.emplace_back(&node);
+            tree_size = (tree_size + alignof(std::max_align_t) - 1) / alignof(std::max_align_t) * alignof(std::max_align_t);
+
+            // One allocation for the nodes of all trees.
+            std::shared_ptr<void> node_block(::operator new(tree_size * a_entities.size()), [](void* a_block) { ::operator delete(a_block); });
+            char* block = static_cast<char*>(node_block.get());
+
+            std::vector<BaseNode*> nodes(prototype_nodes.size(), nullptr);
+            NodeRemap remap(prototype_indices, nodes.data());
+
+            a_bts.reserve(a_bts.size() + a_entities.size());
+            for (std::size_t t = 0; t < a_entities.size(); ++t) {
+                BehaviourTree* bt = new BehaviourTree(a_entities[t]);
+                bt->SetFilePath(a_asset_path);
+                bt->SetRuntimeAsset(a_asset);
+                bt->SetNodeBlock(node_block);
+
+                // Copy the prototype, then relocate the node pointers in one pass.
+                char* tree_block = block + (tree_size * t);
+                for (std::size_t i = 0; i < prototype_nodes.size(); ++i) {
+                    BaseNode* node = factories[i]->copy(tree_block + offsets[i], *prototype_nodes[i]);
+                    node->in_node_block_ = true;
+                    node->behaviour_tree_ = bt;
+                    bt->TrackNode(node);
+                    nodes[i] = node;
+                }
+
+                for (auto& node : nodes) {
+                    node->RemapNodes(remap);
+                    node->OnBehaviourTreeBuild();
+                }
+
+                bt->SetRoot(remap(prototype.GetRoot()));
+                a_bts.push_back(bt);
             }
 
-            // Create all the nodes
-            if (StaticNodeLibrary::node_library_map_->empty()) { return false; }
-                
-            std::map<std::string, nodedetail::objectConstructLambda>::const_iterator library_it;
+            // The build time of the prototype is spread over the trees.
+            std::chrono::microseconds build_time = std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() - build_start);
+            for (std::size_t t = 0; t < a_entities.size(); ++t) {
+                BTRuntimeStats::Get().OnTreeBuilt(static_cast<std::uint64_t>(build_time.count()) / a_entities.size());
+            }
 
-            for (auto& archived_node : node_pointer_vector) {
-                // Try to find item with this id.
-                library_it = StaticNodeLibrary::node_library_map_->find(archived_node->GetName());
+            return true;
+        }
 
-                if (library_it != StaticNodeLibrary::node_library_map_->end()) {
-                    BaseNode* new_base_node = archived_node->saving_base_node->Clone();
-                    DEBUGASSERT(new_base_node); // Invalid Clone ~  Most likely no implemented Clone function in derived class.
+        bool BTBuilder::RebuildTree(const std::shared_ptr<const BTRuntimeAsset>& a_asset, BehaviourTree* a_bt) {
+            if (a_asset == nullptr || !a_asset->IsLoaded() || a_bt == nullptr) { return false; }
 
-                    new_base_node->SetNodeName(archived_node->GetName());
-                    new_base_node->behaviour_tree_ = a_bt;
-                    new_base_node->OnBehaviourTreeBuild();
-                    a_bt->TrackNode(new_base_node);
+            // Take the old nodes out of the tree. The old asset stays loaded until they are deleted.
+            std::shared_ptr<const BTRuntimeAsset> previous_asset = a_bt->GetRuntimeAsset();
+            BaseNode* previous_root = a_bt->GetRoot();
+            std::vector<BaseNode*> previous_nodes;
+            a_bt->ReleaseNodes(previous_nodes);
 
-                    // Give temporary pointer to this base node, so we can construct the behaviour tree.
-                    archived_node->base_node = new_base_node;
+            std::unordered_map<int, BaseNode*> previous_node_map;
+            for (auto& node : previous_nodes) {
+                if (node->GetEditorNodeID() >= 0) {
+                    previous_node_map.emplace(node->GetEditorNodeID(), node);
+                }
+            }
 
-                } else {
-                    delete a_bt;
-                    DEBUGASSERT(false); // ERROR - Node not found in StaticNodeLibrary.
+            a_bt->SetRuntimeAsset(a_asset);
+
+            bool rebuilt = InstantiateTree(*a_asset, a_bt, &previous_node_map);
+
+            // Delete the nodes that lost; the new ones on success, the old ones on failure.
+            std::vector<BaseNode*> dead_nodes;
+            if (rebuilt) {
+                dead_nodes.swap(previous_nodes);
+            } else {
+                a_bt->ReleaseNodes(dead_nodes);
+                for (auto& node : previous_nodes) {
+                    a_bt->TrackNode(node);
                 }
+                a_bt->SetRoot(previous_root);
+                a_bt->SetRuntimeAsset(previous_asset);
             }
 
-            // Now Link all the nodes together.
-            for (auto& editor_node : node_pointer_vector) {
+            for (auto& node : dead_nodes) {
+                BaseNode::DestroyNode(node);
+            }
+
+            return rebuilt;
+        }
+
+        bool BTBuilder::InstantiateTree(const BTRuntimeAsset& a_asset, BehaviourTree* a_bt, const std::unordered_map<int, BaseNode*>* a_previous_nodes) {
+            if (StaticNodeLibrary::GetFactories().empty()) { return false; }
+
+            this->subtree_stack_.clear();
+            this->subtree_stack_.push_back(NormalizePath(a_bt->GetFilePath()));
+
+            BaseNode* root = InstantiateNodes(a_asset, a_bt, a_previous_nodes, false);
+            this->subtree_stack_.clear();
+
+            if (root == nullptr) { return false; }
+
+            a_bt->SetRoot(root);
+
+            return true;
+        }
+
+        BaseNode* BTBuilder::InstantiateNodes(const BTRuntimeAsset& a_asset, BehaviourTree* a_bt, const std::unordered_map<int, BaseNode*>* a_previous_nodes, bool a_subtree) {
+            std::uint32_t node_count = a_asset.GetNodeCount();
+            std::vector<BaseNode*> nodes(node_count, nullptr);
+
+            // Create all the nodes
+            for (std::uint32_t i = 0; i < node_count; ++i) {
+                const BTRuntimeNodeRecord& record = a_asset.GetNode(i);
 
-                // Cast for Leaf Nodes.
-                if (LeafNode* leaf_node = dynamic_cast<LeafNode*>(editor_node->base_node)) {
-                    continue;
+                const NodeFactory* factory = StaticNodeLibrary::Find(record.type_id);
+                if (factory == nullptr) {
+                    std::cout << "ERROR - Behaviour Tree System - Node not found in StaticNodeLibrary: " << a_asset.GetString(record.type_name) << std::endl;
+                    DEBUGASSERT(false); // ERROR - Node not found in StaticNodeLibrary.
+                    return nullptr;
                 }
+                const char* type_name = factory->type_name;
 
-                // Cast for Composite Nodes.
-                if (CompositeNode* comp_node = dynamic_cast<CompositeNode*>(editor_node->base_node)) {
+                BaseNode* new_base_node = StaticNodeLibrary::CreateNode(*factory);
+                new_base_node->node_index_ = static_cast<std::uint32_t>(a_bt->GetNodeCount());
+                a_bt->TrackNode(new_base_node);
 
-                    for (auto& linkid : editor_node->outgoing_link_IDs) {
-                        iga::bte::Link* l = editor_finder.FindLink(linkid, &link_pointer_vector);
-                        iga::bte::EditorNode* e = editor_finder.FindEditorNodeWithInputPin(l->end_pin_id, &node_pointer_vector);
+                BTRuntimeReader reader(a_asset, i);
+                new_base_node->ReadRuntimeData(reader);
+                if (!reader.IsValid()) {
+                    std::cout << "ERROR - Behaviour Tree System - Invalid parameters for node: " << type_name << std::endl;
+                    return nullptr;
+                }
 
-                        for (auto& node : node_pointer_vector) {
-                            if (node == e) {
-                                comp_node->AddChild(node->base_node);
-                            }
-                        }
+                new_base_node->SetNodeName(type_name);
+                // Editor node IDs of subtrees belong to another BT File, they would clash with the IDs of the tree.
+                new_base_node->editor_node_id_ = a_subtree ? -1 : record.editor_node_id;
+                new_base_node->behaviour_tree_ = a_bt;
+                new_base_node->OnBehaviourTreeBuild();
+
+                // Keep the runtime state of nodes whose identity didn't change.
+                if (a_previous_nodes != nullptr) {
+                    std::unordered_map<int, BaseNode*>::const_iterator previous_it = a_previous_nodes->find(record.editor_node_id);
+                    if (previous_it != a_previous_nodes->end() && previous_it->second->GetNodeName() == new_base_node->GetNodeName()) {
+                        new_base_node->TransferRuntimeState(*previous_it->second);
                     }
+                }
+
+                nodes[i] = new_base_node;
 
-                    continue;
+                RunSubtree* run_subtree = dynamic_cast<RunSubtree*>(new_base_node);
+                if (run_subtree != nullptr && !InstantiateSubtree(run_subtree, a_bt)) {
+                    return nullptr;
                 }
+            }
 
-                // Cast for Root Node.
-                if (Root* root_node = dynamic_cast<Root*>(editor_node->base_node)) {
-                    // Root found now set it.
-                    a_bt->SetRoot(editor_node->base_node);
+            // Now link all the nodes together. Child indices are stored in call order.
+            for (std::uint32_t i = 0; i < node_count; ++i) {
+                const BTRuntimeNodeRecord& record = a_asset.GetNode(i);
+
+                // Cooked assets are validated, but runtime assets can come from anywhere.
+                NodeType node_type = nodes[i]->GetNodeType();
+                if ((node_type == NodeType::LEAF && record.child_count != 0) ||
+                    (node_type == NodeType::DECORATOR && record.child_count != 1) ||
+                    (node_type == NodeType::COMPOSITE && record.child_count == 0)) {
+                    std::cout << "ERROR - Behaviour Tree System - Wrong amount of children for node: " << nodes[i]->GetNodeName() << " (" << record.editor_node_id << ")" << std::endl;
+                    return nullptr;
+                }
 
-                    // Find the child of the root node and set it.
-                    std::vector<iga::bte::Link*> links;
-                    editor_finder.FindLinksWithOutputPinID(editor_node->outputs[0].id, &link_pointer_vector, &links);
+                switch (node_type) {
 
-                    iga::bte::EditorNode* e = editor_finder.FindEditorNodeWithInputPin(links[0]->end_pin_id, &node_pointer_vector);
+                case (NodeType::LEAF):
+                    break;
 
-                    for (auto& node : node_pointer_vector) {
-                        if (node == e) {
-                            root_node->SetChild(node->base_node);
-                        }
+                case (NodeType::COMPOSITE): {
+                    CompositeNode* comp_node = static_cast<CompositeNode*>(nodes[i]);
+                    for (std::uint32_t c = 0; c < record.child_count; ++c) {
+                        comp_node->AddChild(nodes[a_asset.GetChild(record, c)]);
                     }
+                    break;
+                }
 
-                    continue;
+                case (NodeType::DECORATOR): {
+                    DecoratorNode* deco_node = static_cast<DecoratorNode*>(nodes[i]);
+                    deco_node->SetChild(nodes[a_asset.GetChild(record, 0)]);
+                    break;
                 }
 
-                // Cast for Decorator Nodes.
-                if (DecoratorNode* deco_node = dynamic_cast<DecoratorNode*>(editor_node->base_node)) {
-                    // Find the child of the root node and set it as the root of the behaviour tree.
-                    std::vector<iga::bte::Link*> links;
-                    editor_finder.FindLinksWithOutputPinID(editor_node->outputs[0].id, &link_pointer_vector, &links);
+                }
+            }
 
-                    iga::bte::EditorNode* e = editor_finder.FindEditorNodeWithInputPin(links[0]->end_pin_id, &node_pointer_vector);
+            // Nodes are stored in pre-order, so the root is always the first node.
+            return nodes[0];
+        }
 
-                    for (auto& node : node_pointer_vector) {
-                        if (node == e) {
-                            deco_node->SetChild(node->base_node);
-                        }
-                    }
+        bool BTBuilder::InstantiateSubtree(RunSubtree* a_run_subtree, BehaviourTree* a_bt) {
+            const std::string& subtree_path = a_run_subtree->GetSubtreePath();
+            if (subtree_path.empty()) {
+                std::cout << "ERROR - Behaviour Tree System - RunSubtree node without a subtree in: " << this->subtree_stack_.back() << std::endl;
+                return false;
+            }
+
+            std::string normalized_path = NormalizePath(subtree_path);
+            if (std::find(this->subtree_stack_.begin(), this->subtree_stack_.end(), normalized_path) != this->subtree_stack_.end()) {
+                std::cout << "ERROR - Behaviour Tree System - Subtree cycle: ";
+                for (auto& path : this->subtree_stack_) {
+                    std::cout << path << " -> ";
                 }
+                std::cout << normalized_path << std::endl;
+                return false;
             }
 
-            // If creation of the behaviour tree was succesful. Return True.
+            // Every tree that includes the subtree shares its loaded asset.
+            std::shared_ptr<const BTRuntimeAsset> subtree_asset = BTAssetLibrary::Get().Load(subtree_path);
+            if (subtree_asset == nullptr) {
+                std::cout << "ERROR - Behaviour Tree System - Failed to load subtree: " << subtree_path << std::endl;
+                return false;
+            }
+
+            this->subtree_stack_.push_back(normalized_path);
+            BaseNode* subtree_root = InstantiateNodes(*subtree_asset, a_bt, nullptr, true);
+            this->subtree_stack_.pop_back();
+
+            if (subtree_root == nullptr) { return false; }
+
+            a_run_subtree->SetSubtree(subtree_root, subtree_asset);
+
             return true;
         }
 
+        std::string BTBuilder::NormalizePath(const std::string& a_path) {
+            std::string path = a_path;
+            std::replace(path.begin(), path.end(), '\\', '/');
+            return path;
+        }
+
     } // End of namespace ~ bt
 
 } // End of namespace ~ iga
\ No newline at end of file
@@ -1,10 +1,9 @@
 #pragma once
 
-#include <Core/entity.h>
-
-#include <Editor/BTEditor/bt_editor_structs.h>
+#include <AI/BT/bt_agent.h>
 
 #include <map>
+#include <unordered_map>
 #include <vector>
 #include <string>
 #include <memory>
@@ -16,6 +15,12 @@
 * @brief iga::bt::BTBuilder
 *
 * iga::bt::BTBuilder loads in a BT File and converts it into an in-game behaviour tree.
+* Runtime assets (.btr) get loaded directly, BT Files (.bt) get cooked into a runtime asset first.
+* Loaded assets are cached by iga::bt::BTAssetLibrary and shared between behaviour trees.
+*
+* iga::bt::RunSubtree nodes get resolved while building; the referenced BT File gets loaded
+* through the asset library and its nodes get built into the same behaviour tree. Subtree
+* references that form a cycle fail the build.
 *
 */
 
@@ -39,6 +44,8 @@ namespace iga {
 
         class BehaviourTree;
         class BaseNode;
+        class BTRuntimeAsset;
+        class RunSubtree;
 
         /**
         *
@@ -60,10 +67,91 @@ namespace iga {
             *   Function builds a behaviour tree from a BT File.
             *   @param std::string a_bt_file File Path of the BT File.
             *   @param iga::bt::BehaviourTree a_bt Pointer to a behaviour tree.
-            *   @param std::weak_tr<Entity> a_entity A weak point to the owner of this behaviour tree.
+            *   @param std::weak_ptr<Agent> a_entity A weak point to the owner of this behaviour tree.
+            *   @aram bool a_overwrite_tree Overwrites the behaviour tree if it wasn't nullptr.
+            */
+            bool BuildTree(std::string a_bt_file, BehaviourTree*& a_bt, std::weak_ptr<Agent> a_entity, bool a_overwrite_tree);
+
+            /**
+            *   Function builds a behaviour tree from a loaded runtime asset. Doesn't do any file I/O.
+            *   @param std::shared_ptr<const BTRuntimeAsset> a_asset The loaded runtime asset.
+            *   @param std::string a_asset_path File path of the BT File that the asset was loaded from.
+            *   @param iga::bt::BehaviourTree a_bt Pointer to a behaviour tree.
+            *   @param std::weak_ptr<Agent> a_entity A weak point to the owner of this behaviour tree.
             *   @aram bool a_overwrite_tree Overwrites the behaviour tree if it wasn't nullptr.
             */
-            bool BuildTree(std::string a_bt_file, BehaviourTree*& a_bt, std::weak_ptr<Entity> a_entity, bool a_overwrite_tree);
+            bool BuildTree(const std::shared_ptr<const BTRuntimeAsset>& a_asset, const std::string& a_asset_path, BehaviourTree*& a_bt, std::weak_ptr<Agent> a_entity, bool a_overwrite_tree);
+
+            /**
+            *   Function builds one behaviour tree per entity from a BT File, for spawning many entities at once.
+            *   @see BuildTrees(const std::shared_ptr<const BTRuntimeAsset>&, const std::string&, const std::vector<std::weak_ptr<Agent>>&, std::vector<BehaviourTree*>&)
+            *   @param std::string a_bt_file File Path of the BT File.
+            *   @param std::vector<std::weak_ptr<Agent>> a_entities The owners of the behaviour trees.
+            *   @param std::vector<BehaviourTree*> a_bts The container that the behaviour trees get added to, in the order of the entities.
+            *   @return bool - If True ~ A behaviour tree has been built for every entity.
+            */
+            bool BuildTrees(const std::string& a_bt_file, const std::vector<std::weak_ptr<Agent>>& a_entities, std::vector<BehaviourTree*>& a_bts);
+
+            /**
+            *   Function builds one behaviour tree per entity from a loaded runtime asset. The nodes get built once
+            *   as a prototype, after which every tree gets a copy of the prototype. The copies of all trees are
+            *   built into one node block, which gets freed once all of the trees have been destroyed.
+            *   @param std::shared_ptr<const BTRuntimeAsset> a_asset The loaded runtime asset.
+            *   @param std::string a_asset_path File path of the BT File that the asset was loaded from.
+            *   @param std::vector<std::weak_ptr<Agent>> a_entities The owners of the behaviour trees.
+            *   @param std::vector<BehaviourTree*> a_bts The container that the behaviour trees get added to, in the order of the entities.
+            *   @return bool - If True ~ A behaviour tree has been built for every entity.
+            */
+            bool BuildTrees(const std::shared_ptr<const BTRuntimeAsset>& a_asset, const std::string& a_asset_path, const std::vector<std::weak_ptr<Agent>>& a_entities, std::vector<BehaviourTree*>& a_bts);
+
+            /**
+            *   Function swaps the nodes of a live behaviour tree for the nodes of a new asset. The blackboard,
+            *   target and debugger of the tree are kept. New nodes that were built from the same editor node
+            *   and have the same type as an old node take over its runtime state; all other nodes start fresh.
+            *   If the new asset can't be built, the tree keeps its old nodes.
+            *   @param std::shared_ptr<const BTRuntimeAsset> a_asset The new runtime asset.
+            *   @param iga::bt::BehaviourTree a_bt Pointer to the live behaviour tree.
+            *   @return bool - If True ~ The tree now runs the new asset.
+            */
+            bool RebuildTree(const std::shared_ptr<const BTRuntimeAsset>& a_asset, BehaviourTree* a_bt);
+
+        private:
+
+            /**
+            *   Function creates the nodes of a runtime asset and links them together.
+            *   @param iga::bt::BTRuntimeAsset a_asset The loaded runtime asset.
+            *   @param iga::bt::BehaviourTree a_bt Pointer to the behaviour tree that gets the nodes.
+            *   @param std::unordered_map<int, BaseNode*> a_previous_nodes Nodes that get replaced, by editor node ID. Their runtime state gets transferred.
+            *   @return bool - If True ~ All nodes have been created and linked.
+            */
+            bool InstantiateTree(const BTRuntimeAsset& a_asset, BehaviourTree* a_bt, const std::unordered_map<int, BaseNode*>* a_previous_nodes = nullptr);
+
+            /**
+            *   Function creates the nodes of a runtime asset, links them together and resolves their subtrees.
+            *   @param iga::bt::BTRuntimeAsset a_asset The loaded runtime asset.
+            *   @param iga::bt::BehaviourTree a_bt Pointer to the behaviour tree that gets the nodes.
+            *   @param std::unordered_map<int, BaseNode*> a_previous_nodes Nodes that get replaced, by editor node ID. nullptr for subtrees.
+            *   @param bool a_subtree True if the asset is a subtree of the behaviour tree.
+            *   @return BaseNode* Pointer to the root of the created nodes, nullptr if creating failed.
+            */
+            BaseNode* InstantiateNodes(const BTRuntimeAsset& a_asset, BehaviourTree* a_bt, const std::unordered_map<int, BaseNode*>* a_previous_nodes, bool a_subtree);
+
+            /**
+            *   Function loads the BT File that a RunSubtree node references and builds its nodes into the behaviour tree.
+            *   @param iga::bt::RunSubtree a_run_subtree Pointer to the RunSubtree node.
+            *   @param iga::bt::BehaviourTree a_bt Pointer to the behaviour tree that gets the nodes.
+            *   @return bool - If True ~ The subtree has been resolved.
+            */
+            bool InstantiateSubtree(RunSubtree* a_run_subtree, BehaviourTree* a_bt);
+
+            /**
+            *   Returns a path with forward slashes, so subtree references can be compared.
+            *   @param std::string a_path The path.
+            *   @return std::string value.
+            */
+            static std::string NormalizePath(const std::string& a_path);
+
+            std::vector<std::string> subtree_stack_; /**< Paths of the BT Files that are being built, outer most first. Used to detect subtree cycles. */
 
         };
 
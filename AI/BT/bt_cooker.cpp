@@ -0,0 +1,484 @@
+#include <AI/BT/bt_cooker.h>
+
+#include <AI/BT/black_board.h>
+
+#include <AI/BT/Nodes/base_node.h>
+#include <AI/BT/Nodes/node_enums.h>
+#include <AI/BT/Nodes/composite_node.h>
+#include <AI/BT/Nodes/Decorator/inverter.h>
+#include <AI/BT/Nodes/Decorator/successor.h>
+#include <AI/BT/Nodes/Leaf/constant_result.h>
+
+#include <Editor/BTEditor/bt_editor_finder.h>
+#include <AI/BT/bt_node_library.h>
+#include <Editor/BTEditor/bt_editor_structs.h>
+
+#include <cereal/cereal.hpp>
+#include <cereal/archives/binary.hpp>
+
+#include <cstdio>
+#include <cstring>
+#include <fstream>
+#include <iostream>
+
+#if defined(_WIN32)
+#ifndef NOMINMAX
+#define NOMINMAX
+#endif
+#include <windows.h>
+#endif
+
+namespace iga {
+
+    namespace bt {
+
+        BTCooker::BTCooker() { /*EMPTY*/ }
+
+        BTCooker::~BTCooker() { /*EMPTY*/ }
+
+        bool BTCooker::Cook(iga::bte::EditorSaveStruct& a_save_struct, std::vector<char>& a_output) {
+
+            // Reset the cooker.
+            this->string_table_ = BTRuntimeStringTable();
+            this->node_records_.clear();
+            this->child_indices_.clear();
+            this->param_blob_.clear();
+            this->tree_.clear();
+            this->gathered_nodes_.clear();
+            this->visiting_nodes_.clear();
+            this->created_nodes_.clear();
+            this->tree_name_ = a_save_struct.behaviour_tree_name;
+            this->failed_ = false;
+
+            // Index the nodes and links, so children can be found by pin.
+            iga::bte::BTEditorFinder finder;
+            this->finder_ = &finder;
+
+            for (auto& link : a_save_struct.behaviour_tree_links) {
+                finder.IndexLink(&link);
+            }
+
+            // Find the root; the only decorator without an input pin.
+            iga::bte::EditorNode* root = nullptr;
+            for (auto& node : a_save_struct.behaviour_tree_editor_nodes) {
+                finder.IndexNode(&node);
+
+                if (node.saving_base_node == nullptr) {
+                    std::cout << "ERROR - Behaviour Tree System - Cooking " << this->tree_name_ << " - Node without data: " << node.GetName() << std::endl;
+                    this->finder_ = nullptr;
+                    return false;
+                }
+
+                if (node.saving_base_node->GetNodeType() == NodeType::DECORATOR && node.inputs.empty()) {
+                    if (root != nullptr) {
+                        std::cout << "ERROR - Behaviour Tree System - Cooking " << this->tree_name_ << " - More than one root." << std::endl;
+                        this->finder_ = nullptr;
+                        return false;
+                    }
+                    root = &node;
+                }
+            }
+
+            if (root == nullptr) {
+                std::cout << "ERROR - Behaviour Tree System - Cooking " << this->tree_name_ << " - No root." << std::endl;
+                this->finder_ = nullptr;
+                return false;
+            }
+
+            // Gather and validate all nodes that can be reached from the root.
+            std::size_t root_index = GatherNode(root);
+            this->finder_ = nullptr;
+
+            if (!this->failed_) { ValidateReachability(a_save_struct); }
+            if (!this->failed_) { ValidateBlackBoardKeys(); }
+
+            if (this->failed_) {
+                std::cout << "ERROR - Behaviour Tree System - Cooking " << this->tree_name_ << " - Failed." << std::endl;
+                return false;
+            }
+
+            // Optimize until nothing changes anymore.
+            if (this->optimize_) {
+                do {
+                    this->optimized_ = false;
+                    root_index = OptimizeNode(root_index);
+                } while (this->optimized_);
+            }
+
+            // Write all nodes in pre-order.
+            CookNode(root_index);
+
+            // Layout the runtime asset.
+            const std::vector<char>& strings = this->string_table_.GetData();
+
+            BTRuntimeHeader header;
+            header.magic                = BTRuntimeAsset::magic_;
+            header.version              = BTRuntimeAsset::GetLatestVersion();
+            header.node_count           = static_cast<std::uint32_t>(this->node_records_.size());
+            header.node_table_offset    = static_cast<std::uint32_t>(sizeof(BTRuntimeHeader));
+            header.child_table_offset   = header.node_table_offset + header.node_count * static_cast<std::uint32_t>(sizeof(BTRuntimeNodeRecord));
+            header.child_count          = static_cast<std::uint32_t>(this->child_indices_.size());
+            header.param_blob_offset    = header.child_table_offset + header.child_count * static_cast<std::uint32_t>(sizeof(std::uint32_t));
+            header.param_blob_size      = static_cast<std::uint32_t>(this->param_blob_.size());
+            header.string_table_offset  = header.param_blob_offset + header.param_blob_size;
+            header.string_table_size    = static_cast<std::uint32_t>(strings.size());
+            header.file_size            = header.string_table_offset + header.string_table_size;
+
+            a_output.assign(header.file_size, '\0');
+            char* data = a_output.data();
+
+            std::memcpy(data, &header, sizeof(header));
+            std::memcpy(data + header.node_table_offset, this->node_records_.data(), this->node_records_.size() * sizeof(BTRuntimeNodeRecord));
+            if (!this->child_indices_.empty()) {
+                std::memcpy(data + header.child_table_offset, this->child_indices_.data(), this->child_indices_.size() * sizeof(std::uint32_t));
+            }
+            if (!this->param_blob_.empty()) {
+                std::memcpy(data + header.param_blob_offset, this->param_blob_.data(), this->param_blob_.size());
+            }
+            std::memcpy(data + header.string_table_offset, strings.data(), strings.size());
+
+            return true;
+        }
+
+        bool BTCooker::CookFile(const std::string& a_bt_file, std::vector<char>& a_output) {
+            iga::bte::EditorSaveStruct save_struct;
+            if (!LoadBTFile(a_bt_file, save_struct)) { return false; }
+
+            return Cook(save_struct, a_output);
+        }
+
+        bool BTCooker::CookFile(const std::string& a_bt_file, const std::string& a_btr_file) {
+            std::vector<char> data;
+            if (!CookFile(a_bt_file, data)) { return false; }
+
+            return WriteFile(data, a_btr_file);
+        }
+
+        bool BTCooker::WriteFile(const std::vector<char>& a_data, const std::string& a_btr_file) {
+            // The asset may be mapped by running trees, so it doesn't get rewritten in place. The new asset
+            // gets written next to it and renamed over it; the mappings keep the pages of the old file.
+            std::string temp_file = a_btr_file + ".tmp";
+            {
+                std::ofstream os(temp_file, std::ios::binary | std::ios::trunc);
+                if (!os.is_open()) {
+                    std::cout << "ERROR - Behaviour Tree System - Failed to write runtime asset: " << a_btr_file << std::endl;
+                    return false;
+                }
+
+                os.write(a_data.data(), static_cast<std::streamsize>(a_data.size()));
+                os.close();
+                if (!os.good()) {
+                    std::cout << "ERROR - Behaviour Tree System - Failed to write runtime asset: " << a_btr_file << std::endl;
+                    std::remove(temp_file.c_str());
+                    return false;
+                }
+            }
+
+#if defined(_WIN32)
+            // Windows doesn't replace files that are mapped, the old asset stays until its trees are gone.
+            bool replaced = MoveFileExA(temp_file.c_str(), a_btr_file.c_str(), MOVEFILE_REPLACE_EXISTING) != 0;
+#else
+            bool replaced = std::rename(temp_file.c_str(), a_btr_file.c_str()) == 0;
+#endif
+            if (!replaced) {
+                std::cout << "ERROR - Behaviour Tree System - Failed to replace runtime asset: " << a_btr_file << std::endl;
+                std::remove(temp_file.c_str());
+                return false;
+            }
+
+            return true;
+        }
+
+        bool BTCooker::LoadBTFile(const std::string& a_bt_file, iga::bte::EditorSaveStruct& a_save_struct) {
+            std::ifstream is(a_bt_file, std::ios::binary);
+            if (!is.is_open()) {
+                std::cout << "ERROR - Behaviour Tree System - Failed to open BT File: " << a_bt_file << std::endl;
+                return false;
+            }
+
+            cereal::BinaryInputArchive iarchive(is);
+            iarchive(a_save_struct);
+
+            return true;
+        }
+
+        std::size_t BTCooker::GatherNode(iga::bte::EditorNode* a_editor_node) {
+
+            if (this->visiting_nodes_.count(a_editor_node->id) != 0) {
+                std::cout << "ERROR - Behaviour Tree System - Cooking " << this->tree_name_ << " - Cycle at node: " << a_editor_node->GetName() << " (" << a_editor_node->id << ")" << std::endl;
+                this->failed_ = true;
+                return 0;
+            }
+
+            if (this->gathered_nodes_.count(a_editor_node->id) != 0) {
+                std::cout << "ERROR - Behaviour Tree System - Cooking " << this->tree_name_ << " - Node has more than one parent: " << a_editor_node->GetName() << " (" << a_editor_node->id << ")" << std::endl;
+                this->failed_ = true;
+                return 0;
+            }
+
+            std::size_t index = this->tree_.size();
+            this->gathered_nodes_.emplace(a_editor_node->id, index);
+
+            CookerNode node;
+            node.base_node      = a_editor_node->saving_base_node.get();
+            node.type_name      = a_editor_node->GetName();
+            node.editor_node_id = static_cast<std::int32_t>(a_editor_node->id);
+            this->tree_.push_back(node);
+
+            // The runtime asset refers to the node type by its type ID.
+            if (StaticNodeLibrary::Find(node.type_name.c_str()) == nullptr) {
+                std::cout << "ERROR - Behaviour Tree System - Cooking " << this->tree_name_ << " - Node not found in StaticNodeLibrary: " << node.type_name << " (" << node.editor_node_id << ")" << std::endl;
+                this->failed_ = true;
+                return index;
+            }
+
+            std::vector<iga::bte::EditorNode*> children;
+            GetChildren(a_editor_node, children);
+            if (this->failed_) { return index; }
+
+            // Decorators need a child, composites need at least one.
+            NodeType type = node.base_node->GetNodeType();
+            if ((type == NodeType::DECORATOR || type == NodeType::COMPOSITE) && children.empty()) {
+                std::cout << "ERROR - Behaviour Tree System - Cooking " << this->tree_name_ << " - Node without children: " << a_editor_node->GetName() << " (" << a_editor_node->id << ")" << std::endl;
+                this->failed_ = true;
+                return index;
+            }
+
+            this->visiting_nodes_.insert(a_editor_node->id);
+            for (auto& child : children) {
+                std::size_t child_index = GatherNode(child);
+                if (this->failed_) { break; }
+                this->tree_[index].children.push_back(child_index);
+            }
+            this->visiting_nodes_.erase(a_editor_node->id);
+
+            return index;
+        }
+
+        void BTCooker::ValidateReachability(iga::bte::EditorSaveStruct& a_save_struct) {
+            for (auto& node : a_save_struct.behaviour_tree_editor_nodes) {
+                if (this->gathered_nodes_.count(node.id) == 0) {
+                    std::cout << "ERROR - Behaviour Tree System - Cooking " << this->tree_name_ << " - Unreachable node: " << node.GetName() << " (" << node.id << ")" << std::endl;
+                    this->failed_ = true;
+                }
+            }
+        }
+
+        void BTCooker::ValidateBlackBoardKeys() {
+            static const char* type_names[] = { "Int", "Float", "Bool", "String", "Vector2", "Vector4", "Entity" };
+
+            std::vector<BlackBoardKey> keys;
+            std::vector<std::size_t> key_nodes;
+            for (std::size_t i = 0; i < this->tree_.size(); ++i) {
+                this->tree_[i].base_node->GetBlackBoardKeys(keys);
+                key_nodes.resize(keys.size(), i);
+            }
+
+            // Types that every value gets written with. The blackboard stores every type separately.
+            std::unordered_map<std::string, std::unordered_set<int>> written_types;
+            for (auto& key : keys) {
+                if (key.write) {
+                    written_types[key.name].insert(static_cast<int>(key.type));
+                }
+            }
+
+            for (std::size_t i = 0; i < keys.size(); ++i) {
+                const BlackBoardKey& key = keys[i];
+                const CookerNode& node = this->tree_[key_nodes[i]];
+
+                if (key.name.empty()) {
+                    std::cout << "ERROR - Behaviour Tree System - Cooking " << this->tree_name_ << " - Empty blackboard key at node: " << node.type_name << " (" << node.editor_node_id << ")" << std::endl;
+                    this->failed_ = true;
+                    continue;
+                }
+
+                if (key.write) { continue; }
+
+                std::unordered_map<std::string, std::unordered_set<int>>::const_iterator written = written_types.find(key.name);
+                if (written == written_types.end()) {
+                    std::cout << (this->strict_blackboard_keys_ ? "ERROR" : "WARNING") << " - Behaviour Tree System - Cooking " << this->tree_name_ << " - Blackboard key " << key.name << " is never written, read at node: " << node.type_name << " (" << node.editor_node_id << ")" << std::endl;
+                    if (this->strict_blackboard_keys_) { this->failed_ = true; }
+                    continue;
+                }
+
+                if (written->second.count(static_cast<int>(key.type)) == 0) {
+                    std::cout << "ERROR - Behaviour Tree System - Cooking " << this->tree_name_ << " - Blackboard key " << key.name << " is read as " << type_names[static_cast<int>(key.type)] << " but never written as " << type_names[static_cast<int>(key.type)] << ", at node: " << node.type_name << " (" << node.editor_node_id << ")" << std::endl;
+                    this->failed_ = true;
+                }
+            }
+        }
+
+        std::size_t BTCooker::OptimizeNode(std::size_t a_index) {
+
+            // Optimize the children first. The tree can grow, so don't hold references into it.
+            for (std::size_t i = 0; i < this->tree_[a_index].children.size(); ++i) {
+                std::size_t child = OptimizeNode(this->tree_[a_index].children[i]);
+                this->tree_[a_index].children[i] = child;
+            }
+
+            BaseNode* base_node = this->tree_[a_index].base_node;
+            NodeResult result;
+
+            switch (base_node->GetNodeType()) {
+
+            case (NodeType::LEAF):
+                break;
+
+            case (NodeType::DECORATOR): {
+                std::size_t child = this->tree_[a_index].children[0];
+
+                if (dynamic_cast<const Inverter*>(base_node) != nullptr) {
+                    // Inverter(Inverter(x)) ~ x
+                    if (dynamic_cast<const Inverter*>(this->tree_[child].base_node) != nullptr) {
+                        this->optimized_ = true;
+                        return this->tree_[child].children[0];
+                    }
+
+                    // Inverter(ConstantResult) ~ ConstantResult
+                    if (GetConstantResult(child, result)) {
+                        if (result == NodeResult::SUCCESS)      { result = NodeResult::FAILED; }
+                        else if (result == NodeResult::FAILED)  { result = NodeResult::SUCCESS; }
+                        this->optimized_ = true;
+                        return AddConstantResult(a_index, result);
+                    }
+                }
+
+                // Successor(pure x) ~ ConstantResult(SUCCESS)
+                if (dynamic_cast<const Successor*>(base_node) != nullptr && IsPureTree(child)) {
+                    this->optimized_ = true;
+                    return AddConstantResult(a_index, NodeResult::SUCCESS);
+                }
+                break;
+            }
+
+            case (NodeType::COMPOSITE): {
+                NodeResult continue_result;
+                if (!static_cast<const CompositeNode*>(base_node)->GetContinueResult(continue_result)) { break; }
+
+                std::vector<std::size_t>& children = this->tree_[a_index].children;
+                std::vector<std::size_t> kept_children;
+                for (std::size_t i = 0; i < children.size(); ++i) {
+                    if (GetConstantResult(children[i], result)) {
+                        // A constant child that continues does nothing.
+                        if (result == continue_result) { continue; }
+
+                        // A constant child that stops, makes the children after it unreachable.
+                        kept_children.push_back(children[i]);
+                        break;
+                    }
+                    kept_children.push_back(children[i]);
+                }
+
+                if (kept_children.size() != children.size()) {
+                    this->optimized_ = true;
+                    children = kept_children;
+                }
+
+                // Without children the composite returns the continue result.
+                if (children.empty()) {
+                    this->optimized_ = true;
+                    return AddConstantResult(a_index, continue_result);
+                }
+
+                // With a single child the composite returns the result of the child.
+                if (children.size() == 1) {
+                    this->optimized_ = true;
+                    return children[0];
+                }
+                break;
+            }
+
+            }
+
+            return a_index;
+        }
+
+        bool BTCooker::IsPureTree(std::size_t a_index) const {
+            const CookerNode& node = this->tree_[a_index];
+            if (!node.base_node->IsPure()) { return false; }
+
+            for (auto& child : node.children) {
+                if (!IsPureTree(child)) { return false; }
+            }
+
+            return true;
+        }
+
+        bool BTCooker::GetConstantResult(std::size_t a_index, NodeResult& a_result) const {
+            const ConstantResult* constant_result = dynamic_cast<const ConstantResult*>(this->tree_[a_index].base_node);
+            if (constant_result == nullptr) { return false; }
+
+            a_result = constant_result->GetResult();
+            return true;
+        }
+
+        std::size_t BTCooker::AddConstantResult(std::size_t a_replaced_index, NodeResult a_result) {
+            ConstantResult* constant_result = new ConstantResult();
+            constant_result->SetResult(a_result);
+            this->created_nodes_.emplace_back(constant_result);
+
+            CookerNode node;
+            node.base_node      = constant_result;
+            node.type_name      = GET_VARIABLE_NAME(ConstantResult);
+            node.editor_node_id = this->tree_[a_replaced_index].editor_node_id;
+            this->tree_.push_back(node);
+
+            return this->tree_.size() - 1;
+        }
+
+        std::uint32_t BTCooker::CookNode(std::size_t a_index) {
+            const CookerNode& node = this->tree_[a_index];
+            std::uint32_t index = static_cast<std::uint32_t>(this->node_records_.size());
+
+            BTRuntimeNodeRecord record;
+            record.type_id          = nodedetail::HashTypeName(node.type_name.c_str());
+            record.type_name        = this->string_table_.Intern(node.type_name);
+            record.editor_node_id   = node.editor_node_id;
+
+            // Parameters
+            record.param_offset = static_cast<std::uint32_t>(this->param_blob_.size());
+            BTRuntimeWriter writer(&this->param_blob_, &this->string_table_);
+            node.base_node->WriteRuntimeData(writer);
+            record.param_size = static_cast<std::uint32_t>(this->param_blob_.size()) - record.param_offset;
+
+            // Reserve the child indices, so the children of a node are next to each other.
+            std::vector<std::size_t> children = node.children;
+            record.first_child  = static_cast<std::uint32_t>(this->child_indices_.size());
+            record.child_count  = static_cast<std::uint32_t>(children.size());
+            this->child_indices_.resize(this->child_indices_.size() + children.size());
+
+            this->node_records_.push_back(record);
+
+            for (std::size_t i = 0; i < children.size(); ++i) {
+                std::uint32_t child_index = CookNode(children[i]);
+                this->child_indices_[record.first_child + i] = child_index;
+            }
+
+            return index;
+        }
+
+        void BTCooker::GetChildren(iga::bte::EditorNode* a_editor_node, std::vector<iga::bte::EditorNode*>& a_children) {
+            NodeType type = a_editor_node->saving_base_node->GetNodeType();
+            if (type == NodeType::LEAF) { return; }
+
+            // Outgoing links are stored in call order.
+            for (auto& link_id : a_editor_node->outgoing_link_IDs) {
+                iga::bte::Link* link = this->finder_->FindLink(link_id);
+                iga::bte::EditorNode* child = (link != nullptr) ? this->finder_->FindNodeWithPinID(link->end_pin_id) : nullptr;
+
+                if (child == nullptr) {
+                    std::cout << "ERROR - Behaviour Tree System - Broken link " << link_id << " at node: " << a_editor_node->GetName() << " (" << a_editor_node->id << ")" << std::endl;
+                    this->failed_ = true;
+                    return;
+                }
+
+                a_children.push_back(child);
+
+                // A decorator only has a single child.
+                if (type == NodeType::DECORATOR) { return; }
+            }
+        }
+
+    } // End of namespace ~ bt
+
+} // End of namespace ~ iga
@@ -0,0 +1,209 @@
+#pragma once
+
+#include <AI/BT/bt_runtime_asset.h>
+
+#include <cstddef>
+#include <memory>
+#include <string>
+#include <vector>
+#include <unordered_map>
+#include <unordered_set>
+
+/**
+* @file bt_cooker.h
+* @brief iga::bt::BTCooker Header File.
+*
+* @author Channing Eggers
+* @date 19 October 2026
+* @version $Revision 1.1
+*
+* iga::bt::BTCooker converts the editor save format of a BT File (.bt) into a runtime asset (.btr).
+* Everything that only the editor needs; colours, sizes, states, pins and links, gets stripped.
+*
+* Cooking validates the tree first and rejects it with an error for; missing children, cycles,
+* nodes with more than one parent, unreachable nodes and blackboard values that are read with a type
+* that they are never written with. Blackboard values that are read but never written by the tree are
+* reported as a warning, since game code may write them, or as an error with strict_blackboard_keys_.
+*
+* Then the tree gets optimized, until nothing changes anymore:
+*   Inverter(Inverter(x)) becomes x.
+*   Inverter(ConstantResult) becomes the inverted ConstantResult.
+*   Successor(x) becomes ConstantResult(SUCCESS) if the subtree x is pure, see BaseNode::IsPure.
+*   Sequential composites, see CompositeNode::GetContinueResult, lose the constant children that continue,
+*   lose the children after a constant child that stops them, and get replaced by their child if only one is left.
+*
+*/
+
+/**
+*  igart namespace
+*/
+namespace iga {
+
+    namespace bte {
+        struct EditorSaveStruct;
+        struct EditorNode;
+        class BTEditorFinder;
+    } // End of namspace ~ bte
+
+    /**
+    *  BT namespace
+    */
+    namespace bt {
+
+        class BaseNode;
+        enum class NodeResult;
+
+        /**
+        *   iga::bt::BTCooker; Cooks BT Files into runtime assets.
+        */
+        class BTCooker final {
+        public:
+
+            /** BTCooker Constructor */
+            BTCooker();
+
+            /** BTCooker Destructor */
+            ~BTCooker();
+
+            /**
+            *   Cooks the editor save data of a BT File into a runtime asset.
+            *   @param iga::bte::EditorSaveStruct a_save_struct The loaded BT File. The base nodes of the editor nodes need to be loaded.
+            *   @param std::vector<char> a_output The container that the runtime asset gets written to.
+            *   @return bool - If True ~ The BT File has been cooked.
+            */
+            bool Cook(iga::bte::EditorSaveStruct& a_save_struct, std::vector<char>& a_output);
+
+            /**
+            *   Loads a BT File and cooks it into a runtime asset.
+            *   @param std::string a_bt_file The file path of the BT File.
+            *   @param std::vector<char> a_output The container that the runtime asset gets written to.
+            *   @return bool - If True ~ The BT File has been cooked.
+            */
+            bool CookFile(const std::string& a_bt_file, std::vector<char>& a_output);
+
+            /**
+            *   Loads a BT File, cooks it and writes the runtime asset to a file.
+            *   @param std::string a_bt_file The file path of the BT File.
+            *   @param std::string a_btr_file The file path of the runtime asset.
+            *   @return bool - If True ~ The runtime asset has been written.
+            */
+            bool CookFile(const std::string& a_bt_file, const std::string& a_btr_file);
+
+            /**
+            *   Writes a cooked runtime asset to a file. The asset gets written to a temporary file that replaces
+            *   the old asset at once, so trees that have the old asset mapped keep using it. On Windows a
+            *   mapped asset can't be replaced; WriteFile fails until the trees of the old asset are destroyed.
+            *   @param std::vector<char> a_data The runtime asset.
+            *   @param std::string a_btr_file The file path of the runtime asset.
+            *   @return bool - If True ~ The runtime asset has been written.
+            */
+            static bool WriteFile(const std::vector<char>& a_data, const std::string& a_btr_file);
+
+            /**
+            *   Loads the editor save data of a BT File.
+            *   @param std::string a_bt_file The file path of the BT File.
+            *   @param iga::bte::EditorSaveStruct a_save_struct The container that the BT File gets loaded into.
+            *   @return bool - If True ~ The BT File has been loaded.
+            */
+            static bool LoadBTFile(const std::string& a_bt_file, iga::bte::EditorSaveStruct& a_save_struct);
+
+            static constexpr const char* bt_file_extension_  = ".bt";     /**< Extension of BT Files. */
+            static constexpr const char* btr_file_extension_ = ".btr";    /**< Extension of runtime assets. */
+
+            bool optimize_ = true;                      /**< Whether the optimization passes run. */
+            bool strict_blackboard_keys_ = false;       /**< Whether reading blackboard values that the tree never writes is an error. */
+
+        private:
+
+            /**
+            *   iga::bt::BTCooker::CookerNode; A node of the tree that is getting cooked.
+            */
+            struct CookerNode {
+                BaseNode* base_node = nullptr;          /**< Node with the type and parameters. */
+                std::string type_name;                  /**< Type name of the node, as subscribed in the StaticNodeLibrary. */
+                std::int32_t editor_node_id = -1;       /**< ID of the editor node that the node was cooked from. */
+                std::vector<std::size_t> children;      /**< Indices of the children, in call order. */
+            };
+
+            /**
+            *   Adds an editor node and its children to the tree, validating its structure.
+            *   @param iga::bte::EditorNode a_editor_node The editor node.
+            *   @return std::size_t Index of the node in the tree.
+            */
+            std::size_t GatherNode(iga::bte::EditorNode* a_editor_node);
+
+            /**
+            *   Validates that every editor node is part of the tree.
+            *   @param iga::bte::EditorSaveStruct a_save_struct The BT File that is getting cooked.
+            */
+            void ValidateReachability(iga::bte::EditorSaveStruct& a_save_struct);
+
+            /**
+            *   Validates the blackboard values that the nodes of the tree read and write.
+            */
+            void ValidateBlackBoardKeys();
+
+            /**
+            *   Optimizes a node after optimizing its children.
+            *   @param std::size_t a_index Index of the node.
+            *   @return std::size_t Index of the node that replaces it. The same index if it doesn't get replaced.
+            */
+            std::size_t OptimizeNode(std::size_t a_index);
+
+            /**
+            *   Returns True if a node and all of its children are pure.
+            *   @param std::size_t a_index Index of the node.
+            *   @return bool value.
+            */
+            bool IsPureTree(std::size_t a_index) const;
+
+            /**
+            *   Returns the result of a node if it is a ConstantResult.
+            *   @param std::size_t a_index Index of the node.
+            *   @param NodeResult a_result The container that the result gets stored in.
+            *   @return bool - If True ~ The node is a ConstantResult.
+            */
+            bool GetConstantResult(std::size_t a_index, NodeResult& a_result) const;
+
+            /**
+            *   Adds a ConstantResult node that replaces a node.
+            *   @param std::size_t a_replaced_index Index of the replaced node. The new node takes over its editor node ID.
+            *   @param NodeResult a_result The result of the new node.
+            *   @return std::size_t Index of the new node.
+            */
+            std::size_t AddConstantResult(std::size_t a_replaced_index, NodeResult a_result);
+
+            /**
+            *   Writes a node and its children in pre-order.
+            *   @param std::size_t a_index Index of the node in the tree.
+            *   @return std::uint32_t Index of the node record.
+            */
+            std::uint32_t CookNode(std::size_t a_index);
+
+            /**
+            *   Returns the children of an editor node in call order.
+            *   @param iga::bte::EditorNode a_editor_node The parent editor node.
+            *   @param std::vector<iga::bte::EditorNode*> a_children The container that the children get stored in.
+            */
+            void GetChildren(iga::bte::EditorNode* a_editor_node, std::vector<iga::bte::EditorNode*>& a_children);
+
+            iga::bte::BTEditorFinder* finder_ = nullptr;            /**< Finder that has indexed the BT File that is getting cooked. */
+            std::string tree_name_;                                 /**< Name of the BT File that is getting cooked. */
+
+            std::vector<CookerNode> tree_;                          /**< Nodes of the tree that is getting cooked. */
+            std::unordered_map<int, std::size_t> gathered_nodes_;   /**< Tree indices of the gathered editor nodes, by editor node ID. */
+            std::unordered_set<int> visiting_nodes_;                /**< Editor node IDs on the current gather path. */
+            std::vector<std::unique_ptr<BaseNode>> created_nodes_;  /**< Nodes that were created by the optimization passes. */
+            bool optimized_ = false;                                /**< True if the last optimization pass changed the tree. */
+
+            BTRuntimeStringTable string_table_;                     /**< Strings of the runtime asset. */
+            std::vector<BTRuntimeNodeRecord> node_records_;         /**< Node records of the runtime asset. */
+            std::vector<std::uint32_t> child_indices_;              /**< Child indices of the runtime asset. */
+            std::vector<char> param_blob_;                          /**< Parameter blob of the runtime asset. */
+            bool failed_ = false;                                   /**< True if cooking failed. */
+
+        };
+
+    } // End of namespace ~ bt
+
+} // End of namespace ~ iga
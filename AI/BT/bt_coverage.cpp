@@ -0,0 +1,174 @@
+#include <AI/BT/bt_coverage.h>
+
+#include <AI/BT/Nodes/node_enums.h>
+
+#include <cereal/archives/json.hpp>
+
+#include <fstream>
+#include <iostream>
+
+namespace iga {
+
+    namespace bt {
+
+        void CoverageCounters::Record(NodeResult a_result) {
+            ++this->entered;
+
+            switch (a_result) {
+            case (NodeResult::SUCCESS)      :   ++this->succeeded;  break;
+            case (NodeResult::FAILED)       :   ++this->failed;     break;
+            case (NodeResult::RUNNING)      :   ++this->running;    break;
+            case (NodeResult::FATAL_ERROR)  :   ++this->errors;     break;
+            }
+        }
+
+        void CoverageCounters::Merge(const CoverageCounters& a_other) {
+            this->entered   += a_other.entered;
+            this->succeeded += a_other.succeeded;
+            this->failed    += a_other.failed;
+            this->running   += a_other.running;
+            this->errors    += a_other.errors;
+        }
+
+        void NodeCoverage::Merge(const NodeCoverage& a_other) {
+            this->counters.Merge(a_other.counters);
+
+            if (this->branches.size() < a_other.branches.size()) {
+                this->branches.resize(a_other.branches.size());
+            }
+
+            for (std::size_t i = 0; i < a_other.branches.size(); ++i) {
+                this->branches[i].Merge(a_other.branches[i]);
+            }
+        }
+
+        void BTCoverageReport::RecordNode(int a_editor_node_id, NodeResult a_result) {
+            this->nodes[a_editor_node_id].counters.Record(a_result);
+        }
+
+        void BTCoverageReport::RecordBranch(int a_editor_node_id, std::size_t a_branch_index, std::size_t a_branch_count, NodeResult a_result) {
+            std::vector<CoverageCounters>& branches = this->nodes[a_editor_node_id].branches;
+
+            // Size the branches to the amount of children, so branches that never got entered are part of the report.
+            if (branches.size() < a_branch_count) {
+                branches.resize(a_branch_count);
+            }
+
+            branches[a_branch_index].Record(a_result);
+        }
+
+        void BTCoverageReport::Merge(const BTCoverageReport& a_other) {
+            for (auto& node : a_other.nodes) {
+                this->nodes[node.first].Merge(node.second);
+            }
+        }
+
+        bool BTCoverageReport::IsEmpty() const {
+            return this->nodes.empty();
+        }
+
+        BTCoverage::BTCoverage() { /*EMPTY*/ }
+
+        BTCoverage& BTCoverage::Get() {
+            static BTCoverage coverage;
+            return coverage;
+        }
+
+        void BTCoverage::MergeReport(const BTCoverageReport& a_report) {
+            if (a_report.asset_path.empty() || a_report.IsEmpty()) { return; }
+
+            std::lock_guard<std::mutex> lock(this->mutex_);
+
+            BTCoverageReport& merged_report = this->reports_[a_report.asset_path];
+            merged_report.asset_path = a_report.asset_path;
+            merged_report.Merge(a_report);
+        }
+
+        bool BTCoverage::GetReport(const std::string& a_asset_path, BTCoverageReport& a_report) const {
+            std::lock_guard<std::mutex> lock(this->mutex_);
+
+            std::map<std::string, BTCoverageReport>::const_iterator it;
+            it = this->reports_.find(a_asset_path);
+
+            if (it != this->reports_.end()) {
+                a_report = it->second;
+                return true;
+            } else {
+                return false;
+            }
+        }
+
+        bool BTCoverage::ExportReport(const std::string& a_asset_path, const std::string& a_file_path) const {
+            BTCoverageReport report;
+            if (!GetReport(a_asset_path, report)) { return false; }
+
+            return WriteReport(report, a_file_path);
+        }
+
+        bool BTCoverage::ExportReports(const std::string& a_directory) const {
+            // Copy the reports, so the mutex isn't held while writing files.
+            std::map<std::string, BTCoverageReport> reports;
+            {
+                std::lock_guard<std::mutex> lock(this->mutex_);
+                reports = this->reports_;
+            }
+
+            bool exported_all = true;
+            for (auto& report : reports) {
+                // Name the report after the stem of its asset.
+                std::string stem = report.first;
+                std::size_t slash = stem.find_last_of("/\\");
+                if (slash != std::string::npos) { stem = stem.substr(slash + 1); }
+                std::size_t dot = stem.find_last_of('.');
+                if (dot != std::string::npos) { stem = stem.substr(0, dot); }
+
+                std::string file_path = a_directory;
+                file_path.append("/");
+                file_path.append(stem);
+                file_path.append(coverage_file_extension_);
+
+                if (!WriteReport(report.second, file_path)) {
+                    exported_all = false;
+                }
+            }
+
+            return exported_all;
+        }
+
+        bool BTCoverage::ImportReport(const std::string& a_file_path, BTCoverageReport& a_report) {
+            std::ifstream is(a_file_path);
+            if (!is.is_open()) {
+                std::cout << "ERROR - Behaviour Tree System - Failed to open coverage report: " << a_file_path << std::endl;
+                return false;
+            }
+
+            cereal::JSONInputArchive archive(is);
+            archive(cereal::make_nvp("BTCoverage", a_report));
+
+            return true;
+        }
+
+        void BTCoverage::ClearReports() {
+            std::lock_guard<std::mutex> lock(this->mutex_);
+            this->reports_.clear();
+        }
+
+        bool BTCoverage::WriteReport(const BTCoverageReport& a_report, const std::string& a_file_path) {
+            std::ofstream os(a_file_path);
+            if (!os.is_open()) {
+                std::cout << "ERROR - Behaviour Tree System - Failed to write coverage report: " << a_file_path << std::endl;
+                return false;
+            }
+
+            // Scope the archive, so it flushes before the stream closes.
+            {
+                cereal::JSONOutputArchive archive(os);
+                archive(cereal::make_nvp("BTCoverage", a_report));
+            }
+
+            return true;
+        }
+
+    } // End of namespace ~ bt
+
+} // End of namespace ~ iga
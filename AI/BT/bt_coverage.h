@@ -0,0 +1,278 @@
+#pragma once
+
+#include <AI/BT/bt_platform.h>
+
+#include <cereal/cereal.hpp>
+#include <cereal/types/map.hpp>
+#include <cereal/types/string.hpp>
+#include <cereal/types/vector.hpp>
+
+#include <map>
+#include <mutex>
+#include <string>
+#include <vector>
+
+/**
+* @file bt_coverage.h
+* @brief iga::bt::BTCoverage Header File.
+*
+* @author Channing Eggers
+* @date 19 October 2026
+* @version $Revision 1.1
+*
+* BTCoverage gathers execution coverage of behaviour trees. Every behaviour tree records
+* which of its nodes, and which child branches of its composite nodes, were entered,
+* succeeded or failed. The records get merged per .bt asset and can be exported, so that
+* the behaviour tree editor can render them as a heat map.
+* Coverage recording can be enabled by define #BT_COVERAGE in bt_defines.h
+*
+*/
+
+/**
+*  igart namespace
+*/
+namespace iga {
+
+    /**
+    *  BT namespace
+    */
+    namespace bt {
+
+        enum class NodeResult;
+
+        /**
+        *   iga::bt::CoverageCounters; Counts how often a node or branch was entered and what it returned.
+        */
+        struct CoverageCounters {
+
+            /**
+            *   Cereal versions of iga::bt::CoverageCounters.
+            */
+            enum class Version {
+                DEFAULT = 0,    /**< Default normal version. */
+                LATEST          /**< Latest version. */
+            };
+
+            /**
+            *   Counts an entry with the result that got returned.
+            *   @param NodeResult a_result The result of the node or branch.
+            */
+            void Record(NodeResult a_result);
+
+            /**
+            *   Adds the counters of another CoverageCounters to these counters.
+            *   @param CoverageCounters a_other The counters that get added.
+            */
+            void Merge(const CoverageCounters& a_other);
+
+            /**
+            *   Cereal Serialization funtion for CoverageCounters struct.
+            */
+            template <class Archive>
+            void serialize(Archive& a_archive, uint32 const a_version);
+
+            uint32 entered      = 0;    /**< Amount of times it was entered. */
+            uint32 succeeded    = 0;    /**< Amount of times it returned SUCCESS. */
+            uint32 failed       = 0;    /**< Amount of times it returned FAILED. */
+            uint32 running      = 0;    /**< Amount of times it returned RUNNING. */
+            uint32 errors       = 0;    /**< Amount of times it returned FATAL_ERROR. */
+        };
+
+        /**
+        *   iga::bt::NodeCoverage; Coverage of a single node and, for composite nodes, its child branches.
+        */
+        struct NodeCoverage {
+
+            /**
+            *   Cereal versions of iga::bt::NodeCoverage.
+            */
+            enum class Version {
+                DEFAULT = 0,    /**< Default normal version. */
+                LATEST          /**< Latest version. */
+            };
+
+            /**
+            *   Adds the coverage of another NodeCoverage to this coverage.
+            *   @param NodeCoverage a_other The coverage that gets added.
+            */
+            void Merge(const NodeCoverage& a_other);
+
+            /**
+            *   Cereal Serialization funtion for NodeCoverage struct.
+            */
+            template <class Archive>
+            void serialize(Archive& a_archive, uint32 const a_version);
+
+            CoverageCounters                counters;   /**< Counters of the node itself. */
+            std::vector<CoverageCounters>   branches;   /**< Counters per child branch, in call order. Only used by composite nodes. */
+        };
+
+        /**
+        *   iga::bt::BTCoverageReport; Coverage of one .bt asset, keyed by the editor node IDs of the asset.
+        */
+        struct BTCoverageReport {
+
+            /**
+            *   Cereal versions of iga::bt::BTCoverageReport.
+            */
+            enum class Version {
+                DEFAULT = 0,    /**< Default normal version. */
+                LATEST          /**< Latest version. */
+            };
+
+            /**
+            *   Records the result of a node.
+            *   @param int a_editor_node_id The editor node ID of the node.
+            *   @param NodeResult a_result The result that the node returned.
+            */
+            void RecordNode(int a_editor_node_id, NodeResult a_result);
+
+            /**
+            *   Records the result of a child branch of a composite node.
+            *   @param int a_editor_node_id The editor node ID of the composite node.
+            *   @param std::size_t a_branch_index The call order of the child branch.
+            *   @param std::size_t a_branch_count The amount of child branches of the composite node.
+            *   @param NodeResult a_result The result that the child branch returned.
+            */
+            void RecordBranch(int a_editor_node_id, std::size_t a_branch_index, std::size_t a_branch_count, NodeResult a_result);
+
+            /**
+            *   Adds the coverage of another report to this report.
+            *   @param BTCoverageReport a_other The report that gets added.
+            */
+            void Merge(const BTCoverageReport& a_other);
+
+            /**
+            *   Returns True if nothing has been recorded in this report.
+            *   @return bool value.
+            */
+            bool IsEmpty() const;
+
+            /**
+            *   Cereal Serialization funtion for BTCoverageReport struct.
+            */
+            template <class Archive>
+            void serialize(Archive& a_archive, uint32 const a_version);
+
+            std::string                 asset_path;     /**< The file path of the .bt asset. */
+            std::map<int, NodeCoverage> nodes;          /**< Coverage of the nodes, keyed by editor node ID. */
+        };
+
+        /**
+        *   iga::bt::BTCoverage; Stores the merged coverage reports of all .bt assets.
+        */
+        class BTCoverage final {
+        public:
+
+            /**
+            *   Returns the coverage storage.
+            *   @return BTCoverage reference.
+            */
+            static BTCoverage& Get();
+
+            /**
+            *   Merges a report of a behaviour tree into the report of its asset.
+            *   @param BTCoverageReport a_report The report that gets merged.
+            */
+            void MergeReport(const BTCoverageReport& a_report);
+
+            /**
+            *   Copies the merged report of an asset.
+            *   @param std::string a_asset_path The file path of the .bt asset.
+            *   @param BTCoverageReport a_report The container that the report gets copied into.
+            *   @return bool - If True ~ A report of this asset has been found.
+            */
+            bool GetReport(const std::string& a_asset_path, BTCoverageReport& a_report) const;
+
+            /**
+            *   Exports the merged report of an asset to a file.
+            *   @param std::string a_asset_path The file path of the .bt asset.
+            *   @param std::string a_file_path The file path of the exported report.
+            *   @return bool - If True ~ The report has been exported.
+            */
+            bool ExportReport(const std::string& a_asset_path, const std::string& a_file_path) const;
+
+            /**
+            *   Exports all merged reports to a directory. Each report is named after its asset.
+            *   @param std::string a_directory The directory that the reports get exported to.
+            *   @return bool - If True ~ All reports have been exported.
+            */
+            bool ExportReports(const std::string& a_directory) const;
+
+            /**
+            *   Imports a report from a file.
+            *   @param std::string a_file_path The file path of the report.
+            *   @param BTCoverageReport a_report The container that the report gets loaded into.
+            *   @return bool - If True ~ The report has been imported.
+            */
+            static bool ImportReport(const std::string& a_file_path, BTCoverageReport& a_report);
+
+            /** Clears all merged reports. */
+            void ClearReports();
+
+            std::string coverage_file_extension_ = ".btcov"; /**< Extension of exported coverage reports. */
+
+        private:
+
+            /** BTCoverage Constructor */
+            BTCoverage();
+
+            /**
+            *   Writes a report to a file.
+            *   @param BTCoverageReport a_report The report that gets written.
+            *   @param std::string a_file_path The file path of the report.
+            *   @return bool - If True ~ The report has been written.
+            */
+            static bool WriteReport(const BTCoverageReport& a_report, const std::string& a_file_path);
+
+            mutable std::mutex mutex_;                          /**< Mutex guarding the reports. Behaviour trees merge when they get destroyed. */
+            std::map<std::string, BTCoverageReport> reports_;   /**< Merged reports keyed by asset file path. */
+
+        };
+
+    } // End of namespace ~ bt
+
+    template <class Archive>
+    inline void bt::CoverageCounters::serialize(Archive& a_archive, uint32 const a_version) {
+        switch (static_cast<Version>(a_version)) {
+        case Version::LATEST:
+        case Version::DEFAULT:
+            a_archive(  cereal::make_nvp("Entered", entered),
+                        cereal::make_nvp("Succeeded", succeeded),
+                        cereal::make_nvp("Failed", failed),
+                        cereal::make_nvp("Running", running),
+                        cereal::make_nvp("Errors", errors)
+            );
+            break;
+        }
+    }
+
+    template <class Archive>
+    inline void bt::NodeCoverage::serialize(Archive& a_archive, uint32 const a_version) {
+        switch (static_cast<Version>(a_version)) {
+        case Version::LATEST:
+        case Version::DEFAULT:
+            a_archive(  cereal::make_nvp("Node", counters),
+                        cereal::make_nvp("Branches", branches)
+            );
+            break;
+        }
+    }
+
+    template <class Archive>
+    inline void bt::BTCoverageReport::serialize(Archive& a_archive, uint32 const a_version) {
+        switch (static_cast<Version>(a_version)) {
+        case Version::LATEST:
+        case Version::DEFAULT:
+            a_archive(  cereal::make_nvp("AssetPath", asset_path),
+                        cereal::make_nvp("Nodes", nodes)
+            );
+            break;
+        }
+    }
+
+} // End of namespace ~ iga
+
+CEREAL_CLASS_VERSION(iga::bt::CoverageCounters, (static_cast<iga::uint32>(iga::bt::CoverageCounters::Version::LATEST) - 1));
+CEREAL_CLASS_VERSION(iga::bt::NodeCoverage, (static_cast<iga::uint32>(iga::bt::NodeCoverage::Version::LATEST) - 1));
+CEREAL_CLASS_VERSION(iga::bt::BTCoverageReport, (static_cast<iga::uint32>(iga::bt::BTCoverageReport::Version::LATEST) - 1));
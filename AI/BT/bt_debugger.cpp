@@ -1,7 +1,7 @@
-#include <AI\BT\bt_debugger.h>
+#include <AI/BT/bt_debugger.h>
 
-#include <AI\BT\Nodes/base_node.h>
-#include <AI\BT\Nodes/node_enums.h>
+#include <AI/BT/Nodes/base_node.h>
+#include <AI/BT/Nodes/node_enums.h>
 
 #include <iostream>
 
@@ -2,4 +2,12 @@
 
 /*
 #define BT_DEBUG
+//*/
+
+/*
+#define BT_COVERAGE
+//*/
+
+/*
+#define BT_HOT_RELOAD
 //*/
\ No newline at end of file
@@ -0,0 +1,68 @@
+#pragma once
+
+#include <AI/BT/bt_agent.h>
+
+#include <Core/entity.h>
+
+#include <memory>
+
+/**
+* @file bt_entity_agent.h
+* @brief iga::bt::BTEntityAgent Header File.
+*
+* @author Channing Eggers
+* @date 19 October 2026
+* @version $Revision 1.1
+*
+* Engine builds own behaviour trees through a BTEntityAgent, which implements iga::bt::BTAgent for an
+* iga::Entity. The behaviour component keeps the agent of its entity alive as long as it has a tree.
+* Nodes that need the entity itself get it with GetEntity. Not available in headless builds.
+*
+*/
+
+/**
+*  igart namespace
+*/
+namespace iga {
+
+    /**
+    *  BT namespace
+    */
+    namespace bt {
+
+        /**
+        *   iga::bt::BTEntityAgent; The agent of an entity.
+        */
+        class BTEntityAgent final : public BTAgent {
+        public:
+
+            /**
+            *   BTEntityAgent Constructor
+            *   @param std::weak_ptr<iga::Entity> a_entity The entity.
+            */
+            explicit BTEntityAgent(std::weak_ptr<iga::Entity> a_entity) : entity_(a_entity) { /*EMPTY*/ }
+
+            /**
+            *   Returns the ID of the entity, 0 if the entity is gone.
+            *   @return unsigned int value.
+            */
+            unsigned int GetID() const override {
+                std::shared_ptr<iga::Entity> entity = this->entity_.lock();
+                return entity != nullptr ? static_cast<unsigned int>(entity->GetID()) : 0;
+            }
+
+            /**
+            *   Returns the entity.
+            *   @return std::weak_ptr<iga::Entity> value.
+            */
+            std::weak_ptr<iga::Entity> GetEntity() const { return this->entity_; }
+
+        private:
+
+            std::weak_ptr<iga::Entity> entity_;     /**< The entity. */
+
+        };
+
+    } // End of namespace ~ bt
+
+} // End of namespace ~ iga
@@ -0,0 +1,228 @@
+#include <AI/BT/bt_hot_reload.h>
+
+#include <AI/BT/behaviour_tree.h>
+#include <AI/BT/bt_asset_library.h>
+#include <AI/BT/bt_builder.h>
+#include <AI/BT/bt_cooker.h>
+#include <AI/BT/bt_runtime_asset.h>
+#include <AI/BT/Nodes/Leaf/run_subtree.h>
+
+#include <AI/BT/bt_platform.h>
+
+#include <iostream>
+#include <vector>
+
+#ifdef __linux__
+#include <dirent.h>
+#include <sys/inotify.h>
+#include <unistd.h>
+#endif // __linux__
+
+namespace iga {
+
+    namespace bt {
+
+        BTHotReload::BTHotReload() { /*EMPTY*/ }
+
+        BTHotReload::~BTHotReload() {
+            Stop();
+        }
+
+        BTHotReload& BTHotReload::Get() {
+            static BTHotReload hot_reload;
+            return hot_reload;
+        }
+
+        bool BTHotReload::Start() {
+#ifdef __linux__
+            if (IsRunning()) { return true; }
+
+            this->inotify_fd_ = inotify_init1(IN_NONBLOCK | IN_CLOEXEC);
+            if (this->inotify_fd_ < 0) {
+                std::cout << "ERROR - Behaviour Tree System - Failed to start hot reloading." << std::endl;
+                return false;
+            }
+
+            std::string asset_directory = BTAssetLibrary::GetFullPath("");
+            WatchDirectory(asset_directory.empty() ? "." : asset_directory, "");
+            return true;
+#else
+            std::cout << "ERROR - Behaviour Tree System - Hot reloading is only supported on Linux." << std::endl;
+            return false;
+#endif // __linux__
+        }
+
+        void BTHotReload::Stop() {
+#ifdef __linux__
+            if (this->inotify_fd_ >= 0) {
+                close(this->inotify_fd_);
+            }
+#endif // __linux__
+            this->inotify_fd_ = -1;
+            this->watched_directories_.clear();
+        }
+
+        bool BTHotReload::IsRunning() const {
+            return this->inotify_fd_ >= 0;
+        }
+
+        void BTHotReload::Poll() {
+#ifdef __linux__
+            if (!IsRunning()) { return; }
+
+            std::unordered_set<std::string> changed_assets;
+
+            // Editors save several times in a row; every asset only gets reloaded once per poll.
+            alignas(struct inotify_event) char buffer[4096];
+            for (;;) {
+                ssize_t length = read(this->inotify_fd_, buffer, sizeof(buffer));
+                if (length <= 0) { break; }
+
+                const char* position = buffer;
+                while (position < buffer + length) {
+                    const struct inotify_event* event = reinterpret_cast<const struct inotify_event*>(position);
+                    position += sizeof(struct inotify_event) + event->len;
+
+                    if (event->mask & IN_IGNORED) {
+                        this->watched_directories_.erase(event->wd);
+                        continue;
+                    }
+
+                    std::unordered_map<int, std::string>::const_iterator directory = this->watched_directories_.find(event->wd);
+                    if (event->len == 0 || directory == this->watched_directories_.end()) { continue; }
+
+                    std::string name = event->name;
+                    std::string asset_path = directory->second.empty() ? name : (directory->second + "/" + name);
+
+                    if (event->mask & IN_ISDIR) {
+                        WatchDirectory(BTAssetLibrary::GetFullPath(asset_path), asset_path);
+                        continue;
+                    }
+
+                    std::string extension = iga::GetFileExtension(name);
+                    if (extension == BTCooker::bt_file_extension_ || extension == BTCooker::btr_file_extension_) {
+                        changed_assets.insert(asset_path);
+                    }
+                }
+            }
+
+            for (auto& asset_path : changed_assets) {
+                Reload(asset_path);
+            }
+#endif // __linux__
+        }
+
+        int BTHotReload::Reload(const std::string& a_asset_path) {
+            std::string asset_path = NormalizePath(a_asset_path);
+
+            std::vector<BehaviourTree*> trees;
+            {
+                std::lock_guard<std::mutex> lock(this->trees_mutex_);
+                for (auto& tree : this->trees_) {
+                    if (NormalizePath(tree->GetFilePath()) == asset_path || UsesSubtree(tree, asset_path)) {
+                        trees.push_back(tree);
+                    }
+                }
+            }
+
+            // The asset library caches by the path that the assets were loaded with.
+            std::unordered_set<std::string> library_paths;
+            library_paths.insert(a_asset_path);
+            for (auto& tree : trees) {
+                if (NormalizePath(tree->GetFilePath()) == asset_path) {
+                    library_paths.insert(tree->GetFilePath());
+                }
+                GetSubtreePaths(tree, asset_path, library_paths);
+            }
+            for (auto& library_path : library_paths) {
+                BTAssetLibrary::Get().Release(library_path);
+            }
+
+            // Without live trees, the new asset gets loaded by the next build.
+            if (trees.empty()) { return 0; }
+
+            // Trees that include the asset as a subtree get rebuilt from their own asset, which resolves the new subtree.
+            BTBuilder builder;
+            int patched = 0;
+            for (auto& tree : trees) {
+                std::shared_ptr<const BTRuntimeAsset> asset = BTAssetLibrary::Get().Load(tree->GetFilePath());
+                if (builder.RebuildTree(asset, tree)) { ++patched; }
+            }
+
+            if (patched == 0) {
+                std::cout << "ERROR - Behaviour Tree System - Hot reload failed, keeping the old behaviour trees: " << a_asset_path << std::endl;
+                return -1;
+            }
+
+            std::cout << "Behaviour Tree System - Hot reloaded " << a_asset_path << " into " << patched << " behaviour trees." << std::endl;
+            return patched;
+        }
+
+        void BTHotReload::RegisterTree(BehaviourTree* a_bt) {
+            std::lock_guard<std::mutex> lock(this->trees_mutex_);
+            this->trees_.insert(a_bt);
+        }
+
+        void BTHotReload::UnregisterTree(BehaviourTree* a_bt) {
+            std::lock_guard<std::mutex> lock(this->trees_mutex_);
+            this->trees_.erase(a_bt);
+        }
+
+        void BTHotReload::WatchDirectory(const std::string& a_directory, const std::string& a_asset_directory) {
+#ifdef __linux__
+            int watch = inotify_add_watch(this->inotify_fd_, a_directory.c_str(), IN_CLOSE_WRITE | IN_MOVED_TO | IN_CREATE | IN_ONLYDIR);
+            if (watch < 0) {
+                std::cout << "ERROR - Behaviour Tree System - Failed to watch folder: " << a_directory << std::endl;
+                return;
+            }
+            this->watched_directories_[watch] = a_asset_directory;
+
+            DIR* directory = opendir(a_directory.c_str());
+            if (directory == nullptr) { return; }
+
+            std::string directory_path = a_directory;
+            if (!directory_path.empty() && directory_path.back() != '/') { directory_path.push_back('/'); }
+
+            while (struct dirent* entry = readdir(directory)) {
+                std::string name = entry->d_name;
+                if (entry->d_type != DT_DIR || name == "." || name == "..") { continue; }
+
+                WatchDirectory(directory_path + name, a_asset_directory.empty() ? name : (a_asset_directory + "/" + name));
+            }
+
+            closedir(directory);
+#else
+            UNUSED(a_directory);
+            UNUSED(a_asset_directory);
+#endif // __linux__
+        }
+
+        bool BTHotReload::UsesSubtree(BehaviourTree* a_bt, const std::string& a_asset_path) {
+            std::unordered_set<std::string> subtree_paths;
+            GetSubtreePaths(a_bt, a_asset_path, subtree_paths);
+            return !subtree_paths.empty();
+        }
+
+        void BTHotReload::GetSubtreePaths(BehaviourTree* a_bt, const std::string& a_asset_path, std::unordered_set<std::string>& a_subtree_paths) {
+            std::vector<BaseNode*> nodes;
+            a_bt->GetTrackedNodes(&nodes);
+
+            for (auto& node : nodes) {
+                const RunSubtree* run_subtree = dynamic_cast<const RunSubtree*>(node);
+                if (run_subtree != nullptr && NormalizePath(run_subtree->GetSubtreePath()) == a_asset_path) {
+                    a_subtree_paths.insert(run_subtree->GetSubtreePath());
+                }
+            }
+        }
+
+        std::string BTHotReload::NormalizePath(const std::string& a_path) {
+            std::string path = a_path;
+            for (auto& character : path) {
+                if (character == '\\') { character = '/'; }
+            }
+            return path;
+        }
+
+    } // End of namespace ~ bt
+
+} // End of namespace ~ iga
@@ -0,0 +1,141 @@
+#pragma once
+
+#include <mutex>
+#include <string>
+#include <unordered_map>
+#include <unordered_set>
+
+/**
+* @file bt_hot_reload.h
+* @brief iga::bt::BTHotReload Header File.
+*
+* @author Channing Eggers
+* @date 19 October 2026
+* @version $Revision 1.1
+*
+* BTHotReload watches the asset folder for changed BT Files (.bt) and runtime assets (.btr).
+* When a file changes, its asset gets reloaded and every live behaviour tree that was built from it
+* gets its nodes swapped, see iga::bt::BTBuilder::RebuildTree. The blackboards of the trees are kept.
+* Behaviour trees that include the changed file through a iga::bt::RunSubtree node get rebuilt as well.
+*
+* Live behaviour trees are only registered when hot reloading is enabled by #BT_HOT_RELOAD in bt_defines.h.
+* Watching the asset folder uses inotify and is only supported on Linux.
+*
+*/
+
+/**
+*  igart namespace
+*/
+namespace iga {
+
+    /**
+    *  BT namespace
+    */
+    namespace bt {
+
+        class BehaviourTree;
+
+        /**
+        *   iga::bt::BTHotReload; Reloads changed behaviour tree assets into live behaviour trees.
+        */
+        class BTHotReload final {
+        public:
+
+            /**
+            *   Returns the hot reloader.
+            *   @return iga::bt::BTHotReload reference.
+            */
+            static BTHotReload& Get();
+
+            /**
+            *   Starts watching the asset folder and its sub folders.
+            *   @return bool - If True ~ The asset folder is being watched.
+            */
+            bool Start();
+
+            /** Stops watching the asset folder. */
+            void Stop();
+
+            /**
+            *   Returns True while the asset folder is being watched.
+            *   @return bool value.
+            */
+            bool IsRunning() const;
+
+            /**
+            *   Handles the file changes since the last poll. Doesn't block.
+            *   Has to be called on the game thread, once per frame, outside of tree execution.
+            */
+            void Poll();
+
+            /**
+            *   Reloads an asset and swaps it into every live behaviour tree that was built from it or includes it as a subtree.
+            *   @param std::string a_asset_path File path of the BT File or runtime asset, relative to the asset folder.
+            *   @return int Amount of behaviour trees that have been patched. -1 if none of the trees could be rebuilt.
+            */
+            int Reload(const std::string& a_asset_path);
+
+            /**
+            *   Registers a live behaviour tree, so it gets patched when its asset changes.
+            *   @param iga::bt::BehaviourTree a_bt Pointer to the behaviour tree.
+            */
+            void RegisterTree(BehaviourTree* a_bt);
+
+            /**
+            *   Unregisters a behaviour tree. Gets called when the tree gets destroyed.
+            *   @param iga::bt::BehaviourTree a_bt Pointer to the behaviour tree.
+            */
+            void UnregisterTree(BehaviourTree* a_bt);
+
+        private:
+
+            /** BTHotReload Constructor */
+            BTHotReload();
+
+            /** BTHotReload Destructor. Stops watching. */
+            ~BTHotReload();
+
+            BTHotReload(const BTHotReload&) = delete;
+            BTHotReload& operator=(const BTHotReload&) = delete;
+
+            /**
+            *   Watches a folder and all of its sub folders.
+            *   @param std::string a_directory Full path of the folder.
+            *   @param std::string a_asset_directory Path of the folder, relative to the asset folder.
+            */
+            void WatchDirectory(const std::string& a_directory, const std::string& a_asset_directory);
+
+            /**
+            *   Returns True if a behaviour tree includes an asset through a RunSubtree node.
+            *   @param iga::bt::BehaviourTree a_bt Pointer to the behaviour tree.
+            *   @param std::string a_asset_path Normalized path of the asset.
+            *   @return bool value.
+            */
+            static bool UsesSubtree(BehaviourTree* a_bt, const std::string& a_asset_path);
+
+            /**
+            *   Adds the paths that the RunSubtree nodes of a behaviour tree use to reference an asset.
+            *   @param iga::bt::BehaviourTree a_bt Pointer to the behaviour tree.
+            *   @param std::string a_asset_path Normalized path of the asset.
+            *   @param std::unordered_set<std::string> a_subtree_paths The container that the paths get added to.
+            */
+            static void GetSubtreePaths(BehaviourTree* a_bt, const std::string& a_asset_path, std::unordered_set<std::string>& a_subtree_paths);
+
+            /**
+            *   Returns a path with forward slashes, so paths from BT Files and inotify can be compared.
+            *   @param std::string a_path The path.
+            *   @return std::string value.
+            */
+            static std::string NormalizePath(const std::string& a_path);
+
+            int inotify_fd_ = -1;                                       /**< inotify instance, -1 when not watching. */
+            std::unordered_map<int, std::string> watched_directories_;  /**< Watched folders relative to the asset folder, by watch descriptor. */
+
+            std::mutex trees_mutex_;                                    /**< Guards the live behaviour trees. */
+            std::unordered_set<BehaviourTree*> trees_;                  /**< Live behaviour trees. */
+
+        };
+
+    } // End of namespace ~ bt
+
+} // End of namespace ~ iga
@@ -0,0 +1,99 @@
+#include <AI/BT/bt_node_library.h>
+
+#include <AI/BT/bt_platform.h>
+
+#include <algorithm>
+#include <atomic>
+#include <cstddef>
+#include <cstring>
+#include <iostream>
+#include <mutex>
+
+namespace {
+    std::mutex registry_mutex;                      /**< Guards the registry. Constant initialized, so subscribing from static initializers is safe. */
+    std::atomic<bool> registry_finalized(false);    /**< True once the registry has been sorted. */
+}
+
+const NodeFactory* StaticNodeLibrary::Find(std::uint32_t a_type_id) {
+    const std::vector<NodeFactory>& factories = GetFactories();
+
+    std::vector<NodeFactory>::const_iterator it = std::lower_bound(factories.begin(), factories.end(), a_type_id,
+        [](const NodeFactory& a_factory, std::uint32_t a_id) { return a_factory.type_id < a_id; });
+
+    if (it == factories.end() || it->type_id != a_type_id) { return nullptr; }
+
+    return &(*it);
+}
+
+const NodeFactory* StaticNodeLibrary::Find(const char* a_type_name) {
+    const NodeFactory* factory = Find(nodedetail::HashTypeName(a_type_name));
+
+    if (factory == nullptr || std::strcmp(factory->type_name, a_type_name) != 0) { return nullptr; }
+
+    return factory;
+}
+
+const std::vector<NodeFactory>& StaticNodeLibrary::GetFactories() {
+    if (!registry_finalized.load(std::memory_order_acquire)) {
+        Finalize();
+    }
+    return GetRegistry();
+}
+
+const std::vector<NodeFactory>& StaticNodeLibrary::GetFactoriesByName() {
+    if (!registry_finalized.load(std::memory_order_acquire)) {
+        Finalize();
+    }
+    return GetRegistryByName();
+}
+
+iga::bt::BaseNode* StaticNodeLibrary::CreateNode(const NodeFactory& a_factory) {
+    DEBUGASSERT(a_factory.alignment <= alignof(std::max_align_t)); // Over-aligned nodes need an aligned allocator.
+    return a_factory.construct(::operator new(a_factory.size));
+}
+
+void StaticNodeLibrary::Finalize() {
+    std::lock_guard<std::mutex> lock(registry_mutex);
+    if (registry_finalized.load(std::memory_order_relaxed)) { return; }
+
+    std::vector<NodeFactory>& registry = GetRegistry();
+    std::sort(registry.begin(), registry.end(), [](const NodeFactory& a_left, const NodeFactory& a_right) { return a_left.type_id < a_right.type_id; });
+
+    // Type IDs are stored in runtime assets, two node types can't share one.
+    for (std::size_t i = 1; i < registry.size(); ++i) {
+        if (registry[i].type_id == registry[i - 1].type_id) {
+            std::cout << "ERROR - Behaviour Tree System - Node types " << registry[i - 1].type_name << " and " << registry[i].type_name << " have the same type ID, rename one of them." << std::endl;
+            DEBUGASSERT(false); // ERROR - Type ID collision in StaticNodeLibrary.
+        }
+    }
+
+    // Lookups use the table sorted by type ID, designers get the node types in alphabetical order.
+    std::vector<NodeFactory>& registry_by_name = GetRegistryByName();
+    registry_by_name = registry;
+    std::sort(registry_by_name.begin(), registry_by_name.end(), [](const NodeFactory& a_left, const NodeFactory& a_right) { return std::strcmp(a_left.type_name, a_right.type_name) < 0; });
+
+    registry_finalized.store(true, std::memory_order_release);
+}
+
+void StaticNodeLibrary::AddFactory(const NodeFactory& a_factory) {
+    std::lock_guard<std::mutex> lock(registry_mutex);
+
+    // Every translation unit that includes a node header subscribes the node.
+    std::vector<NodeFactory>& registry = GetRegistry();
+    for (auto& factory : registry) {
+        if (factory.type_id == a_factory.type_id && std::strcmp(factory.type_name, a_factory.type_name) == 0) { return; }
+    }
+
+    registry.push_back(a_factory);
+    registry_finalized.store(false, std::memory_order_release);
+}
+
+std::vector<NodeFactory>& StaticNodeLibrary::GetRegistry() {
+    static std::vector<NodeFactory> registry;
+    return registry;
+}
+
+std::vector<NodeFactory>& StaticNodeLibrary::GetRegistryByName() {
+    static std::vector<NodeFactory> registry_by_name;
+    return registry_by_name;
+}
@@ -0,0 +1,151 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <new>
+#include <vector>
+
+/**
+*   @file bt_node_library.h
+*   @author Channing Eggers
+*   @date 19 October 2026
+*   @brief StaticNodeLibrary Header File
+*
+*   @section DESCRIPTION
+*   The StaticNodeLibrary knows every node type that has been subscribed with SUBSCRIBE_NODE.
+*   Node types are identified by a numeric type ID; the FNV-1a hash of their type name. Runtime
+*   assets store the type ID, so building a node doesn't compare any strings.
+*
+*   Subscribing adds a node factory to a function local registry, so it doesn't depend on the
+*   initialization order of statics. On first use, the registry gets finalised into a flat table
+*   that is sorted by type ID, and a copy that is sorted by type name for menus. Factories construct nodes
+*   into memory that is provided by the caller.
+*
+*/
+
+namespace iga {
+    namespace bt {
+        class BaseNode;
+    }
+}
+
+namespace nodedetail {
+    typedef iga::bt::BaseNode* (*objectConstructLambda)(void* a_memory);
+    typedef iga::bt::BaseNode* (*objectCopyLambda)(void* a_memory, const iga::bt::BaseNode& a_node);
+
+    /**
+    *   Returns the FNV-1a hash of a node type name, used as the type ID of the node type.
+    *   @param const char* a_type_name Null terminated type name.
+    *   @return std::uint32_t value.
+    */
+    inline std::uint32_t HashTypeName(const char* a_type_name) {
+        std::uint32_t hash = 2166136261u;
+        for (const char* character = a_type_name; *character != '\0'; ++character) {
+            hash ^= static_cast<std::uint8_t>(*character);
+            hash *= 16777619u;
+        }
+        return hash;
+    }
+}
+
+/**
+*   NodeFactory; Constructs a node type.
+*/
+struct NodeFactory {
+    const char* type_name;                      /**< Type name of the node, as subscribed. */
+    std::uint32_t type_id;                      /**< FNV-1a hash of the type name. */
+    std::size_t size;                           /**< Size of the node type. */
+    std::size_t alignment;                      /**< Alignment of the node type. */
+    nodedetail::objectConstructLambda construct; /**< Constructs the node into memory of at least size bytes, aligned to alignment. */
+    nodedetail::objectCopyLambda copy;          /**< Copy constructs a node of this type into memory of at least size bytes, aligned to alignment. */
+};
+
+class StaticNodeLibrary {
+public:
+
+    /**
+    *   Subscribes a node type. Subscribing the same type again does nothing.
+    *   @param const char* a_type_name Type name of the node. Has to stay valid for the lifetime of the program.
+    *   @return bool True, so it can initialize a static.
+    */
+    template<typename C>
+    static bool Subscribe(const char* a_type_name);
+
+    /**
+    *   Returns the factory of a node type.
+    *   @param std::uint32_t a_type_id Type ID of the node.
+    *   @return NodeFactory pointer, nullptr if the type isn't subscribed.
+    */
+    static const NodeFactory* Find(std::uint32_t a_type_id);
+
+    /**
+    *   Returns the factory of a node type.
+    *   @param const char* a_type_name Type name of the node.
+    *   @return NodeFactory pointer, nullptr if the type isn't subscribed.
+    */
+    static const NodeFactory* Find(const char* a_type_name);
+
+    /**
+    *   Returns the factories of all subscribed node types, sorted by type ID.
+    *   @return std::vector<NodeFactory> reference.
+    */
+    static const std::vector<NodeFactory>& GetFactories();
+
+    /**
+    *   Returns the factories of all subscribed node types, sorted by type name. Used to list the node types.
+    *   @return std::vector<NodeFactory> reference.
+    */
+    static const std::vector<NodeFactory>& GetFactoriesByName();
+
+    /**
+    *   Constructs a node on the heap. The node gets deleted with delete.
+    *   @param NodeFactory a_factory The factory of the node type.
+    *   @return BaseNode pointer to the new node.
+    */
+    static iga::bt::BaseNode* CreateNode(const NodeFactory& a_factory);
+
+    /**
+    *   Sorts the registry by type ID and checks it for type ID collisions.
+    *   Gets called on first use, calling it at startup keeps it off the first tree build.
+    */
+    static void Finalize();
+
+private:
+
+    /**
+    *   Adds a factory to the registry.
+    *   @param NodeFactory a_factory The factory.
+    */
+    static void AddFactory(const NodeFactory& a_factory);
+
+    /**
+    *   Returns the registry, constructed on first use.
+    *   @return std::vector<NodeFactory> reference.
+    */
+    static std::vector<NodeFactory>& GetRegistry();
+
+    /**
+    *   Returns the copy of the registry that is sorted by type name, constructed on first use.
+    *   @return std::vector<NodeFactory> reference.
+    */
+    static std::vector<NodeFactory>& GetRegistryByName();
+
+};
+
+template<typename C>
+inline bool StaticNodeLibrary::Subscribe(const char* a_type_name) {
+    NodeFactory factory;
+    factory.type_name   = a_type_name;
+    factory.type_id     = nodedetail::HashTypeName(a_type_name);
+    factory.size        = sizeof(C);
+    factory.alignment   = alignof(C);
+    factory.construct   = [](void* a_memory) { return static_cast<iga::bt::BaseNode*>(new (a_memory) C()); };
+    factory.copy        = [](void* a_memory, const iga::bt::BaseNode& a_node) { return static_cast<iga::bt::BaseNode*>(new (a_memory) C(static_cast<const C&>(a_node))); };
+    AddFactory(factory);
+    return true;
+}
+
+#define SUBSCRIBE_NODE(classArg)                                                                    \
+namespace classArg##classArg {                                                                      \
+    static const bool subscribed = StaticNodeLibrary::Subscribe<classArg>( #classArg );             \
+}
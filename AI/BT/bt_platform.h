@@ -0,0 +1,72 @@
+#pragma once
+
+/**
+*   @file bt_platform.h
+*   @author Channing Eggers
+*   @date 19 October 2026
+*   @brief Engine Definitions used by the Behaviour Tree System
+*
+*   @section DESCRIPTION
+*   The behaviour tree system only uses a few definitions of the engine; DEBUGASSERT, UNUSED,
+*   GET_VARIABLE_NAME, FILEPATHPREFIX, iga::uint32 and iga::GetFileExtension. Engine builds get them
+*   from defines.h and iga_util.h.
+*
+*   Headless builds (IGART_BT_HEADLESS, see the igart_bt_core target) don't have the engine, so this
+*   file defines them with the standard library only. The asset folder of headless builds is set
+*   with IGART_BT_ASSET_DIR, it defaults to the working directory.
+*
+*/
+
+#ifdef IGART_BT_HEADLESS
+
+#include <cassert>
+#include <cstdint>
+#include <string>
+
+#ifndef DEBUGASSERT
+#define DEBUGASSERT(x) assert(x)
+#endif // DEBUGASSERT
+
+#ifndef UNUSED
+#define UNUSED(x) (void)(x)
+#endif // UNUSED
+
+#ifndef GET_VARIABLE_NAME
+#define GET_VARIABLE_NAME(x) #x
+#endif // GET_VARIABLE_NAME
+
+#ifndef IGART_BT_ASSET_DIR
+#define IGART_BT_ASSET_DIR ""
+#endif // IGART_BT_ASSET_DIR
+
+#ifndef FILEPATHPREFIX
+#define FILEPATHPREFIX std::string(IGART_BT_ASSET_DIR)
+#endif // FILEPATHPREFIX
+
+/**
+*  igart namespace
+*/
+namespace iga {
+
+    typedef std::uint32_t uint32;
+
+    /**
+    *   Returns the extension of a file path, including the dot.
+    *   @param std::string a_file_path The file path.
+    *   @return std::string The extension, empty if the file has none.
+    */
+    inline std::string GetFileExtension(const std::string& a_file_path) {
+        std::size_t dot = a_file_path.find_last_of('.');
+        std::size_t slash = a_file_path.find_last_of("/\\");
+        if (dot == std::string::npos || (slash != std::string::npos && dot < slash)) { return std::string(); }
+        return a_file_path.substr(dot);
+    }
+
+} // End of namespace ~ iga
+
+#else
+
+#include <defines.h>
+#include <iga_util.h>
+
+#endif // IGART_BT_HEADLESS
@@ -0,0 +1,414 @@
+#include <AI/BT/bt_runtime_asset.h>
+
+#include <cstring>
+#include <fstream>
+#include <iostream>
+#include <utility>
+
+#if defined(_WIN32)
+#ifndef NOMINMAX
+#define NOMINMAX
+#endif
+#include <windows.h>
+#define BT_RUNTIME_ASSET_MAPPING
+#elif defined(__unix__) || defined(__APPLE__)
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#define BT_RUNTIME_ASSET_MAPPING
+#endif
+
+namespace iga {
+
+    namespace bt {
+
+#pragma region BTRuntimeStringTable
+
+        BTRuntimeStringTable::BTRuntimeStringTable() { /*EMPTY*/ }
+
+        std::uint32_t BTRuntimeStringTable::Intern(const std::string& a_string) {
+            std::unordered_map<std::string, std::uint32_t>::const_iterator it;
+            it = this->offsets_.find(a_string);
+
+            if (it != this->offsets_.end()) {
+                return it->second;
+            }
+
+            std::uint32_t offset = static_cast<std::uint32_t>(this->data_.size());
+            this->data_.insert(this->data_.end(), a_string.begin(), a_string.end());
+            this->data_.push_back('\0');
+            this->offsets_.emplace(a_string, offset);
+
+            return offset;
+        }
+
+        const std::vector<char>& BTRuntimeStringTable::GetData() const {
+            return this->data_;
+        }
+
+#pragma endregion
+
+#pragma region BTRuntimeWriter
+
+        BTRuntimeWriter::BTRuntimeWriter(std::vector<char>* a_param_blob, BTRuntimeStringTable* a_string_table) :
+            param_blob_(a_param_blob),
+            string_table_(a_string_table)
+        {
+            // DO NOTHING
+        }
+
+        void BTRuntimeWriter::WriteInt(int a_value) {
+            std::int32_t value = static_cast<std::int32_t>(a_value);
+            std::uint32_t word;
+            std::memcpy(&word, &value, sizeof(word));
+            WriteWord(word);
+        }
+
+        void BTRuntimeWriter::WriteFloat(float a_value) {
+            std::uint32_t word;
+            std::memcpy(&word, &a_value, sizeof(word));
+            WriteWord(word);
+        }
+
+        void BTRuntimeWriter::WriteBool(bool a_value) {
+            WriteWord(a_value ? 1 : 0);
+        }
+
+        void BTRuntimeWriter::WriteString(const std::string& a_value) {
+            WriteWord(this->string_table_->Intern(a_value));
+        }
+
+        void BTRuntimeWriter::WriteWord(std::uint32_t a_value) {
+            const char* bytes = reinterpret_cast<const char*>(&a_value);
+            this->param_blob_->insert(this->param_blob_->end(), bytes, bytes + sizeof(a_value));
+        }
+
+#pragma endregion
+
+#pragma region BTRuntimeReader
+
+        BTRuntimeReader::BTRuntimeReader(const BTRuntimeAsset& a_asset, std::uint32_t a_node_index) :
+            asset_(&a_asset)
+        {
+            const BTRuntimeNodeRecord& node = a_asset.GetNode(a_node_index);
+            this->params_       = a_asset.GetParams(node);
+            this->param_size_   = node.param_size;
+        }
+
+        bool BTRuntimeReader::ReadInt(int& a_value) {
+            std::uint32_t word;
+            if (!ReadWord(word)) { return false; }
+
+            std::int32_t value;
+            std::memcpy(&value, &word, sizeof(value));
+            a_value = static_cast<int>(value);
+            return true;
+        }
+
+        bool BTRuntimeReader::ReadFloat(float& a_value) {
+            std::uint32_t word;
+            if (!ReadWord(word)) { return false; }
+
+            std::memcpy(&a_value, &word, sizeof(a_value));
+            return true;
+        }
+
+        bool BTRuntimeReader::ReadBool(bool& a_value) {
+            std::uint32_t word;
+            if (!ReadWord(word)) { return false; }
+
+            a_value = (word != 0);
+            return true;
+        }
+
+        bool BTRuntimeReader::ReadString(std::string& a_value) {
+            std::uint32_t word;
+            if (!ReadWord(word)) { return false; }
+
+            const char* string = this->asset_->GetString(word);
+            if (string == nullptr) {
+                this->valid_ = false;
+                return false;
+            }
+
+            a_value = string;
+            return true;
+        }
+
+        bool BTRuntimeReader::IsValid() const {
+            return this->valid_;
+        }
+
+        bool BTRuntimeReader::ReadWord(std::uint32_t& a_value) {
+            if (this->position_ + sizeof(a_value) > this->param_size_) {
+                this->valid_ = false;
+                return false;
+            }
+
+            std::memcpy(&a_value, this->params_ + this->position_, sizeof(a_value));
+            this->position_ += sizeof(a_value);
+            return true;
+        }
+
+#pragma endregion
+
+#pragma region BTRuntimeAsset
+
+        BTRuntimeAsset::BTRuntimeAsset() { /*EMPTY*/ }
+
+        BTRuntimeAsset::~BTRuntimeAsset() {
+            Unload();
+        }
+
+        bool BTRuntimeAsset::MapFile(const std::string& a_file_path) {
+#ifndef BT_RUNTIME_ASSET_MAPPING
+            return LoadFromFile(a_file_path);
+#else
+            Unload();
+
+#if defined(_WIN32)
+            HANDLE file = CreateFileA(a_file_path.c_str(), GENERIC_READ, FILE_SHARE_READ, nullptr, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, nullptr);
+            if (file == INVALID_HANDLE_VALUE) {
+                std::cout << "ERROR - Behaviour Tree System - Failed to open runtime asset: " << a_file_path << std::endl;
+                return false;
+            }
+
+            LARGE_INTEGER file_size;
+            if (!GetFileSizeEx(file, &file_size) || file_size.QuadPart <= 0) {
+                std::cout << "ERROR - Behaviour Tree System - Empty runtime asset: " << a_file_path << std::endl;
+                CloseHandle(file);
+                return false;
+            }
+
+            HANDLE file_mapping = CreateFileMappingA(file, nullptr, PAGE_READONLY, 0, 0, nullptr);
+            CloseHandle(file);
+            if (file_mapping == nullptr) {
+                std::cout << "ERROR - Behaviour Tree System - Failed to map runtime asset: " << a_file_path << std::endl;
+                return false;
+            }
+
+            // The view keeps the file mapping alive.
+            void* mapping = MapViewOfFile(file_mapping, FILE_MAP_READ, 0, 0, 0);
+            CloseHandle(file_mapping);
+            if (mapping == nullptr) {
+                std::cout << "ERROR - Behaviour Tree System - Failed to map runtime asset: " << a_file_path << std::endl;
+                return false;
+            }
+
+            std::size_t size = static_cast<std::size_t>(file_size.QuadPart);
+#else
+            int file = open(a_file_path.c_str(), O_RDONLY);
+            if (file < 0) {
+                std::cout << "ERROR - Behaviour Tree System - Failed to open runtime asset: " << a_file_path << std::endl;
+                return false;
+            }
+
+            struct stat file_stat;
+            if (fstat(file, &file_stat) != 0 || file_stat.st_size <= 0) {
+                std::cout << "ERROR - Behaviour Tree System - Empty runtime asset: " << a_file_path << std::endl;
+                close(file);
+                return false;
+            }
+
+            // A shared read-only mapping lets every process on this host use the same pages.
+            std::size_t size = static_cast<std::size_t>(file_stat.st_size);
+            void* mapping = mmap(nullptr, size, PROT_READ, MAP_SHARED, file, 0);
+            close(file);
+            if (mapping == MAP_FAILED) {
+                std::cout << "ERROR - Behaviour Tree System - Failed to map runtime asset: " << a_file_path << std::endl;
+                return false;
+            }
+#endif
+
+            this->mapping_      = mapping;
+            this->mapping_size_ = size;
+            this->data_         = static_cast<const char*>(mapping);
+            this->size_         = size;
+
+            if (!Validate()) {
+                Unload();
+                return false;
+            }
+
+            return true;
+#endif // BT_RUNTIME_ASSET_MAPPING
+        }
+
+        bool BTRuntimeAsset::LoadFromFile(const std::string& a_file_path) {
+            Unload();
+
+            std::ifstream is(a_file_path, std::ios::binary | std::ios::ate);
+            if (!is.is_open()) {
+                std::cout << "ERROR - Behaviour Tree System - Failed to open runtime asset: " << a_file_path << std::endl;
+                return false;
+            }
+
+            std::streamsize size = is.tellg();
+            if (size <= 0) {
+                std::cout << "ERROR - Behaviour Tree System - Empty runtime asset: " << a_file_path << std::endl;
+                return false;
+            }
+            is.seekg(0, std::ios::beg);
+
+            std::vector<char> data(static_cast<std::size_t>(size));
+            if (!is.read(data.data(), size)) {
+                std::cout << "ERROR - Behaviour Tree System - Failed to read runtime asset: " << a_file_path << std::endl;
+                return false;
+            }
+
+            return LoadFromMemory(std::move(data));
+        }
+
+        bool BTRuntimeAsset::LoadFromMemory(std::vector<char>&& a_data) {
+            Unload();
+
+            this->buffer_   = std::move(a_data);
+            this->data_     = this->buffer_.data();
+            this->size_     = this->buffer_.size();
+
+            if (!Validate()) {
+                Unload();
+                return false;
+            }
+
+            return true;
+        }
+
+        bool BTRuntimeAsset::IsLoaded() const {
+            return this->header_ != nullptr;
+        }
+
+        bool BTRuntimeAsset::IsMapped() const {
+            return this->mapping_ != nullptr;
+        }
+
+        std::uint32_t BTRuntimeAsset::GetNodeCount() const {
+            return this->header_ != nullptr ? this->header_->node_count : 0;
+        }
+
+        const BTRuntimeNodeRecord& BTRuntimeAsset::GetNode(std::uint32_t a_index) const {
+            return this->nodes_[a_index];
+        }
+
+        std::uint32_t BTRuntimeAsset::GetChild(const BTRuntimeNodeRecord& a_node, std::uint32_t a_child) const {
+            return this->children_[a_node.first_child + a_child];
+        }
+
+        const char* BTRuntimeAsset::GetString(std::uint32_t a_offset) const {
+            if (a_offset >= this->header_->string_table_size) { return nullptr; }
+
+            return this->data_ + this->header_->string_table_offset + a_offset;
+        }
+
+        const char* BTRuntimeAsset::GetParams(const BTRuntimeNodeRecord& a_node) const {
+            return this->data_ + this->header_->param_blob_offset + a_node.param_offset;
+        }
+
+        std::size_t BTRuntimeAsset::GetSize() const {
+            return this->size_;
+        }
+
+        std::uint32_t BTRuntimeAsset::GetLatestVersion() {
+            return (static_cast<std::uint32_t>(Version::LATEST) - 1);
+        }
+
+        bool BTRuntimeAsset::Validate() {
+            // Checks if a section lies inside of the asset.
+            auto in_bounds = [this](std::uint64_t a_offset, std::uint64_t a_size) {
+                return (a_offset + a_size) <= static_cast<std::uint64_t>(this->size_);
+            };
+
+            if (this->size_ < sizeof(BTRuntimeHeader)) {
+                std::cout << "ERROR - Behaviour Tree System - Runtime asset is too small." << std::endl;
+                return false;
+            }
+
+            const BTRuntimeHeader* header = reinterpret_cast<const BTRuntimeHeader*>(this->data_);
+
+            if (header->magic != magic_) {
+                std::cout << "ERROR - Behaviour Tree System - File is not a runtime asset." << std::endl;
+                return false;
+            }
+
+            if (header->version != GetLatestVersion()) {
+                std::cout << "ERROR - Behaviour Tree System - Runtime asset version " << header->version << " is not supported, re-cook the BT File." << std::endl;
+                return false;
+            }
+
+            if ((header->file_size != this->size_)                                                                                  ||
+                (header->node_count == 0)                                                                                           ||
+                (header->node_table_offset % alignof(BTRuntimeNodeRecord) != 0)                                                     ||
+                (header->child_table_offset % alignof(std::uint32_t) != 0)                                                          ||
+                (!in_bounds(header->node_table_offset, static_cast<std::uint64_t>(header->node_count) * sizeof(BTRuntimeNodeRecord))) ||
+                (!in_bounds(header->child_table_offset, static_cast<std::uint64_t>(header->child_count) * sizeof(std::uint32_t)))      ||
+                (!in_bounds(header->param_blob_offset, header->param_blob_size))                                                    ||
+                (!in_bounds(header->string_table_offset, header->string_table_size))                                                ||
+                (header->string_table_size == 0)                                                                                    ||
+                (this->data_[header->string_table_offset + header->string_table_size - 1] != '\0')
+                )
+            {
+                std::cout << "ERROR - Behaviour Tree System - Runtime asset is corrupt." << std::endl;
+                return false;
+            }
+
+            const BTRuntimeNodeRecord* nodes = reinterpret_cast<const BTRuntimeNodeRecord*>(this->data_ + header->node_table_offset);
+            const std::uint32_t* children = reinterpret_cast<const std::uint32_t*>(this->data_ + header->child_table_offset);
+
+            for (std::uint32_t i = 0; i < header->node_count; ++i) {
+                const BTRuntimeNodeRecord& node = nodes[i];
+
+                if ((node.type_name >= header->string_table_size)                                                                       ||
+                    (static_cast<std::uint64_t>(node.first_child) + node.child_count > header->child_count)                             ||
+                    (static_cast<std::uint64_t>(node.param_offset) + node.param_size > header->param_blob_size)
+                    )
+                {
+                    std::cout << "ERROR - Behaviour Tree System - Runtime asset has a corrupt node: " << i << std::endl;
+                    return false;
+                }
+
+                // Children always come after their parent in pre-order, this also rules out cycles.
+                for (std::uint32_t c = 0; c < node.child_count; ++c) {
+                    std::uint32_t child = children[node.first_child + c];
+                    if (child <= i || child >= header->node_count) {
+                        std::cout << "ERROR - Behaviour Tree System - Runtime asset has a corrupt child index at node: " << i << std::endl;
+                        return false;
+                    }
+                }
+            }
+
+            this->header_   = header;
+            this->nodes_    = nodes;
+            this->children_ = children;
+
+            return true;
+        }
+
+        void BTRuntimeAsset::Unload() {
+            this->header_   = nullptr;
+            this->nodes_    = nullptr;
+            this->children_ = nullptr;
+            this->data_     = nullptr;
+            this->size_     = 0;
+
+#ifdef BT_RUNTIME_ASSET_MAPPING
+            if (this->mapping_ != nullptr) {
+#if defined(_WIN32)
+                UnmapViewOfFile(this->mapping_);
+#else
+                munmap(this->mapping_, this->mapping_size_);
+#endif
+            }
+#endif // BT_RUNTIME_ASSET_MAPPING
+            this->mapping_      = nullptr;
+            this->mapping_size_ = 0;
+
+            this->buffer_.clear();
+            this->buffer_.shrink_to_fit();
+        }
+
+#pragma endregion
+
+    } // End of namespace ~ bt
+
+} // End of namespace ~ iga
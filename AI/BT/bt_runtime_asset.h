@@ -0,0 +1,360 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+/**
+* @file bt_runtime_asset.h
+* @brief iga::bt::BTRuntimeAsset Header File.
+*
+* @author Channing Eggers
+* @date 19 October 2026
+* @version $Revision 1.1
+*
+* The runtime asset (.btr) is the cooked version of a BT File (.bt). It only contains
+* what is needed to execute a behaviour tree; the node types, the parameters of the nodes
+* and the child indices of the nodes. Nodes are stored in pre-order, so the root is always
+* the first node and children always come after their parent.
+*
+* Layout of a runtime asset:
+*   BTRuntimeHeader
+*   BTRuntimeNodeRecord[node_count]
+*   std::uint32_t child indices[child_count]
+*   Parameter blob ~ 4 byte values, written by BaseNode::WriteRuntimeData.
+*   String table ~ Null terminated strings, referenced by offset.
+*
+* The runtime asset is read without cereal, see iga::bt::BTCooker for cooking a BT File.
+*
+* Runtime asset files get memory-mapped read-only. The node records, child indices and parameters
+* are used directly from the mapping, so processes on the same host that load the same asset share
+* its pages. Platforms without memory mapping read the file into memory instead. Strings are copied
+* into the nodes once when the tree is built, because the blackboard looks keys up by std::string.
+*
+*/
+
+/**
+*  igart namespace
+*/
+namespace iga {
+
+    /**
+    *  BT namespace
+    */
+    namespace bt {
+
+        class BTRuntimeAsset;
+
+        /**
+        *   iga::bt::BTRuntimeHeader; Header at the start of every runtime asset. Offsets are in bytes from the start of the asset.
+        */
+        struct BTRuntimeHeader {
+            std::uint32_t magic;                /**< Always BTRuntimeAsset::magic_. */
+            std::uint32_t version;              /**< Version of the runtime asset format. */
+            std::uint32_t file_size;            /**< Size of the whole runtime asset. */
+            std::uint32_t node_count;           /**< Amount of node records. */
+            std::uint32_t node_table_offset;    /**< Offset of the node records. */
+            std::uint32_t child_table_offset;   /**< Offset of the child indices. */
+            std::uint32_t child_count;          /**< Amount of child indices. */
+            std::uint32_t param_blob_offset;    /**< Offset of the parameter blob. */
+            std::uint32_t param_blob_size;      /**< Size of the parameter blob. */
+            std::uint32_t string_table_offset;  /**< Offset of the string table. */
+            std::uint32_t string_table_size;    /**< Size of the string table. */
+        };
+
+        /**
+        *   iga::bt::BTRuntimeNodeRecord; A node of a runtime asset.
+        */
+        struct BTRuntimeNodeRecord {
+            std::uint32_t type_id;              /**< Type ID of the node, as subscribed in the StaticNodeLibrary. */
+            std::uint32_t type_name;            /**< String offset of the type name of the node. Only used for error messages. */
+            std::int32_t  editor_node_id;       /**< ID of the editor node that the node was cooked from. */
+            std::uint32_t first_child;          /**< Index of the first child in the child indices. */
+            std::uint32_t child_count;          /**< Amount of children, in call order. */
+            std::uint32_t param_offset;         /**< Offset of the parameters in the parameter blob. */
+            std::uint32_t param_size;           /**< Size of the parameters in the parameter blob. */
+        };
+
+        /**
+        *   iga::bt::BTRuntimeStringTable; Interns the strings of a runtime asset while cooking.
+        */
+        class BTRuntimeStringTable final {
+        public:
+
+            /** BTRuntimeStringTable Constructor */
+            BTRuntimeStringTable();
+
+            /**
+            *   Adds a string to the table, if it isn't in the table yet.
+            *   @param std::string a_string The string.
+            *   @return std::uint32_t Offset of the string in the table.
+            */
+            std::uint32_t Intern(const std::string& a_string);
+
+            /**
+            *   Returns the data of the table.
+            *   @return std::vector<char> reference.
+            */
+            const std::vector<char>& GetData() const;
+
+        private:
+
+            std::vector<char> data_;                                /**< Null terminated strings. */
+            std::unordered_map<std::string, std::uint32_t> offsets_; /**< Offsets of the interned strings. */
+
+        };
+
+        /**
+        *   iga::bt::BTRuntimeWriter; Writes the parameters of a node while cooking.
+        *   Every value takes 4 bytes, strings are written as an offset into the string table.
+        */
+        class BTRuntimeWriter final {
+        public:
+
+            /**
+            *   BTRuntimeWriter Constructor
+            *   @param std::vector<char> a_param_blob Pointer to the parameter blob that gets written to.
+            *   @param BTRuntimeStringTable a_string_table Pointer to the string table of the asset.
+            */
+            BTRuntimeWriter(std::vector<char>* a_param_blob, BTRuntimeStringTable* a_string_table);
+
+            /**
+            *   Writes an integer.
+            *   @param int a_value The value.
+            */
+            void WriteInt(int a_value);
+
+            /**
+            *   Writes a float.
+            *   @param float a_value The value.
+            */
+            void WriteFloat(float a_value);
+
+            /**
+            *   Writes a bool.
+            *   @param bool a_value The value.
+            */
+            void WriteBool(bool a_value);
+
+            /**
+            *   Writes a string.
+            *   @param std::string a_value The value.
+            */
+            void WriteString(const std::string& a_value);
+
+        private:
+
+            /**
+            *   Appends 4 bytes to the parameter blob.
+            *   @param std::uint32_t a_value The bytes.
+            */
+            void WriteWord(std::uint32_t a_value);
+
+            std::vector<char>* param_blob_ = nullptr;               /**< Parameter blob that gets written to. */
+            BTRuntimeStringTable* string_table_ = nullptr;          /**< String table of the asset. */
+
+        };
+
+        /**
+        *   iga::bt::BTRuntimeReader; Reads the parameters of a node from a runtime asset.
+        *   Values have to be read in the order that they were written by BaseNode::WriteRuntimeData.
+        */
+        class BTRuntimeReader final {
+        public:
+
+            /**
+            *   BTRuntimeReader Constructor
+            *   @param BTRuntimeAsset a_asset The asset that the node is part of.
+            *   @param std::uint32_t a_node_index Index of the node in the asset.
+            */
+            BTRuntimeReader(const BTRuntimeAsset& a_asset, std::uint32_t a_node_index);
+
+            /**
+            *   Reads an integer.
+            *   @param int a_value The container that the value gets stored in.
+            *   @return bool - If True ~ The value has been read.
+            */
+            bool ReadInt(int& a_value);
+
+            /**
+            *   Reads a float.
+            *   @param float a_value The container that the value gets stored in.
+            *   @return bool - If True ~ The value has been read.
+            */
+            bool ReadFloat(float& a_value);
+
+            /**
+            *   Reads a bool.
+            *   @param bool a_value The container that the value gets stored in.
+            *   @return bool - If True ~ The value has been read.
+            */
+            bool ReadBool(bool& a_value);
+
+            /**
+            *   Reads a string.
+            *   @param std::string a_value The container that the value gets stored in.
+            *   @return bool - If True ~ The value has been read.
+            */
+            bool ReadString(std::string& a_value);
+
+            /**
+            *   Returns False if a read went past the parameters of the node.
+            *   @return bool value.
+            */
+            bool IsValid() const;
+
+        private:
+
+            /**
+            *   Reads 4 bytes from the parameters of the node.
+            *   @param std::uint32_t a_value The container that the bytes get stored in.
+            *   @return bool - If True ~ The bytes have been read.
+            */
+            bool ReadWord(std::uint32_t& a_value);
+
+            const BTRuntimeAsset* asset_ = nullptr; /**< The asset that the node is part of. */
+            const char* params_ = nullptr;          /**< Start of the parameters of the node. */
+            std::uint32_t param_size_ = 0;          /**< Size of the parameters of the node. */
+            std::uint32_t position_ = 0;            /**< Read position in the parameters. */
+            bool valid_ = true;                     /**< False once a read went past the parameters. */
+
+        };
+
+        /**
+        *   iga::bt::BTRuntimeAsset; A loaded and validated runtime asset.
+        */
+        class BTRuntimeAsset final {
+        public:
+
+            /**
+            *   Versions of the runtime asset format.
+            */
+            enum class Version {
+                DEFAULT = 0,    /**< Default normal version. */
+                TYPE_IDS,       /**< Node records store the type ID of the node. */
+                COMPARE_OPERATORS, /**< BBCompare stores a compare operator. */
+                LATEST          /**< Latest version. */
+            };
+
+            static const std::uint32_t magic_ = 0x31525442; /**< "BTR1" */
+
+            /** BTRuntimeAsset Constructor */
+            BTRuntimeAsset();
+
+            /** BTRuntimeAsset Destructor */
+            ~BTRuntimeAsset();
+
+            BTRuntimeAsset(const BTRuntimeAsset&) = delete;
+            BTRuntimeAsset& operator=(const BTRuntimeAsset&) = delete;
+
+            /**
+            *   Memory-maps a runtime asset file read-only. Falls back to LoadFromFile on
+            *   platforms without memory mapping.
+            *   @param std::string a_file_path The file path of the runtime asset.
+            *   @return bool - If True ~ The asset has been mapped and is valid.
+            */
+            bool MapFile(const std::string& a_file_path);
+
+            /**
+            *   Loads a runtime asset from a file into memory.
+            *   @param std::string a_file_path The file path of the runtime asset.
+            *   @return bool - If True ~ The asset has been loaded and is valid.
+            */
+            bool LoadFromFile(const std::string& a_file_path);
+
+            /**
+            *   Loads a runtime asset from memory. The asset takes ownership of the data.
+            *   @param std::vector<char> a_data The runtime asset.
+            *   @return bool - If True ~ The asset has been loaded and is valid.
+            */
+            bool LoadFromMemory(std::vector<char>&& a_data);
+
+            /**
+            *   Returns True if a valid runtime asset has been loaded.
+            *   @return bool value.
+            */
+            bool IsLoaded() const;
+
+            /**
+            *   Returns True if the asset is memory-mapped.
+            *   @return bool value.
+            */
+            bool IsMapped() const;
+
+            /**
+            *   Returns the amount of nodes in the asset.
+            *   @return std::uint32_t value.
+            */
+            std::uint32_t GetNodeCount() const;
+
+            /**
+            *   Returns a node of the asset.
+            *   @param std::uint32_t a_index Index of the node. The root is always index 0.
+            *   @return BTRuntimeNodeRecord reference.
+            */
+            const BTRuntimeNodeRecord& GetNode(std::uint32_t a_index) const;
+
+            /**
+            *   Returns the node index of a child of a node.
+            *   @param BTRuntimeNodeRecord a_node The parent node.
+            *   @param std::uint32_t a_child The call order of the child.
+            *   @return std::uint32_t Node index of the child.
+            */
+            std::uint32_t GetChild(const BTRuntimeNodeRecord& a_node, std::uint32_t a_child) const;
+
+            /**
+            *   Returns a string of the string table.
+            *   @param std::uint32_t a_offset Offset of the string.
+            *   @return const char* Null terminated string. Valid as long as the asset is loaded.
+            */
+            const char* GetString(std::uint32_t a_offset) const;
+
+            /**
+            *   Returns the parameters of a node.
+            *   @param BTRuntimeNodeRecord a_node The node.
+            *   @return const char* Start of the parameters of the node.
+            */
+            const char* GetParams(const BTRuntimeNodeRecord& a_node) const;
+
+            /**
+            *   Returns the size of the runtime asset.
+            *   @return std::size_t value.
+            */
+            std::size_t GetSize() const;
+
+            /**
+            *   Returns the version that newly cooked runtime assets get.
+            *   @return std::uint32_t value.
+            */
+            static std::uint32_t GetLatestVersion();
+
+        private:
+
+            /**
+            *   Validates the loaded data, so that accessing nodes, children, strings and
+            *   parameters stays inside of the asset.
+            *   @return bool - If True ~ The data is a valid runtime asset.
+            */
+            bool Validate();
+
+            /** Unloads the asset. */
+            void Unload();
+
+            std::vector<char> buffer_;                          /**< Owned data of the runtime asset, when it isn't mapped. */
+            void* mapping_ = nullptr;                           /**< Start of the memory mapping, when the asset is mapped. */
+            std::size_t mapping_size_ = 0;                      /**< Size of the memory mapping. */
+
+            const char* data_ = nullptr;                        /**< Start of the runtime asset. */
+            std::size_t size_ = 0;                              /**< Size of the runtime asset. */
+
+            const BTRuntimeHeader* header_ = nullptr;           /**< Header of the runtime asset. */
+            const BTRuntimeNodeRecord* nodes_ = nullptr;        /**< Node records of the runtime asset. */
+            const std::uint32_t* children_ = nullptr;           /**< Child indices of the runtime asset. */
+
+        };
+
+    } // End of namespace ~ bt
+
+} // End of namespace ~ iga
@@ -0,0 +1,145 @@
+#include <AI/BT/bt_runtime_stats.h>
+
+namespace iga {
+
+    namespace bt {
+
+        BTRuntimeStats::BTRuntimeStats() :
+            trees_alive_(0),
+            blackboard_entries_(0),
+            blackboard_bytes_(0),
+            frame_trees_ticked_(0),
+            frame_node_visits_(0),
+            frame_running_nodes_(0),
+            last_frame_trees_ticked_(0),
+            last_frame_node_visits_(0),
+            last_frame_running_nodes_(0),
+            ticks_total_(0),
+            node_visits_total_(0),
+            frames_(0),
+            builds_total_(0),
+            builds_per_second_(0.0f),
+            rate_window_start_(std::chrono::steady_clock::now())
+        {
+            for (auto& bucket : this->build_time_buckets_) {
+                bucket.store(0, std::memory_order_relaxed);
+            }
+        }
+
+        BTRuntimeStats& BTRuntimeStats::Get() {
+            static BTRuntimeStats stats;
+            return stats;
+        }
+
+        void BTRuntimeStats::OnTreeCreated() {
+            this->trees_alive_.fetch_add(1, std::memory_order_relaxed);
+        }
+
+        void BTRuntimeStats::OnTreeDestroyed() {
+            this->trees_alive_.fetch_sub(1, std::memory_order_relaxed);
+        }
+
+        void BTRuntimeStats::OnTreeTicked(std::uint32_t a_node_visits, std::uint32_t a_running_nodes, std::uint32_t a_tree_count) {
+            this->frame_trees_ticked_.fetch_add(a_tree_count, std::memory_order_relaxed);
+            this->frame_node_visits_.fetch_add(a_node_visits, std::memory_order_relaxed);
+            this->frame_running_nodes_.fetch_add(a_running_nodes, std::memory_order_relaxed);
+        }
+
+        void BTRuntimeStats::OnTreeBuilt(std::uint64_t a_build_time_us) {
+            // Find the first bucket that the build time is below.
+            std::size_t bucket = 0;
+            while (bucket < build_time_bucket_count_ - 1 && (a_build_time_us >> bucket) != 0) {
+                ++bucket;
+            }
+
+            this->build_time_buckets_[bucket].fetch_add(1, std::memory_order_relaxed);
+            this->builds_total_.fetch_add(1, std::memory_order_relaxed);
+        }
+
+        void BTRuntimeStats::OnBlackBoardChanged(std::int64_t a_entries, std::int64_t a_bytes) {
+            if (a_entries != 0) { this->blackboard_entries_.fetch_add(a_entries, std::memory_order_relaxed); }
+            if (a_bytes != 0) { this->blackboard_bytes_.fetch_add(a_bytes, std::memory_order_relaxed); }
+        }
+
+        void BTRuntimeStats::EndFrame() {
+            // Latch the frame counters.
+            std::uint64_t trees_ticked  = this->frame_trees_ticked_.exchange(0, std::memory_order_relaxed);
+            std::uint64_t node_visits   = this->frame_node_visits_.exchange(0, std::memory_order_relaxed);
+            std::uint64_t running_nodes = this->frame_running_nodes_.exchange(0, std::memory_order_relaxed);
+
+            this->last_frame_trees_ticked_.store(trees_ticked, std::memory_order_relaxed);
+            this->last_frame_node_visits_.store(node_visits, std::memory_order_relaxed);
+            this->last_frame_running_nodes_.store(running_nodes, std::memory_order_relaxed);
+
+            this->ticks_total_.fetch_add(trees_ticked, std::memory_order_relaxed);
+            this->node_visits_total_.fetch_add(node_visits, std::memory_order_relaxed);
+            this->frames_.fetch_add(1, std::memory_order_relaxed);
+
+            // Update the build rate once a full second has passed.
+            std::chrono::steady_clock::time_point now = std::chrono::steady_clock::now();
+            std::chrono::duration<float> elapsed = now - this->rate_window_start_;
+            if (elapsed.count() >= 1.0f) {
+                std::uint64_t builds_total = this->builds_total_.load(std::memory_order_relaxed);
+                this->builds_per_second_.store(static_cast<float>(builds_total - this->rate_window_builds_) / elapsed.count(), std::memory_order_relaxed);
+
+                this->rate_window_start_ = now;
+                this->rate_window_builds_ = builds_total;
+            }
+        }
+
+        BTRuntimeStatsSnapshot BTRuntimeStats::GetSnapshot() const {
+            BTRuntimeStatsSnapshot snapshot;
+
+            snapshot.trees_alive                = this->trees_alive_.load(std::memory_order_relaxed);
+            snapshot.trees_ticked_last_frame    = this->last_frame_trees_ticked_.load(std::memory_order_relaxed);
+            snapshot.node_visits_last_frame     = this->last_frame_node_visits_.load(std::memory_order_relaxed);
+            snapshot.running_nodes_last_frame   = this->last_frame_running_nodes_.load(std::memory_order_relaxed);
+            snapshot.blackboard_entries         = this->blackboard_entries_.load(std::memory_order_relaxed);
+            snapshot.blackboard_bytes           = this->blackboard_bytes_.load(std::memory_order_relaxed);
+            snapshot.builds_per_second          = this->builds_per_second_.load(std::memory_order_relaxed);
+            snapshot.build_time_p50_us          = GetBuildTimePercentile(0.50);
+            snapshot.build_time_p90_us          = GetBuildTimePercentile(0.90);
+            snapshot.build_time_p99_us          = GetBuildTimePercentile(0.99);
+            snapshot.builds_total               = this->builds_total_.load(std::memory_order_relaxed);
+            snapshot.ticks_total                = this->ticks_total_.load(std::memory_order_relaxed);
+            snapshot.node_visits_total          = this->node_visits_total_.load(std::memory_order_relaxed);
+            snapshot.frames                     = this->frames_.load(std::memory_order_relaxed);
+
+            return snapshot;
+        }
+
+        void BTRuntimeStats::ResetBuildTimes() {
+            for (auto& bucket : this->build_time_buckets_) {
+                bucket.store(0, std::memory_order_relaxed);
+            }
+            this->builds_per_second_.store(0.0f, std::memory_order_relaxed);
+        }
+
+        std::uint64_t BTRuntimeStats::GetBuildTimePercentile(double a_percentile) const {
+            // Copy the buckets first, so the total and the walk see the same counts.
+            std::array<std::uint64_t, build_time_bucket_count_> buckets;
+            std::uint64_t total = 0;
+            for (std::size_t i = 0; i < build_time_bucket_count_; ++i) {
+                buckets[i] = this->build_time_buckets_[i].load(std::memory_order_relaxed);
+                total += buckets[i];
+            }
+
+            if (total == 0) { return 0; }
+
+            std::uint64_t rank = static_cast<std::uint64_t>(a_percentile * static_cast<double>(total));
+            if (rank >= total) { rank = total - 1; }
+
+            std::uint64_t seen = 0;
+            for (std::size_t i = 0; i < build_time_bucket_count_; ++i) {
+                seen += buckets[i];
+                if (seen > rank) {
+                    return (static_cast<std::uint64_t>(1) << i);
+                }
+            }
+
+            return (static_cast<std::uint64_t>(1) << (build_time_bucket_count_ - 1));
+        }
+
+    } // End of namespace ~ bt
+
+} // End of namespace ~ iga
@@ -0,0 +1,150 @@
+#pragma once
+
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+
+/**
+* @file bt_runtime_stats.h
+* @brief iga::bt::BTRuntimeStats Header File.
+*
+* @author Channing Eggers
+* @date 19 October 2026
+* @version $Revision 1.1
+*
+* BTRuntimeStats keeps live statistics of the behaviour tree runtime; trees alive, trees ticked,
+* node visits, RUNNING nodes, blackboard memory and build times. All counters are relaxed atomics.
+* Behaviour trees count their node visits locally and publish them once per tick, so the
+* statistics are cheap enough to stay enabled in release builds.
+* A metrics exporter pulls the statistics with BTRuntimeStats::GetSnapshot().
+*
+*/
+
+/**
+*  igart namespace
+*/
+namespace iga {
+
+    /**
+    *  BT namespace
+    */
+    namespace bt {
+
+        /**
+        *   iga::bt::BTRuntimeStatsSnapshot; Copy of the runtime statistics at the moment it was taken.
+        */
+        struct BTRuntimeStatsSnapshot {
+            std::int64_t    trees_alive                 = 0;    /**< Amount of behaviour trees that currently exist. */
+            std::uint64_t   trees_ticked_last_frame     = 0;    /**< Amount of behaviour trees that got executed during the last frame. */
+            std::uint64_t   node_visits_last_frame      = 0;    /**< Amount of nodes that got executed during the last frame. */
+            std::uint64_t   running_nodes_last_frame    = 0;    /**< Amount of nodes that returned RUNNING during the last frame. */
+            std::int64_t    blackboard_entries          = 0;    /**< Amount of values stored in all blackboards. */
+            std::int64_t    blackboard_bytes            = 0;    /**< Estimated bytes of keys and values stored in all blackboards. */
+            float           builds_per_second           = 0.0f; /**< Amount of behaviour trees built per second, measured over the last full second. */
+            std::uint64_t   build_time_p50_us           = 0;    /**< 50th percentile of the build time in microseconds. */
+            std::uint64_t   build_time_p90_us           = 0;    /**< 90th percentile of the build time in microseconds. */
+            std::uint64_t   build_time_p99_us           = 0;    /**< 99th percentile of the build time in microseconds. */
+            std::uint64_t   builds_total                = 0;    /**< Amount of behaviour trees built since start-up. */
+            std::uint64_t   ticks_total                 = 0;    /**< Amount of behaviour tree executions since start-up. */
+            std::uint64_t   node_visits_total           = 0;    /**< Amount of node executions since start-up. */
+            std::uint64_t   frames                      = 0;    /**< Amount of frames that have been ended. */
+        };
+
+        /**
+        *   iga::bt::BTRuntimeStats; Global live statistics of the behaviour tree runtime.
+        */
+        class BTRuntimeStats final {
+        public:
+
+            /**
+            *   Returns the runtime statistics.
+            *   @return BTRuntimeStats reference.
+            */
+            static BTRuntimeStats& Get();
+
+            /** Counts a behaviour tree that got created. */
+            void OnTreeCreated();
+
+            /** Counts a behaviour tree that got destroyed. */
+            void OnTreeDestroyed();
+
+            /**
+            *   Counts a behaviour tree that got executed this frame.
+            *   @param std::uint32_t a_node_visits Amount of nodes that got executed during the tick.
+            *   @param std::uint32_t a_running_nodes Amount of nodes that returned RUNNING during the tick.
+            *   @param std::uint32_t a_tree_count Amount of trees that got executed, more than 1 for a pass of iga::bt::BTBatchInterpreter.
+            */
+            void OnTreeTicked(std::uint32_t a_node_visits, std::uint32_t a_running_nodes, std::uint32_t a_tree_count = 1);
+
+            /**
+            *   Counts a behaviour tree that got built.
+            *   @param std::uint64_t a_build_time_us The time it took to build the behaviour tree in microseconds.
+            */
+            void OnTreeBuilt(std::uint64_t a_build_time_us);
+
+            /**
+            *   Changes the blackboard memory totals.
+            *   @param std::int64_t a_entries Amount of entries that got added. Negative when entries got removed.
+            *   @param std::int64_t a_bytes Amount of bytes that got added. Negative when bytes got removed.
+            */
+            void OnBlackBoardChanged(std::int64_t a_entries, std::int64_t a_bytes);
+
+            /**
+            *   Ends the current frame. Latches the frame counters and updates the build rate.
+            *   Should be called once per frame by the game loop, after all behaviour trees have been executed.
+            */
+            void EndFrame();
+
+            /**
+            *   Returns a copy of the current statistics.
+            *   @return BTRuntimeStatsSnapshot value.
+            */
+            BTRuntimeStatsSnapshot GetSnapshot() const;
+
+            /** Clears the build time histogram and the build rate. */
+            void ResetBuildTimes();
+
+        private:
+
+            /** BTRuntimeStats Constructor */
+            BTRuntimeStats();
+
+            /**
+            *   Returns the build time of a percentile, estimated from the build time histogram.
+            *   @param double a_percentile The percentile between 0 and 1.
+            *   @return std::uint64_t Upper bound of the build time bucket in microseconds.
+            */
+            std::uint64_t GetBuildTimePercentile(double a_percentile) const;
+
+            static const std::size_t build_time_bucket_count_ = 32; /**< Build time buckets. Bucket i holds build times below 2^i microseconds. */
+
+            std::atomic<std::int64_t> trees_alive_;                 /**< Amount of behaviour trees that currently exist. */
+            std::atomic<std::int64_t> blackboard_entries_;          /**< Amount of values stored in all blackboards. */
+            std::atomic<std::int64_t> blackboard_bytes_;            /**< Estimated bytes stored in all blackboards. */
+
+            std::atomic<std::uint64_t> frame_trees_ticked_;         /**< Trees executed during the current frame. */
+            std::atomic<std::uint64_t> frame_node_visits_;          /**< Node executions during the current frame. */
+            std::atomic<std::uint64_t> frame_running_nodes_;        /**< RUNNING results during the current frame. */
+
+            std::atomic<std::uint64_t> last_frame_trees_ticked_;    /**< Trees executed during the last frame. */
+            std::atomic<std::uint64_t> last_frame_node_visits_;     /**< Node executions during the last frame. */
+            std::atomic<std::uint64_t> last_frame_running_nodes_;   /**< RUNNING results during the last frame. */
+
+            std::atomic<std::uint64_t> ticks_total_;                /**< Behaviour tree executions since start-up. */
+            std::atomic<std::uint64_t> node_visits_total_;          /**< Node executions since start-up. */
+            std::atomic<std::uint64_t> frames_;                     /**< Frames that have been ended. */
+
+            std::atomic<std::uint64_t> builds_total_;               /**< Behaviour trees built since start-up. */
+            std::atomic<float> builds_per_second_;                  /**< Build rate of the last full second. */
+            std::array<std::atomic<std::uint64_t>, build_time_bucket_count_> build_time_buckets_; /**< Log2 histogram of build times in microseconds. */
+
+            std::chrono::steady_clock::time_point rate_window_start_;   /**< Start of the build rate window. Only touched by EndFrame. */
+            std::uint64_t rate_window_builds_ = 0;                      /**< Builds total at the start of the build rate window. Only touched by EndFrame. */
+
+        };
+
+    } // End of namespace ~ bt
+
+} // End of namespace ~ iga
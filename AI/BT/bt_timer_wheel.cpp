@@ -0,0 +1,174 @@
+#include <AI/BT/bt_timer_wheel.h>
+
+#include <algorithm>
+#include <cmath>
+#include <iterator>
+#include <utility>
+
+namespace iga {
+
+    namespace bt {
+
+        BTTimerWheel::BTTimerWheel() { /*EMPTY*/ }
+
+        BTTimerWheel::~BTTimerWheel() { /*EMPTY*/ }
+
+        BTTimerWheel& BTTimerWheel::Get() {
+            static BTTimerWheel timer_wheel;
+            return timer_wheel;
+        }
+
+        void BTTimerWheel::Advance(float a_delta_seconds) {
+            std::vector<Timer> expired_timers;
+            {
+                std::lock_guard<std::mutex> lock(this->mutex_);
+
+                this->pending_seconds_ += static_cast<double>(a_delta_seconds);
+                std::uint64_t ticks = static_cast<std::uint64_t>(std::floor(this->pending_seconds_ / this->tick_duration_));
+                this->pending_seconds_ -= static_cast<double>(ticks) * this->tick_duration_;
+
+                for (std::uint64_t i = 0; i < ticks; ++i) {
+                    // An empty wheel has nothing to cascade, skip the remaining ticks.
+                    if (this->timer_count_ == 0) {
+                        this->current_tick_ += (ticks - i);
+                        break;
+                    }
+
+                    ++this->current_tick_;
+
+                    // Higher levels first, so their timers can still end up in the slots that cascade next.
+                    for (std::size_t level = level_count_ - 1; level > 0; --level) {
+                        std::uint64_t level_mask = (static_cast<std::uint64_t>(1) << (slot_bits_ * level)) - 1;
+                        if ((this->current_tick_ & level_mask) == 0) {
+                            Cascade(level, static_cast<std::size_t>((this->current_tick_ >> (slot_bits_ * level)) & (slot_count_ - 1)));
+                        }
+                    }
+
+                    std::vector<Timer>& slot = this->slots_[0][static_cast<std::size_t>(this->current_tick_ & (slot_count_ - 1))];
+                    this->timer_count_ -= slot.size();
+                    std::move(slot.begin(), slot.end(), std::back_inserter(expired_timers));
+                    slot.clear();
+                }
+            }
+
+            // Expire outside of the lock, so subscriptions can write values with a time to live.
+            for (auto& timer : expired_timers) {
+                BlackBoard* blackboard = nullptr;
+                {
+                    std::lock_guard<std::mutex> lock(this->mutex_);
+                    std::uint32_t owner_slot = static_cast<std::uint32_t>(timer.owner & 0xFFFFFFFF) - 1;
+                    if (this->generations_[owner_slot] == static_cast<std::uint32_t>(timer.owner >> 32)) {
+                        blackboard = this->owners_[owner_slot];
+                    }
+                }
+
+                if (blackboard != nullptr) {
+                    blackboard->ExpireMemory(timer.id, timer.type, timer.expiry_tick);
+                }
+            }
+        }
+
+        void BTTimerWheel::SetTickDuration(float a_tick_duration) {
+            std::lock_guard<std::mutex> lock(this->mutex_);
+            if (this->timer_count_ == 0 && a_tick_duration > 0.0f) {
+                this->tick_duration_ = a_tick_duration;
+            }
+        }
+
+        float BTTimerWheel::GetTickDuration() {
+            std::lock_guard<std::mutex> lock(this->mutex_);
+            return this->tick_duration_;
+        }
+
+        std::uint64_t BTTimerWheel::GetCurrentTick() {
+            std::lock_guard<std::mutex> lock(this->mutex_);
+            return this->current_tick_;
+        }
+
+        std::size_t BTTimerWheel::GetTimerCount() {
+            std::lock_guard<std::mutex> lock(this->mutex_);
+            return this->timer_count_;
+        }
+
+        std::uint64_t BTTimerWheel::Register(BlackBoard* a_blackboard) {
+            std::lock_guard<std::mutex> lock(this->mutex_);
+
+            std::uint32_t owner_slot;
+            if (!this->free_owners_.empty()) {
+                owner_slot = this->free_owners_.back();
+                this->free_owners_.pop_back();
+                this->owners_[owner_slot] = a_blackboard;
+            } else {
+                owner_slot = static_cast<std::uint32_t>(this->owners_.size());
+                this->owners_.push_back(a_blackboard);
+                this->generations_.push_back(1);
+            }
+
+            return (static_cast<std::uint64_t>(this->generations_[owner_slot]) << 32) | (owner_slot + 1);
+        }
+
+        void BTTimerWheel::Unregister(std::uint64_t a_owner) {
+            std::lock_guard<std::mutex> lock(this->mutex_);
+
+            std::uint32_t owner_slot = static_cast<std::uint32_t>(a_owner & 0xFFFFFFFF) - 1;
+            this->owners_[owner_slot] = nullptr;
+            ++this->generations_[owner_slot];
+            this->free_owners_.push_back(owner_slot);
+        }
+
+        std::uint64_t BTTimerWheel::GetExpiryTick(float a_time_to_live) {
+            std::lock_guard<std::mutex> lock(this->mutex_);
+
+            std::uint64_t ticks = static_cast<std::uint64_t>(std::ceil(std::max(a_time_to_live, 0.0f) / this->tick_duration_));
+            return this->current_tick_ + std::max<std::uint64_t>(ticks, 1);
+        }
+
+        std::uint64_t BTTimerWheel::GetExpiryTickIn(std::uint64_t a_ticks) {
+            std::lock_guard<std::mutex> lock(this->mutex_);
+            return this->current_tick_ + std::max<std::uint64_t>(a_ticks, 1);
+        }
+
+        std::uint64_t BTTimerWheel::Schedule(std::uint64_t a_owner, const std::string& a_id, BlackBoardTypes a_type, std::uint64_t a_expiry_tick) {
+            std::lock_guard<std::mutex> lock(this->mutex_);
+
+            Timer timer;
+            timer.expiry_tick = std::max(a_expiry_tick, this->current_tick_ + 1);
+            timer.owner = a_owner;
+            timer.id = a_id;
+            timer.type = a_type;
+
+            std::uint64_t expiry_tick = timer.expiry_tick;
+            Insert(std::move(timer));
+            ++this->timer_count_;
+            return expiry_tick;
+        }
+
+        void BTTimerWheel::Insert(Timer&& a_timer) {
+            // Cascading only moves timers that expire at the current tick or later; those of the current tick
+            // land in the level 0 slot that expires right after the cascade.
+            std::uint64_t expiry_tick = std::max(a_timer.expiry_tick, this->current_tick_);
+            std::uint64_t delta = expiry_tick - this->current_tick_;
+            for (std::size_t level = 0; level < level_count_; ++level) {
+                std::uint64_t level_range = static_cast<std::uint64_t>(1) << (slot_bits_ * (level + 1));
+                if (delta >= level_range && level != level_count_ - 1) { continue; }
+
+                // Timers beyond the range of the wheel wait in the last slot of the top level and get cascaded again.
+                std::uint64_t slot_tick = std::min(expiry_tick, this->current_tick_ + level_range - 1);
+                std::size_t slot = static_cast<std::size_t>((slot_tick >> (slot_bits_ * level)) & (slot_count_ - 1));
+                this->slots_[level][slot].push_back(std::move(a_timer));
+                return;
+            }
+        }
+
+        void BTTimerWheel::Cascade(std::size_t a_level, std::size_t a_slot) {
+            std::vector<Timer> timers;
+            timers.swap(this->slots_[a_level][a_slot]);
+
+            for (auto& timer : timers) {
+                Insert(std::move(timer));
+            }
+        }
+
+    } // End of namespace ~ bt
+
+} // End of namespace ~ iga
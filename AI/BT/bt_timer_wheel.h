@@ -0,0 +1,180 @@
+#pragma once
+
+#include <AI/BT/black_board.h>
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <mutex>
+#include <string>
+#include <vector>
+
+/**
+* @file bt_timer_wheel.h
+* @brief iga::bt::BTTimerWheel Header File.
+*
+* @author Channing Eggers
+* @date 19 October 2026
+* @version $Revision 1.1
+*
+* BTTimerWheel expires blackboard values that were written with a time to live. It is a hierarchical
+* timer wheel shared by all blackboards; 4 levels of 64 slots, every level covers 64 times the range of
+* the level below it. Scheduling and expiring a value are O(1), and timers of the higher levels get
+* cascaded down once per 64 ticks of the level below. Nothing scans the blackboards or polls timestamps.
+*
+* Game code advances the wheel once per frame, outside of the ticks of the behaviour trees, since expired
+* values get removed from their blackboards. Blackboards register themselves on their first value with a
+* time to live; timers of a destroyed blackboard are dropped when they expire. Every value has at most one
+* timer; writing the value again only moves its expiry tick, and a timer that fires before that tick gets
+* rescheduled by the blackboard instead of removing the value.
+*
+*/
+
+/**
+*  igart namespace
+*/
+namespace iga {
+
+    /**
+    *  BT namespace
+    */
+    namespace bt {
+
+        /**
+        *   iga::bt::BTTimerWheel; Expires blackboard values, shared by all blackboards.
+        */
+        class BTTimerWheel final {
+        public:
+
+            /**
+            *   Returns the timer wheel.
+            *   @return iga::bt::BTTimerWheel reference.
+            */
+            static BTTimerWheel& Get();
+
+            /**
+            *   Advances the time of the wheel and removes the values that expired. Has to be called
+            *   outside of the ticks of the behaviour trees whose blackboards have values with a time to live.
+            *   @param float a_delta_seconds Time since the last call in seconds.
+            */
+            void Advance(float a_delta_seconds);
+
+            /**
+            *   Sets the duration of a tick of the wheel; the resolution of the time to live.
+            *   Only has an effect while no timers are scheduled.
+            *   @param float a_tick_duration Duration of a tick in seconds.
+            */
+            void SetTickDuration(float a_tick_duration);
+
+            /**
+            *   Returns the duration of a tick of the wheel.
+            *   @return float Duration of a tick in seconds.
+            */
+            float GetTickDuration();
+
+            /**
+            *   Returns the current tick of the wheel.
+            *   @return std::uint64_t value.
+            */
+            std::uint64_t GetCurrentTick();
+
+            /**
+            *   Returns the amount of scheduled timers, including timers of values that were removed since.
+            *   @return std::size_t value.
+            */
+            std::size_t GetTimerCount();
+
+        private:
+
+            friend class BlackBoard;
+            friend class BlackBoardSnapshot;
+
+            /**
+            *   iga::bt::BTTimerWheel::Timer; The expiry of a blackboard value.
+            */
+            struct Timer {
+                std::uint64_t expiry_tick;  /**< Tick at which the timer fires. */
+                std::uint64_t owner;        /**< Registration of the blackboard. */
+                std::string id;             /**< ID of the value. */
+                BlackBoardTypes type;       /**< Type of the value. */
+            };
+
+            /** BTTimerWheel Constructor */
+            BTTimerWheel();
+
+            /** BTTimerWheel Destructor */
+            ~BTTimerWheel();
+
+            BTTimerWheel(const BTTimerWheel&) = delete;
+            BTTimerWheel& operator=(const BTTimerWheel&) = delete;
+
+            /**
+            *   Registers a blackboard.
+            *   @param BlackBoard a_blackboard The blackboard.
+            *   @return std::uint64_t The registration of the blackboard, never 0.
+            */
+            std::uint64_t Register(BlackBoard* a_blackboard);
+
+            /**
+            *   Removes the registration of a blackboard. Its timers get dropped when they expire.
+            *   @param std::uint64_t a_owner The registration of the blackboard.
+            */
+            void Unregister(std::uint64_t a_owner);
+
+            /**
+            *   Returns the tick at which a value with a time to live expires.
+            *   @param float a_time_to_live Time to live of the value in seconds.
+            *   @return std::uint64_t value, at least 1 tick after the current tick.
+            */
+            std::uint64_t GetExpiryTick(float a_time_to_live);
+
+            /**
+            *   Returns the tick at which a value expires in an amount of ticks.
+            *   @param std::uint64_t a_ticks Ticks until the value expires.
+            *   @return std::uint64_t value, at least 1 tick after the current tick.
+            */
+            std::uint64_t GetExpiryTickIn(std::uint64_t a_ticks);
+
+            /**
+            *   Schedules a timer for a blackboard value.
+            *   @param std::uint64_t a_owner The registration of the blackboard.
+            *   @param std::string a_id ID of the value.
+            *   @param BlackBoardTypes a_type Type of the value.
+            *   @param std::uint64_t a_expiry_tick Tick at which the timer fires.
+            *   @return std::uint64_t Tick at which the timer fires, at least 1 tick after the current tick.
+            */
+            std::uint64_t Schedule(std::uint64_t a_owner, const std::string& a_id, BlackBoardTypes a_type, std::uint64_t a_expiry_tick);
+
+            /**
+            *   Puts a timer into the slot of its expiry tick. The mutex has to be locked.
+            *   @param Timer a_timer The timer.
+            */
+            void Insert(Timer&& a_timer);
+
+            /**
+            *   Moves the timers of a slot of a higher level into the levels below. The mutex has to be locked.
+            *   @param std::size_t a_level The level.
+            *   @param std::size_t a_slot The slot.
+            */
+            void Cascade(std::size_t a_level, std::size_t a_slot);
+
+            static const std::size_t level_count_ = 4;      /**< Amount of levels of the wheel. */
+            static const std::size_t slot_bits_ = 6;        /**< Bits of the tick that index the slots of a level. */
+            static const std::size_t slot_count_ = 64;      /**< Amount of slots per level. */
+
+            std::mutex mutex_;                                                                  /**< Guards the wheel. */
+            std::array<std::array<std::vector<Timer>, slot_count_>, level_count_> slots_;      /**< Timers, by level and slot. */
+            std::size_t timer_count_ = 0;                                                       /**< Amount of scheduled timers. */
+            std::uint64_t current_tick_ = 0;                                                    /**< Current tick of the wheel. */
+            double pending_seconds_ = 0.0;                                                      /**< Time that hasn't added up to a tick yet. */
+            float tick_duration_ = 0.01f;                                                       /**< Duration of a tick in seconds. */
+
+            std::vector<BlackBoard*> owners_;                                                   /**< Registered blackboards, by slot. */
+            std::vector<std::uint32_t> generations_;                                            /**< Generation of every registration slot. */
+            std::vector<std::uint32_t> free_owners_;                                            /**< Unused registration slots. */
+
+        };
+
+    } // End of namespace ~ bt
+
+} // End of namespace ~ iga
@@ -0,0 +1,129 @@
+#include <AI/BT/bt_tree_pool.h>
+
+#include <AI/BT/behaviour_tree.h>
+#include <AI/BT/bt_coverage.h>
+#include <AI/BT/bt_hot_reload.h>
+#include <AI/BT/bt_runtime_stats.h>
+#include <AI/BT/bt_timer_wheel.h>
+
+namespace iga {
+
+    namespace bt {
+
+        BTTreePool::BTTreePool() {
+            // Destroying pooled trees uses these, they have to outlive the pool.
+            BTCoverage::Get();
+            BTHotReload::Get();
+            BTRuntimeStats::Get();
+            BTTimerWheel::Get();
+        }
+
+        BTTreePool::~BTTreePool() {
+            Clear();
+        }
+
+        BTTreePool& BTTreePool::Get() {
+            static BTTreePool tree_pool;
+            return tree_pool;
+        }
+
+        BehaviourTree* BTTreePool::Acquire(const std::shared_ptr<const BTRuntimeAsset>& a_asset, const std::string& a_asset_path, std::weak_ptr<Agent> a_entity) {
+            if (a_asset == nullptr) { return nullptr; }
+
+            BehaviourTree* tree = nullptr;
+            std::vector<BehaviourTree*> stale_trees;
+            {
+                std::lock_guard<std::mutex> lock(this->mutex_);
+
+                std::unordered_map<std::string, std::vector<BehaviourTree*>>::iterator pool = this->pools_.find(a_asset_path);
+                if (pool == this->pools_.end()) { return nullptr; }
+
+                // Trees of a reloaded asset don't match the asset anymore.
+                while (!pool->second.empty() && tree == nullptr) {
+                    BehaviourTree* pooled_tree = pool->second.back();
+                    pool->second.pop_back();
+
+                    if (pooled_tree->GetRuntimeAsset() == a_asset) {
+                        tree = pooled_tree;
+                    } else {
+                        stale_trees.push_back(pooled_tree);
+                    }
+                }
+            }
+
+            for (auto& stale_tree : stale_trees) {
+                delete stale_tree;
+            }
+
+            if (tree != nullptr) {
+                tree->SetTarget(a_entity);
+            }
+
+            return tree;
+        }
+
+        void BTTreePool::Release(BehaviourTree* a_bt) {
+            if (a_bt == nullptr) { return; }
+
+            if (a_bt->GetRuntimeAsset() != nullptr && !a_bt->GetFilePath().empty()) {
+                a_bt->ResetRuntimeState();
+                a_bt->SetTarget(std::weak_ptr<Agent>());
+
+                std::lock_guard<std::mutex> lock(this->mutex_);
+
+                std::vector<BehaviourTree*>& pool = this->pools_[a_bt->GetFilePath()];
+                if (pool.size() < this->max_pooled_trees_) {
+                    pool.push_back(a_bt);
+                    return;
+                }
+            }
+
+            delete a_bt;
+        }
+
+        void BTTreePool::SetMaxPooledTrees(std::size_t a_max_pooled_trees) {
+            std::vector<BehaviourTree*> dead_trees;
+            {
+                std::lock_guard<std::mutex> lock(this->mutex_);
+                this->max_pooled_trees_ = a_max_pooled_trees;
+
+                for (auto& pool : this->pools_) {
+                    while (pool.second.size() > this->max_pooled_trees_) {
+                        dead_trees.push_back(pool.second.back());
+                        pool.second.pop_back();
+                    }
+                }
+            }
+
+            for (auto& dead_tree : dead_trees) {
+                delete dead_tree;
+            }
+        }
+
+        std::size_t BTTreePool::GetPooledTreeCount() {
+            std::lock_guard<std::mutex> lock(this->mutex_);
+
+            std::size_t count = 0;
+            for (auto& pool : this->pools_) {
+                count += pool.second.size();
+            }
+            return count;
+        }
+
+        void BTTreePool::Clear() {
+            std::unordered_map<std::string, std::vector<BehaviourTree*>> pools;
+            {
+                std::lock_guard<std::mutex> lock(this->mutex_);
+                pools.swap(this->pools_);
+            }
+
+            for (auto& pool : pools) {
+                for (auto& tree : pool.second) {
+                    delete tree;
+                }
+            }
+        }
+
+    } // End of namespace ~ bt
+
+} // End of namespace ~ iga
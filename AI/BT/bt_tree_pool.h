@@ -0,0 +1,105 @@
+#pragma once
+
+#include <AI/BT/bt_agent.h>
+
+#include <cstddef>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+/**
+* @file bt_tree_pool.h
+* @brief iga::bt::BTTreePool Header File.
+*
+* @author Channing Eggers
+* @date 19 October 2026
+* @version $Revision 1.1
+*
+* BTTreePool recycles behaviour trees across entity lifetimes. When an entity is destroyed, its
+* behaviour tree gets reset in place and returned to the pool of its BT File. A newly spawned entity
+* that uses the same BT File takes the tree from the pool instead of building a new one.
+*
+* Pooled trees are only handed out for the runtime asset they were built from; trees of an asset that
+* has been reloaded in the meantime get destroyed instead. Pooled trees still count as live trees in
+* iga::bt::BTRuntimeStats.
+*
+*/
+
+/**
+*  igart namespace
+*/
+namespace iga {
+
+    /**
+    *  BT namespace
+    */
+    namespace bt {
+
+        class BehaviourTree;
+        class BTRuntimeAsset;
+
+        /**
+        *   iga::bt::BTTreePool; Recycles behaviour trees, per BT File.
+        */
+        class BTTreePool final {
+        public:
+
+            /**
+            *   Returns the tree pool.
+            *   @return iga::bt::BTTreePool reference.
+            */
+            static BTTreePool& Get();
+
+            /**
+            *   Takes a behaviour tree out of the pool of a BT File.
+            *   @param std::shared_ptr<const BTRuntimeAsset> a_asset The loaded runtime asset of the BT File.
+            *   @param std::string a_asset_path File path of the BT File.
+            *   @param std::weak_ptr<Agent> a_entity The new owner of the behaviour tree.
+            *   @return iga::bt::BehaviourTree pointer, nullptr if the pool has no tree for the asset.
+            */
+            BehaviourTree* Acquire(const std::shared_ptr<const BTRuntimeAsset>& a_asset, const std::string& a_asset_path, std::weak_ptr<Agent> a_entity);
+
+            /**
+            *   Resets a behaviour tree and returns it to the pool of its BT File. The tree gets destroyed
+            *   instead if it wasn't built from a runtime asset or the pool is full.
+            *   @param iga::bt::BehaviourTree a_bt Pointer to the behaviour tree. The pool becomes its owner.
+            */
+            void Release(BehaviourTree* a_bt);
+
+            /**
+            *   Sets the maximum amount of pooled trees per BT File. Trees above the maximum get destroyed.
+            *   @param std::size_t a_max_pooled_trees The maximum amount. 0 disables pooling.
+            */
+            void SetMaxPooledTrees(std::size_t a_max_pooled_trees);
+
+            /**
+            *   Returns the amount of pooled trees of all BT Files.
+            *   @return std::size_t value.
+            */
+            std::size_t GetPooledTreeCount();
+
+            /** Destroys all pooled trees. */
+            void Clear();
+
+        private:
+
+            /** BTTreePool Constructor */
+            BTTreePool();
+
+            /** BTTreePool Destructor. Destroys all pooled trees. */
+            ~BTTreePool();
+
+            BTTreePool(const BTTreePool&) = delete;
+            BTTreePool& operator=(const BTTreePool&) = delete;
+
+            std::mutex mutex_;                                                      /**< Guards the pools. */
+            std::unordered_map<std::string, std::vector<BehaviourTree*>> pools_;    /**< Pooled trees, by file path of their BT File. */
+            std::size_t max_pooled_trees_ = 64;                                     /**< Maximum amount of pooled trees per BT File. */
+
+        };
+
+    } // End of namespace ~ bt
+
+} // End of namespace ~ iga
@@ -13,24 +13,41 @@
 *
 */
 
-#include <AI\BT\behaviour_tree.h>
-#include <AI\BT\black_board.h>
-#include <AI\BT\behaviour_component.h>
-
-#include <AI\BT\Nodes\base_node.h>
-#include <AI\BT\Nodes\node_enums.h>
-
-#include <AI\BT\Nodes\composite_node.h>
-#include <AI\BT\Nodes\decorator_node.h>
-#include <AI\BT\Nodes\leaf_node.h>
-
-#include <AI\BT\Nodes\Decorator\root.h>
-
-#include <AI\BT\Nodes\Leaf\debug_message.h>
-
-#include <AI\BT\Nodes\Composite\sequence.h>
-#include <AI\BT\Nodes\Composite\selector.h>
-
-#include <AI\BT\Nodes\Decorator\inverter.h>
-#include <AI\BT\Nodes\Decorator\successor.h>
-#include <AI\BT\Nodes\Decorator\repeater.h>
+#include <AI/BT/behaviour_tree.h>
+#include <AI/BT/black_board.h>
+#include <AI/BT/black_board_snapshot.h>
+#include <AI/BT/black_board_store.h>
+#include <AI/BT/black_board_values.h>
+#ifndef IGART_BT_HEADLESS
+#include <AI/BT/behaviour_component.h>
+#endif // IGART_BT_HEADLESS
+#include <AI/BT/bt_runtime_stats.h>
+#include <AI/BT/bt_asset_library.h>
+#include <AI/BT/bt_hot_reload.h>
+#include <AI/BT/bt_tree_pool.h>
+#include <AI/BT/bt_timer_wheel.h>
+#include <AI/BT/bt_batch_interpreter.h>
+#include <AI/BT/bt_batch_kernels.h>
+
+#include <AI/BT/Nodes/base_node.h>
+#include <AI/BT/Nodes/node_enums.h>
+
+#include <AI/BT/Nodes/composite_node.h>
+#include <AI/BT/Nodes/decorator_node.h>
+#include <AI/BT/Nodes/leaf_node.h>
+
+#include <AI/BT/Nodes/Decorator/root.h>
+
+#include <AI/BT/Nodes/Leaf/debug_message.h>
+#include <AI/BT/Nodes/Leaf/constant_result.h>
+#include <AI/BT/Nodes/Leaf/run_subtree.h>
+#include <AI/BT/Nodes/Leaf/black_board_equal.h>
+#include <AI/BT/Nodes/Leaf/black_board_isvalid.h>
+#include <AI/BT/Nodes/Leaf/black_board_set_int.h>
+
+#include <AI/BT/Nodes/Composite/sequence.h>
+#include <AI/BT/Nodes/Composite/selector.h>
+
+#include <AI/BT/Nodes/Decorator/inverter.h>
+#include <AI/BT/Nodes/Decorator/successor.h>
+#include <AI/BT/Nodes/Decorator/repeater.h>
@@ -6,6 +6,8 @@
 #include <Utility/win_util.h>
 
 #include <AI/bt_include.h>
+#include <AI/BT/bt_coverage.h>
+#include <AI/BT/bt_cooker.h>
 
 #include <Editor/editor.h>
 #include <Editor/BTEditor/bt_editor_structs.h>
@@ -22,6 +24,7 @@
 
 #include <string>
 #include <algorithm>
+#include <atomic>
 #include <utility>
 
 namespace ed = ax::NodeEditor;
@@ -31,8 +34,12 @@ namespace iga {
 
     namespace bte {
 
+        namespace {
+            std::atomic<unsigned int> node_id_counter_(1); /** Keeps track of the IDs that have been given out. */
+        }
+
         unsigned int GetNextID() {
-            return node_id_counter_++;
+            return node_id_counter_.fetch_add(1, std::memory_order_relaxed);
         }
 
         iga::bte::BehaviourTreeEditor::BehaviourTreeEditor() :
@@ -342,7 +349,7 @@ namespace iga {
                     drawList->AddRect(to_imvec(outputsRect.top_left()), to_imvec(outputsRect.bottom_right()) - ImVec2(0, 1),
                         IM_COL32((int)(255 * pinBackground.x), (int)(255 * pinBackground.y), (int)(255 * pinBackground.z), outputAlpha), 4.0f, 3);
                     ImGui::PopStyleVar();
-                    drawList->AddRectFilled(to_imvec(contentRect.top_left()), to_imvec(contentRect.bottom_right()), IM_COL32(24, 64, 128, 200), 0.0f);
+                    drawList->AddRectFilled(to_imvec(contentRect.top_left()), to_imvec(contentRect.bottom_right()), GetCoverageColor(node->id, ImColor(24, 64, 128, 200)), 0.0f);
                     ImGui::PushStyleVar(ImGuiStyleVar_AntiAliasFringeScale, 1.0f);
                     drawList->AddRect(
                         to_imvec(contentRect.top_left()),
@@ -411,7 +418,13 @@ namespace iga {
 
                 for (auto& link : editor_links_) {
                     Vector4 l = link->color;
-                    ed::Link(link->id, link->start_pin_id, link->end_pin_id, ImColor(l.getX(), l.getY(), l.getZ()), 2.0f);
+                    ImColor link_color(l.getX(), l.getY(), l.getZ());
+                    if (show_coverage_) {
+                        // A link is as hot as the branch it leads into.
+                        EditorNode* end_node = editor_finder_.FindNodeWithPinID(link->end_pin_id);
+                        if (end_node != nullptr) { link_color = GetCoverageColor(end_node->id, link_color); }
+                    }
+                    ed::Link(link->id, link->start_pin_id, link->end_pin_id, link_color, 2.0f);
                 }
 
                 if (!createNewNode)
@@ -481,6 +494,7 @@ namespace iga {
                                         ImColor col = GetIconColor(startPin->type);
                                         new_link->color = Vector4(col.Value.x, col.Value.y, col.Value.z, col.Value.w);
                                         editor_links_.emplace_back(new_link);
+                                        editor_finder_.IndexLink(new_link);
 
                                         // Get Node with this pin.
                                         editor_finder_.FindNodeWithPinID(startPin->id)->outgoing_link_IDs.push_back(new_link->id);
@@ -525,23 +539,22 @@ namespace iga {
                                 auto id = std::find_if(editor_links_.begin(), editor_links_.end(), [linkId](auto& link) { return link->id == linkId; });
                                 if (id != editor_links_.end()) 
                                 {
-                                    // Go over the nodes and search which nodes have this link id. Delete them if present.
-                                    for (auto& node : editor_nodes_) {
-                                        for (int i = 0; i < node->outgoing_link_IDs.size(); ++i) {
-                                            if (node->outgoing_link_IDs[i] == linkId) {
-                                                node->outgoing_link_IDs.erase((node->outgoing_link_IDs.begin() + i));
-                                                break;
-                                            }
-                                        }
-                                        for (int i = 0; i < node->receiving_link_IDs.size(); ++i) {
-                                            if (node->receiving_link_IDs[i] == linkId) {
-                                                node->receiving_link_IDs.erase((node->receiving_link_IDs.begin() + i));
-                                            }
-                                        }
+                                    Link* deleted_link = *id;
+
+                                    // Remove the link id from the nodes on both ends of the link.
+                                    EditorNode* start_node = editor_finder_.FindNodeWithPinID(deleted_link->start_pin_id);
+                                    if (start_node != nullptr) {
+                                        std::vector<int>& ids = start_node->outgoing_link_IDs;
+                                        ids.erase(std::remove(ids.begin(), ids.end(), linkId), ids.end());
+                                    }
+                                    EditorNode* end_node = editor_finder_.FindNodeWithPinID(deleted_link->end_pin_id);
+                                    if (end_node != nullptr) {
+                                        std::vector<int>& ids = end_node->receiving_link_IDs;
+                                        ids.erase(std::remove(ids.begin(), ids.end(), linkId), ids.end());
                                     }
 
                                     // Delete Link
-                                    Link* deleted_link = editor_finder_.FindLink(linkId);
+                                    editor_finder_.RemoveLinkFromIndex(deleted_link);
                                     delete deleted_link;
                                     editor_links_.erase(id);
                                 }
@@ -556,10 +569,11 @@ namespace iga {
                                 auto id = std::find_if(editor_nodes_.begin(), editor_nodes_.end(), [nodeId](auto& node) { return node->id == nodeId; });
                                 if (id != editor_nodes_.end()) 
                                 {
-                                    EditorNode* deleted_node = editor_finder_.FindNode(nodeId);
+                                    EditorNode* deleted_node = *id;
                                     if (this->inspector_node_ == deleted_node) { 
                                         this->inspector_node_ = nullptr;
                                     }
+                                    editor_finder_.RemoveNodeFromIndex(deleted_node);
                                     delete deleted_node;
                                     editor_nodes_.erase(id);
                                 }
@@ -673,18 +687,18 @@ namespace iga {
                 EditorNode* node = nullptr;
 
                 ImGui::Separator();
-                if (!StaticNodeLibrary::node_library_map_->empty()) {
-                    std::map<std::string, nodedetail::objectConstructLambda>::iterator iter = StaticNodeLibrary::node_library_map_->begin();
-                    for (iter; iter != StaticNodeLibrary::node_library_map_->end(); ++iter) {
-                        if (ImGui::MenuItem(iter->first.c_str())) {
+                if (!StaticNodeLibrary::GetFactoriesByName().empty()) {
+                    std::vector<NodeFactory>::const_iterator iter = StaticNodeLibrary::GetFactoriesByName().begin();
+                    for (iter; iter != StaticNodeLibrary::GetFactoriesByName().end(); ++iter) {
+                        if (ImGui::MenuItem(iter->type_name)) {
 
                             // Allocate EditorNode & BaseNode.
                             node = new EditorNode();
-                            iga::bt::BaseNode* new_base_node(iter->second());
+                            iga::bt::BaseNode* new_base_node(StaticNodeLibrary::CreateNode(*iter));
                             DEBUGASSERT(new_base_node); // Check if new_node is invalid.
 
                             new_base_node->ConstructEditorNode(node);
-                            new_base_node->SetNodeName(iter->first);
+                            new_base_node->SetNodeName(iter->type_name);
                             node->SetBaseNode(new_base_node);
 
                             BuildNode(node);
@@ -719,6 +733,7 @@ namespace iga {
                                 }
                                 Link* new_link = new Link(GetNextID(), startPin->id, endPin->id);
                                 editor_links_.emplace_back(new_link);
+                                editor_finder_.IndexLink(new_link);
                                 ImColor col = GetIconColor(startPin->type);
                                 editor_links_.back()->color = Vector4(col.Value.x, col.Value.y, col.Value.z, col.Value.w);
 
@@ -984,6 +999,9 @@ ImGui::EndChild();
 
             if (ImGui::BeginMenu("Debug")) {
                 if (ImGui::MenuItem("Debug BehaviourTree")) {}
+                ImGui::Separator();
+                if (ImGui::MenuItem("Load Coverage Report")) { LoadCoverageReport(); }
+                if (ImGui::MenuItem("Clear Coverage Report", nullptr, false, show_coverage_)) { ClearCoverageReport(); }
                 ImGui::EndMenu();
             }
 
@@ -1072,6 +1090,9 @@ ImGui::EndChild();
                     editor_links_.push_back(new Link(link));
                 }
 
+                // Index the loaded nodes and links at once.
+                editor_finder_.RebuildIndex();
+
             }
 
         }
@@ -1154,6 +1175,15 @@ ImGui::EndChild();
             // Serialize    
             archive(my_data);
 
+            // Cook the runtime asset (.btr) next to the BT File.
+            iga::bt::BTCooker cooker;
+            std::vector<char> runtime_data;
+            if (cooker.Cook(my_data, runtime_data)) {
+                std::string btr_file_path = file_path.substr(0, file_path.size() - bt_file_extensions_.size());
+                btr_file_path.append(cooker.btr_file_extension_);
+                iga::bt::BTCooker::WriteFile(runtime_data, btr_file_path);
+            }
+
             // Post
             for (auto& node : my_data.behaviour_tree_editor_nodes) {
                 node.saving_base_node.reset();
@@ -1182,7 +1212,10 @@ ImGui::EndChild();
             }
 
             for (auto& link : this->editor_links_) {
-                if (link == nullptr) { delete link; }
+                if (link != nullptr) {
+                    delete link;
+                    link = nullptr;
+                }
             }
 
             // Selected Node
@@ -1191,6 +1224,7 @@ ImGui::EndChild();
             // Now clear the vectors
             this->editor_nodes_.clear();
             this->editor_links_.clear();
+            this->editor_finder_.ClearIndex();
 
             // Clear the NodeEditor stuff
             ed::ClearEditorContext(editor_context_);
@@ -1233,7 +1267,7 @@ ImGui::EndChild();
                         SwapCallOrder(&this->inspector_node_->outgoing_link_IDs, node_index, node_index + 1);
                     }
                     ImGui::SameLine();
-                    ImGui::Text(editor_finder_.FindEditorNodeWithInputPin(l->end_pin_id, &this->editor_nodes_)->name.c_str());
+                    ImGui::Text(editor_finder_.FindNodeWithPinID(l->end_pin_id)->name.c_str());
                     ImGui::PopID();
                 }
             }
@@ -1245,6 +1279,50 @@ ImGui::EndChild();
             ImGui::Separator();
         }
 
+        void iga::bte::BehaviourTreeEditor::LoadCoverageReport() {
+
+            // Get path from windows explorer.
+            std::string file_path;
+            HRESULT r = winutil::BasicOpenFile(file_path);
+            if (r == HRESULT_FROM_WIN32(ERROR_CANCELLED)) { return; }
+            if (FAILED(r)) { DEBUGASSERT(false); }
+
+            iga::bt::BTCoverageReport report;
+            if (!iga::bt::BTCoverage::ImportReport(file_path, report)) { return; }
+
+            // Normalize the entry counts of the nodes to a heat between 0 and 1.
+            uint32 max_entered = 0;
+            for (auto& node : report.nodes) {
+                max_entered = std::max(max_entered, node.second.counters.entered);
+            }
+
+            coverage_heat_.clear();
+            for (auto& node : report.nodes) {
+                coverage_heat_[node.first] = max_entered > 0 ? (static_cast<float>(node.second.counters.entered) / max_entered) : 0.0f;
+            }
+
+            show_coverage_ = true;
+        }
+
+        void iga::bte::BehaviourTreeEditor::ClearCoverageReport() {
+            coverage_heat_.clear();
+            show_coverage_ = false;
+        }
+
+        ImColor iga::bte::BehaviourTreeEditor::GetCoverageColor(int a_id, ImColor a_default_color) {
+            if (!show_coverage_) { return a_default_color; }
+
+            // Nodes that were never entered are dead branches.
+            auto it = coverage_heat_.find(a_id);
+            if (it == coverage_heat_.end() || it->second <= 0.0f) {
+                return ImColor(48, 48, 48, 200);
+            }
+
+            // Blend from blue (cold) to red (hot).
+            float heat = it->second;
+            return ImColor(heat, 0.25f * (1.0f - heat), 1.0f - heat, 200.0f / 255.0f);
+        }
+
 #pragma endregion End of User Editor Functionality
 
 #pragma region Touch Functions Implementation
@@ -1298,6 +1376,7 @@ ImGui::EndChild();
             }
 
             editor_nodes_.push_back(a_node);
+            editor_finder_.IndexNode(a_node);
         }
 
         void iga::bte::BehaviourTreeEditor::BuildNodes() {
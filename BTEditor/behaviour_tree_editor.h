@@ -43,8 +43,6 @@ namespace iga {
         *   @return unsigned int.
         */
         unsigned int GetNextID();
-
-        static unsigned int node_id_counter_; /** Static integer that keeps track of the IDs that have been given out. */
         
         struct EditorNode;
         struct Link;
@@ -148,6 +146,24 @@ namespace iga {
             */
             void InspectSelectedNode();
 
+            /**
+            *   Opens a coverage report and shows it as a heat map on the nodes and links.
+            */
+            void LoadCoverageReport();
+
+            /**
+            *   Removes the heat map of the coverage report.
+            */
+            void ClearCoverageReport();
+
+            /**
+            *   Returns the heat map colour of an editor node.
+            *   @param int a_id The ID of the editor node.
+            *   @param ImColor a_default_color The colour that gets returned when no coverage report is shown.
+            *   @return ImColor Heat map colour of the editor node.
+            */
+            ImColor GetCoverageColor(int a_id, ImColor a_default_color);
+
 #pragma endregion End of User Editor Functionality
 
 #pragma region Touch Functions
@@ -242,6 +258,9 @@ namespace iga {
 
             const float touch_time_                 = 1.0f;     /**< The touch time of nodes. */
             std::map<int, float> node_touch_time_;              /**< Map containing touch times of nodes.  */
+
+            bool show_coverage_                     = false;    /**< Whether a coverage report is shown as a heat map. */
+            std::map<int, float> coverage_heat_;                /**< Map containing the heat of nodes, from 0 (never entered) to 1 (entered most). */
             
         };
 
@@ -7,6 +7,8 @@
 
 #include <AI/BT/Nodes/base_node.h>
 
+#include <algorithm>
+
 /**
 *   IGArt namespace
 */
@@ -36,44 +38,32 @@ namespace iga {
         }
 
         EditorNode* BTEditorFinder::FindNode(int a_id) {
-#ifndef EDITOR
-            UNUSED(a_id); // Unused variable for RELEASE Build.
-#else
-            for (auto& node : bt_editor->editor_nodes_) {
-                if (node->id == a_id) {
-                    return node;
-                }
+            std::unordered_map<int, EditorNode*>::const_iterator it;
+            it = this->node_index_.find(a_id);
+
+            if (it != this->node_index_.end()) {
+                return it->second;
             }
-#endif //!Editor
             return nullptr;
         }
 
         EditorNode* BTEditorFinder::FindNodeWithPinID(int a_pin_id) {
-#ifndef EDITOR
-            UNUSED(a_pin_id); // Unused variable for RELEASE Build.
-#else
-            for (auto& node : bt_editor->editor_nodes_) {
-                for (auto& input : node->inputs) {
-                    if (input.id == a_pin_id) { return node; }
-                }
-                for (auto& output : node->outputs) {
-                    if (output.id == a_pin_id) { return node; }
-                }
+            std::unordered_map<int, EditorNode*>::const_iterator it;
+            it = this->pin_node_index_.find(a_pin_id);
+
+            if (it != this->pin_node_index_.end()) {
+                return it->second;
             }
-#endif //!Editor
             return nullptr;
         }
 
         Link* BTEditorFinder::FindLink(int a_id) {
-#ifndef EDITOR
-            UNUSED(a_id); // Unused variable for RELEASE Build.
-#else
-            for (auto& link : bt_editor->editor_links_) {
-                if (link->id == a_id) {
-                    return link;
-                }
+            std::unordered_map<int, Link*>::const_iterator it;
+            it = this->link_index_.find(a_id);
+
+            if (it != this->link_index_.end()) {
+                return it->second;
             }
-#endif //!Editor
             return nullptr;
         }
 
@@ -88,39 +78,23 @@ namespace iga {
         }
 
         Pin* BTEditorFinder::FindPin(int a_id) {
-#ifndef EDITOR
-            UNUSED(a_id); // Unused variable for RELEASE Build.
-#else
             if (a_id <= 0) { return nullptr; }
 
-            for (auto& node : bt_editor->editor_nodes_) {
-                for (auto& pin : node->inputs) {
-                    if (pin.id == a_id) { return &pin; }
-                }
+            std::unordered_map<int, Pin*>::const_iterator it;
+            it = this->pin_index_.find(a_id);
 
-                for (auto& pin : node->outputs) {
-                    if (pin.id == a_id) { return &pin; }
-                }
+            if (it != this->pin_index_.end()) {
+                return it->second;
             }
-#endif //!Editor
             return nullptr;
         }
 
         bool BTEditorFinder::IsPinLinked(int a_id) {
-#ifndef EDITOR
-            UNUSED(a_id); // Unused variable for RELEASE Build.
-#else
             if (a_id <= 0) {
                 return false;
             }
 
-            for (auto& link : bt_editor->editor_links_) {
-                if (link->start_pin_id == a_id || link->end_pin_id == a_id) {
-                    return true;
-                }
-            }
-#endif //!Editor
-            return false;
+            return (FindLinksWithPinID(a_id) != nullptr);
         }
 
         bool BTEditorFinder::CanCreateLink(Pin* a, Pin* b)
@@ -133,6 +107,12 @@ namespace iga {
         }
 
         EditorNode* BTEditorFinder::FindEditorNodeWithOutputPin(int a_output_pin_id, std::vector<EditorNode*>* a_search_node_vector) {
+            // Indexed nodes are found through the pin index.
+            EditorNode* indexed_node = FindNodeWithPinID(a_output_pin_id);
+            if (indexed_node != nullptr) {
+                return (!indexed_node->outputs.empty() && indexed_node->outputs[0].id == a_output_pin_id) ? indexed_node : nullptr;
+            }
+
             for (auto*& node : *a_search_node_vector) {
                 if (node->outputs.empty()) { continue; }
                 if (node->outputs[0].id == a_output_pin_id) {
@@ -143,6 +123,12 @@ namespace iga {
         }
 
         EditorNode* BTEditorFinder::FindEditorNodeWithInputPin(int a_input_pin_id, std::vector<EditorNode*>* a_search_node_vector) {
+            // Indexed nodes are found through the pin index.
+            EditorNode* indexed_node = FindNodeWithPinID(a_input_pin_id);
+            if (indexed_node != nullptr) {
+                return (!indexed_node->inputs.empty() && indexed_node->inputs[0].id == a_input_pin_id) ? indexed_node : nullptr;
+            }
+
             for (auto*& node : *a_search_node_vector) {
                 if (node->inputs.empty()) { continue; }
                 if (node->inputs[0].id == a_input_pin_id) {
@@ -168,6 +154,99 @@ namespace iga {
             }
         }
 
+        const std::vector<Link*>* BTEditorFinder::FindLinksWithPinID(int a_pin_id) {
+            std::unordered_map<int, std::vector<Link*>>::const_iterator it;
+            it = this->pin_link_index_.find(a_pin_id);
+
+            if (it != this->pin_link_index_.end() && !it->second.empty()) {
+                return &it->second;
+            }
+            return nullptr;
+        }
+
+#pragma region Index Functions
+
+        void BTEditorFinder::IndexNode(EditorNode* a_node) {
+            DEBUGASSERT(a_node);
+
+            this->node_index_[a_node->id] = a_node;
+
+            for (auto& input : a_node->inputs) {
+                this->pin_node_index_[input.id] = a_node;
+                this->pin_index_[input.id] = &input;
+            }
+
+            for (auto& output : a_node->outputs) {
+                this->pin_node_index_[output.id] = a_node;
+                this->pin_index_[output.id] = &output;
+            }
+        }
+
+        void BTEditorFinder::RemoveNodeFromIndex(EditorNode* a_node) {
+            DEBUGASSERT(a_node);
+
+            this->node_index_.erase(a_node->id);
+
+            for (auto& input : a_node->inputs) {
+                this->pin_node_index_.erase(input.id);
+                this->pin_index_.erase(input.id);
+            }
+
+            for (auto& output : a_node->outputs) {
+                this->pin_node_index_.erase(output.id);
+                this->pin_index_.erase(output.id);
+            }
+        }
+
+        void BTEditorFinder::IndexLink(Link* a_link) {
+            DEBUGASSERT(a_link);
+
+            this->link_index_[a_link->id] = a_link;
+            this->pin_link_index_[a_link->start_pin_id].push_back(a_link);
+            this->pin_link_index_[a_link->end_pin_id].push_back(a_link);
+        }
+
+        void BTEditorFinder::RemoveLinkFromIndex(Link* a_link) {
+            DEBUGASSERT(a_link);
+
+            this->link_index_.erase(a_link->id);
+
+            for (int pin_id : { a_link->start_pin_id, a_link->end_pin_id }) {
+                std::unordered_map<int, std::vector<Link*>>::iterator it;
+                it = this->pin_link_index_.find(pin_id);
+                if (it == this->pin_link_index_.end()) { continue; }
+
+                std::vector<Link*>& links = it->second;
+                links.erase(std::remove(links.begin(), links.end(), a_link), links.end());
+                if (links.empty()) { this->pin_link_index_.erase(it); }
+            }
+        }
+
+        void BTEditorFinder::RebuildIndex() {
+            ClearIndex();
+#ifdef EDITOR
+            if (bt_editor == nullptr) { return; }
+
+            for (auto& node : bt_editor->editor_nodes_) {
+                IndexNode(node);
+            }
+
+            for (auto& link : bt_editor->editor_links_) {
+                IndexLink(link);
+            }
+#endif //!Editor
+        }
+
+        void BTEditorFinder::ClearIndex() {
+            this->node_index_.clear();
+            this->pin_node_index_.clear();
+            this->pin_index_.clear();
+            this->link_index_.clear();
+            this->pin_link_index_.clear();
+        }
+
+#pragma endregion
+
     } // End of namespace ~ bte
 
 } // End of namespace ~ iga
\ No newline at end of file
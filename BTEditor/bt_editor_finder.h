@@ -2,6 +2,7 @@
 
 #include <vector>
 #include <map>
+#include <unordered_map>
 
 /**
 *   @file bt_editor_finder.h
@@ -15,6 +16,11 @@
 *   containers of the Behaviour Tree Editor.
 *
 *   BTEditorFinder is befriended with BehaviourTreeEditor.   
+*
+*   Lookups by ID go through hash indexes instead of looping over every
+*   node, pin and link. The indexes have to be kept up to date with 
+*   IndexNode, IndexLink and their Remove functions whenever nodes or
+*   links get created, deleted or loaded.
 *   ---
 *
 */
@@ -115,6 +121,7 @@ namespace iga {
 
             /**
             *   Function searches for a editor node with this pin id in a_search_node_vector.
+            *   Indexed nodes are found through the pin index, the vector is only looped over if the pin isn't indexed.
             *   @param int a_output_pin_id The pin id that you want to search for.
             *   @param std::vector<iga::bt::EditorNode*> a_search_node_vector Vector of EditorNodes that you want to loop over.
             *   @return EditorNode Pointer of the found EditorNode. If it cannot be found, nullptr gets returned.
@@ -123,6 +130,7 @@ namespace iga {
 
             /**
             *   Function searches for a editor node with this pin id in a_search_node_vector.
+            *   Indexed nodes are found through the pin index, the vector is only looped over if the pin isn't indexed.
             *   @param int a_output_pin_id The pin id that you want to search for.
             *   @param std::vector<iga::bt::EditorNode*> a_search_node_vector Vector of EditorNodes that you want to loop over.
             *   @return EditorNode Pointer of the found EditorNode. If it cannot be found, nullptr gets returned.
@@ -147,9 +155,61 @@ namespace iga {
             */
             void FindLinksWithOutputPinID(int a_output_pin_id, std::vector<iga::bte::Link*>* a_search_link_vector, std::vector<iga::bte::Link*>* a_returned_link_vector);
 
+            /**
+            *   Returns the indexed links that start or end at this pin.
+            *   @param int a_pin_id The pin id that you want to search for.
+            *   @return std::vector<iga::bte::Link*> Pointer to the links of the pin. Returns nullptr if the pin has no links.
+            */
+            const std::vector<Link*>* FindLinksWithPinID(int a_pin_id);
+
+#pragma region Index Functions
+
+            /**
+            *   Adds a node and its pins to the indexes. The pins of the node should not
+            *   be added or removed while the node is indexed.
+            *   @param EditorNode a_node Pointer to the node.
+            */
+            void IndexNode(EditorNode* a_node);
+
+            /**
+            *   Removes a node and its pins from the indexes.
+            *   @param EditorNode a_node Pointer to the node.
+            */
+            void RemoveNodeFromIndex(EditorNode* a_node);
+
+            /**
+            *   Adds a link to the indexes.
+            *   @param Link a_link Pointer to the link.
+            */
+            void IndexLink(Link* a_link);
+
+            /**
+            *   Removes a link from the indexes.
+            *   @param Link a_link Pointer to the link.
+            */
+            void RemoveLinkFromIndex(Link* a_link);
+
+            /**
+            *   Rebuilds the indexes from the nodes and links of the editor. Called after a BT File got loaded.
+            */
+            void RebuildIndex();
+
+            /**
+            *   Clears all indexes.
+            */
+            void ClearIndex();
+
+#pragma endregion
+
         private:
 
-            BehaviourTreeEditor* bt_editor; /** Pointer to the editor. */
+            BehaviourTreeEditor* bt_editor = nullptr; /** Pointer to the editor. */
+
+            std::unordered_map<int, EditorNode*> node_index_;               /**< Index of node ID to node. */
+            std::unordered_map<int, EditorNode*> pin_node_index_;           /**< Index of pin ID to the node that owns the pin. */
+            std::unordered_map<int, Pin*> pin_index_;                       /**< Index of pin ID to pin. */
+            std::unordered_map<int, Link*> link_index_;                     /**< Index of link ID to link. */
+            std::unordered_map<int, std::vector<Link*>> pin_link_index_;    /**< Index of pin ID to the links that start or end at the pin. */
 
         };
 
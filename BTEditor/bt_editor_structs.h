@@ -42,6 +42,7 @@ namespace iga {
 
     namespace bt {
         class BTBuilder;
+        class BTCooker;
         class BaseNode;
     }
 
@@ -122,6 +123,7 @@ namespace iga {
 			friend class BTEditorFinder;
             friend class BTEditorFinder;
 			friend iga::bt::BTBuilder;
+			friend iga::bt::BTCooker;
             
 			/**
 			*   Cereal versions of iga::bte::EditorNode.